@@ -4,21 +4,16 @@
 
 #include <algorithm>
 
-void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
-                            int* maxY) const {
+void EpdFont::getTextBounds(const char* string, const char* end, const CodepointFilter skip, const uint32_t trailingCp,
+                            const int startX, const int startY, int* minX, int* minY, int* maxX, int* maxY) const {
   *minX = startX;
   *minY = startY;
   *maxX = startX;
   *maxY = startY;
 
-  if (*string == '\0') {
-    return;
-  }
-
   int cursorX = startX;
   const int cursorY = startY;
-  uint32_t cp;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
+  const auto addGlyph = [&](const uint32_t cp) {
     const EpdGlyph* glyph = getGlyph(cp);
 
     if (!glyph) {
@@ -27,7 +22,7 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
 
     if (!glyph) {
       // TODO: Better handle this?
-      continue;
+      return;
     }
 
     *minX = std::min(*minX, cursorX + glyph->left);
@@ -35,13 +30,29 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
     *minY = std::min(*minY, cursorY + glyph->top - glyph->height);
     *maxY = std::max(*maxY, cursorY + glyph->top);
     cursorX += glyph->advanceX;
+  };
+
+  // A null end runs to the terminating NUL
+  uint32_t cp;
+  while ((end == nullptr || string < end) && (cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
+    if (skip == nullptr || !skip(cp)) {
+      addGlyph(cp);
+    }
+  }
+  if (trailingCp != 0) {
+    addGlyph(trailingCp);
   }
 }
 
 void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
+  getTextDimensions(string, nullptr, w, h);
+}
+
+void EpdFont::getTextDimensions(const char* begin, const char* end, int* w, int* h, const CodepointFilter skip,
+                                const uint32_t trailingCp) const {
   int minX = 0, minY = 0, maxX = 0, maxY = 0;
 
-  getTextBounds(string, 0, 0, &minX, &minY, &maxX, &maxY);
+  getTextBounds(begin, end, skip, trailingCp, 0, 0, &minX, &minY, &maxX, &maxY);
 
   *w = maxX - minX;
   *h = maxY - minY;
@@ -1,14 +1,22 @@
 #pragma once
 #include "EpdFontData.h"
 
+// Picks codepoints to leave out of a measurement
+typedef bool (*CodepointFilter)(uint32_t cp);
+
 class EpdFont {
-  void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
+  void getTextBounds(const char* string, const char* end, CodepointFilter skip, uint32_t trailingCp, int startX,
+                     int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
  public:
   const EpdFontData* data;
   explicit EpdFont(const EpdFontData* data) : data(data) {}
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
+  // Measures the bytes [begin, end) where they are, without a NUL-terminated copy. Codepoints skip() returns true for
+  // are left out, a non-zero trailingCp is measured as if appended.
+  void getTextDimensions(const char* begin, const char* end, int* w, int* h, CodepointFilter skip = nullptr,
+                         uint32_t trailingCp = 0) const;
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
@@ -22,6 +22,11 @@ void EpdFontFamily::getTextDimensions(const char* string, int* w, int* h, const
   getFont(style)->getTextDimensions(string, w, h);
 }
 
+void EpdFontFamily::getTextDimensions(const char* begin, const char* end, int* w, int* h, const Style style,
+                                      const CodepointFilter skip, const uint32_t trailingCp) const {
+  getFont(style)->getTextDimensions(begin, end, w, h, skip, trailingCp);
+}
+
 bool EpdFontFamily::hasPrintableChars(const char* string, const Style style) const {
   return getFont(style)->hasPrintableChars(string);
 }
@@ -3258,11 +3258,11 @@ static const uint8_t bookerly_12_boldBitmaps[51922] = {
 };
 
 static const EpdGlyph bookerly_12_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 6, 20, 7, 1, 19, 30, 0 }, // !
     { 9, 9, 11, 1, 18, 21, 30 }, // "
@@ -3371,7 +3371,7 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 9, 13, 11, 1, 18, 30, 6393 }, // ª
     { 14, 11, 15, 0, 12, 39, 6423 }, // «
     { 12, 7, 16, 2, 12, 21, 6462 }, // ¬
-    { 9, 3, 10, 0, 8, 7, 6483 }, // ­
+    { 9, 3, 10, 0, 8, 7, 6483 }, // U+00AD
     { 14, 14, 15, 0, 20, 49, 6490 }, // ®
     { 9, 3, 17, 4, 18, 7, 6539 }, // ¯
     { 10, 10, 13, 2, 18, 25, 6546 }, // °
@@ -3846,11 +3846,11 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 44327 }, //  
     { 0, 0, 5, 0, 0, 0, 44327 }, //  
     { 0, 0, 1, 0, 0, 0, 44327 }, //  
-    { 0, 0, 0, 0, 0, 0, 44327 }, // ​
-    { 2, 21, 0, -1, 15, 11, 44327 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 44338 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 44373 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 44421 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 44327 }, // U+200B
+    { 2, 21, 0, -1, 15, 11, 44327 }, // U+200C
+    { 6, 23, 0, -3, 17, 35, 44338 }, // U+200D
+    { 8, 24, 0, -4, 18, 48, 44373 }, // U+200E
+    { 8, 24, 0, -4, 18, 48, 44421 }, // U+200F
     { 9, 3, 10, 0, 8, 7, 44469 }, // ‐
     { 9, 3, 10, 0, 8, 7, 44476 }, // ‑
     { 13, 3, 16, 1, 10, 10, 44483 }, // ‒
@@ -3875,13 +3875,13 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 12, 5, 13, 0, 4, 15, 44929 }, // ‥
     { 23, 5, 25, 1, 4, 29, 44944 }, // …
     { 5, 5, 7, 1, 9, 7, 44973 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 44980 }, //  
-    { 0, 0, 0, 0, 0, 0, 44980 }, //  
-    { 8, 24, 0, -4, 18, 48, 44980 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 45028 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 45076 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 45124 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 45190 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 44980 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 44980 }, // U+2029
+    { 8, 24, 0, -4, 18, 48, 44980 }, // U+202A
+    { 8, 24, 0, -4, 18, 48, 45028 }, // U+202B
+    { 8, 24, 0, -4, 18, 48, 45076 }, // U+202C
+    { 11, 24, 0, -5, 18, 66, 45124 }, // U+202D
+    { 11, 24, 0, -5, 18, 66, 45190 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 45256 }, //  
     { 33, 21, 35, 1, 19, 174, 45256 }, // ‰
     { 7, 9, 7, 0, 18, 16, 45430 }, // ′
@@ -3904,11 +3904,11 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 15, 6, 25, 5, 10, 23, 46174 }, // ⁓
     { 23, 9, 23, 0, 18, 52, 46197 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 46249 }, //  
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 46249 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 46249 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 46249 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 46249 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 46249 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 46249 }, // U+2064
     { 11, 13, 11, 0, 21, 36, 46249 }, // ⁰
     { 11, 13, 11, 0, 21, 36, 46285 }, // ⁴
     { 9, 13, 11, 1, 21, 30, 46321 }, // ⁵
@@ -3105,11 +3105,11 @@ static const uint8_t bookerly_12_italicBitmaps[49479] = {
 };
 
 static const EpdGlyph bookerly_12_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 7, 20, 8, 1, 19, 35, 0 }, // !
     { 9, 8, 9, 1, 18, 18, 35 }, // "
@@ -3218,7 +3218,7 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 10, 12, 11, 1, 18, 30, 6422 }, // ª
     { 13, 10, 13, 0, 11, 33, 6452 }, // «
     { 11, 7, 16, 2, 12, 20, 6485 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 6505 }, // ­
+    { 8, 3, 9, 1, 8, 6, 6505 }, // U+00AD
     { 14, 14, 15, 0, 20, 49, 6511 }, // ®
     { 9, 3, 15, 3, 18, 7, 6560 }, // ¯
     { 9, 9, 13, 2, 18, 21, 6567 }, // °
@@ -3693,11 +3693,11 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 0, 0, 7, 0, 0, 0, 42400 }, //  
     { 0, 0, 5, 0, 0, 0, 42400 }, //  
     { 0, 0, 1, 0, 0, 0, 42400 }, //  
-    { 0, 0, 0, 0, 0, 0, 42400 }, // ​
-    { 2, 21, 0, -1, 15, 11, 42400 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 42411 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 42446 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 42494 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 42400 }, // U+200B
+    { 2, 21, 0, -1, 15, 11, 42400 }, // U+200C
+    { 6, 23, 0, -3, 17, 35, 42411 }, // U+200D
+    { 8, 24, 0, -4, 18, 48, 42446 }, // U+200E
+    { 8, 24, 0, -4, 18, 48, 42494 }, // U+200F
     { 8, 3, 9, 1, 8, 6, 42542 }, // ‐
     { 8, 3, 9, 1, 8, 6, 42548 }, // ‑
     { 12, 3, 16, 2, 10, 9, 42554 }, // ‒
@@ -3722,13 +3722,13 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 10, 5, 13, 1, 4, 13, 42962 }, // ‥
     { 21, 5, 25, 2, 4, 27, 42975 }, // …
     { 5, 4, 7, 1, 9, 5, 43002 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 43007 }, //  
-    { 0, 0, 0, 0, 0, 0, 43007 }, //  
-    { 8, 24, 0, -4, 18, 48, 43007 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 43055 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 43103 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 43151 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 43217 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 43007 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 43007 }, // U+2029
+    { 8, 24, 0, -4, 18, 48, 43007 }, // U+202A
+    { 8, 24, 0, -4, 18, 48, 43055 }, // U+202B
+    { 8, 24, 0, -4, 18, 48, 43103 }, // U+202C
+    { 11, 24, 0, -5, 18, 66, 43151 }, // U+202D
+    { 11, 24, 0, -5, 18, 66, 43217 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 43283 }, //  
     { 32, 21, 34, 1, 19, 168, 43283 }, // ‰
     { 5, 9, 7, 1, 18, 12, 43451 }, // ′
@@ -3751,11 +3751,11 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 15, 5, 25, 5, 10, 19, 44145 }, // ⁓
     { 20, 9, 21, 1, 18, 45, 44164 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 44209 }, //  
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 44209 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 44209 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 44209 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 44209 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 44209 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 44209 }, // U+2064
     { 10, 12, 11, 1, 21, 30, 44209 }, // ⁰
     { 11, 12, 11, 0, 21, 33, 44239 }, // ⁴
     { 10, 12, 11, 1, 21, 30, 44272 }, // ⁵
@@ -4448,11 +4448,11 @@ static const uint8_t bookerly_14_bolditalicBitmaps[70972] = {
 };
 
 static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 9, 23, 10, 1, 22, 52, 0 }, // !
     { 11, 10, 12, 1, 21, 28, 52 }, // "
@@ -4561,7 +4561,7 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 12, 15, 13, 1, 21, 45, 9086 }, // ª
     { 16, 12, 18, 1, 13, 48, 9131 }, // «
     { 14, 8, 18, 2, 14, 28, 9179 }, // ¬
-    { 10, 5, 11, 1, 10, 13, 9207 }, // ­
+    { 10, 5, 11, 1, 10, 13, 9207 }, // U+00AD
     { 17, 16, 17, 0, 23, 68, 9220 }, // ®
     { 10, 3, 18, 4, 21, 8, 9288 }, // ¯
     { 11, 12, 15, 2, 21, 33, 9296 }, // °
@@ -5036,11 +5036,11 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 60848 }, //  
     { 0, 0, 6, 0, 0, 0, 60848 }, //  
     { 0, 0, 1, 0, 0, 0, 60848 }, //  
-    { 0, 0, 0, 0, 0, 0, 60848 }, // ​
-    { 2, 24, 0, -1, 17, 12, 60848 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 60860 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 60899 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 60969 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 60848 }, // U+200B
+    { 2, 24, 0, -1, 17, 12, 60848 }, // U+200C
+    { 6, 26, 0, -3, 19, 39, 60860 }, // U+200D
+    { 10, 28, 0, -5, 21, 70, 60899 }, // U+200E
+    { 10, 28, 0, -5, 21, 70, 60969 }, // U+200F
     { 10, 5, 11, 1, 10, 13, 61039 }, // ‐
     { 10, 5, 11, 1, 10, 13, 61052 }, // ‑
     { 14, 3, 18, 2, 11, 11, 61065 }, // ‒
@@ -5065,13 +5065,13 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 13, 6, 15, 1, 5, 20, 61649 }, // ‥
     { 25, 6, 29, 2, 5, 38, 61669 }, // …
     { 6, 6, 8, 1, 11, 9, 61707 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 61716 }, //  
-    { 0, 0, 0, 0, 0, 0, 61716 }, //  
-    { 10, 28, 0, -5, 21, 70, 61716 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 61786 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 61856 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 61924 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 62008 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 61716 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 61716 }, // U+2029
+    { 10, 28, 0, -5, 21, 70, 61716 }, // U+202A
+    { 10, 28, 0, -5, 21, 70, 61786 }, // U+202B
+    { 10, 27, 0, -5, 20, 68, 61856 }, // U+202C
+    { 12, 28, 0, -6, 21, 84, 61924 }, // U+202D
+    { 12, 28, 0, -6, 21, 84, 62008 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 62092 }, //  
     { 39, 24, 41, 1, 22, 234, 62092 }, // ‰
     { 7, 11, 7, 0, 21, 20, 62326 }, // ′
@@ -5094,11 +5094,11 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 17, 7, 29, 6, 12, 30, 63292 }, // ⁓
     { 26, 11, 26, 0, 21, 72, 63322 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 63394 }, //  
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 63394 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 63394 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 63394 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 63394 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 63394 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 63394 }, // U+2064
     { 13, 14, 13, 0, 24, 46, 63394 }, // ⁰
     { 13, 14, 13, 0, 24, 46, 63440 }, // ⁴
     { 13, 14, 13, 0, 24, 46, 63486 }, // ⁵
@@ -4122,11 +4122,11 @@ static const uint8_t bookerly_14_italicBitmaps[65749] = {
 };
 
 static const EpdGlyph bookerly_14_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 9, 23, 9, 1, 22, 52, 0 }, // !
     { 10, 9, 11, 1, 21, 23, 52 }, // "
@@ -4235,7 +4235,7 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 11, 14, 13, 1, 21, 39, 8511 }, // ª
     { 14, 11, 15, 1, 13, 39, 8550 }, // «
     { 13, 8, 18, 3, 14, 26, 8589 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 8615 }, // ­
+    { 9, 3, 11, 1, 9, 7, 8615 }, // U+00AD
     { 17, 16, 17, 0, 23, 68, 8622 }, // ®
     { 10, 3, 18, 4, 21, 8, 8690 }, // ¯
     { 11, 11, 15, 2, 21, 31, 8698 }, // °
@@ -4710,11 +4710,11 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 56414 }, //  
     { 0, 0, 6, 0, 0, 0, 56414 }, //  
     { 0, 0, 1, 0, 0, 0, 56414 }, //  
-    { 0, 0, 0, 0, 0, 0, 56414 }, // ​
-    { 2, 24, 0, -1, 17, 12, 56414 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 56426 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 56465 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 56535 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 56414 }, // U+200B
+    { 2, 24, 0, -1, 17, 12, 56414 }, // U+200C
+    { 6, 26, 0, -3, 19, 39, 56426 }, // U+200D
+    { 10, 28, 0, -5, 21, 70, 56465 }, // U+200E
+    { 10, 28, 0, -5, 21, 70, 56535 }, // U+200F
     { 9, 3, 11, 1, 9, 7, 56605 }, // ‐
     { 9, 3, 11, 1, 9, 7, 56612 }, // ‑
     { 14, 3, 18, 2, 11, 11, 56619 }, // ‒
@@ -4739,13 +4739,13 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 12, 5, 15, 1, 4, 15, 57155 }, // ‥
     { 24, 5, 29, 2, 4, 30, 57170 }, // …
     { 6, 4, 8, 1, 10, 6, 57200 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 57206 }, //  
-    { 0, 0, 0, 0, 0, 0, 57206 }, //  
-    { 10, 28, 0, -5, 21, 70, 57206 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 57276 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 57346 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 57414 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 57498 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 57206 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 57206 }, // U+2029
+    { 10, 28, 0, -5, 21, 70, 57206 }, // U+202A
+    { 10, 28, 0, -5, 21, 70, 57276 }, // U+202B
+    { 10, 27, 0, -5, 20, 68, 57346 }, // U+202C
+    { 12, 28, 0, -6, 21, 84, 57414 }, // U+202D
+    { 12, 28, 0, -6, 21, 84, 57498 }, // U+202E
     { 0, 0, 3, 0, 0, 0, 57582 }, //  
     { 36, 24, 40, 2, 22, 216, 57582 }, // ‰
     { 6, 10, 8, 1, 21, 15, 57798 }, // ′
@@ -4768,11 +4768,11 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 17, 5, 29, 6, 11, 22, 58695 }, // ⁓
     { 23, 10, 25, 1, 21, 58, 58717 }, // ⁗
     { 0, 0, 6, 0, 0, 0, 58775 }, //  
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 58775 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 58775 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 58775 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 58775 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 58775 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 58775 }, // U+2064
     { 11, 14, 13, 1, 24, 39, 58775 }, // ⁰
     { 12, 14, 13, 0, 24, 42, 58814 }, // ⁴
     { 11, 14, 13, 1, 24, 39, 58856 }, // ⁵
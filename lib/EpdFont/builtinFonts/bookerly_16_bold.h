@@ -5408,11 +5408,11 @@ static const uint8_t bookerly_16_boldBitmaps[86336] = {
 };
 
 static const EpdGlyph bookerly_16_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 7, 26, 10, 2, 25, 46, 0 }, // !
     { 12, 12, 14, 1, 24, 36, 46 }, // "
@@ -5521,7 +5521,7 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 13, 17, 15, 1, 24, 56, 10663 }, // ª
     { 18, 13, 19, 1, 15, 59, 10719 }, // «
     { 15, 9, 21, 3, 16, 34, 10778 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 10812 }, // ­
+    { 11, 5, 13, 1, 11, 14, 10812 }, // U+00AD
     { 19, 18, 19, 0, 26, 86, 10826 }, // ®
     { 12, 4, 22, 5, 24, 12, 10912 }, // ¯
     { 13, 12, 17, 2, 23, 39, 10924 }, // °
@@ -5996,11 +5996,11 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 73743 }, //  
     { 0, 0, 7, 0, 0, 0, 73743 }, //  
     { 0, 0, 2, 0, 0, 0, 73743 }, //  
-    { 0, 0, 0, 0, 0, 0, 73743 }, // ​
-    { 2, 28, 0, -1, 20, 14, 73743 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 73757 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 73817 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 73910 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 73743 }, // U+200B
+    { 2, 28, 0, -1, 20, 14, 73743 }, // U+200C
+    { 8, 30, 0, -4, 22, 60, 73757 }, // U+200D
+    { 12, 31, 0, -6, 23, 93, 73817 }, // U+200E
+    { 12, 31, 0, -6, 23, 93, 73910 }, // U+200F
     { 11, 5, 13, 1, 11, 14, 74003 }, // ‐
     { 11, 5, 13, 1, 11, 14, 74017 }, // ‑
     { 17, 4, 21, 2, 13, 17, 74031 }, // ‒
@@ -6025,13 +6025,13 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 15, 6, 17, 1, 5, 23, 74769 }, // ‥
     { 29, 6, 33, 2, 5, 44, 74792 }, // …
     { 7, 6, 10, 1, 12, 11, 74836 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 74847 }, //  
-    { 0, 0, 0, 0, 0, 0, 74847 }, //  
-    { 12, 31, 0, -6, 23, 93, 74847 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 74940 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 75033 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 75111 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 75220 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 74847 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 74847 }, // U+2029
+    { 12, 31, 0, -6, 23, 93, 74847 }, // U+202A
+    { 12, 31, 0, -6, 23, 93, 74940 }, // U+202B
+    { 10, 31, 0, -5, 23, 78, 75033 }, // U+202C
+    { 14, 31, 0, -7, 23, 109, 75111 }, // U+202D
+    { 14, 31, 0, -7, 23, 109, 75220 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 75329 }, //  
     { 44, 27, 46, 1, 25, 297, 75329 }, // ‰
     { 9, 11, 9, 0, 23, 25, 75626 }, // ′
@@ -6054,11 +6054,11 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 20, 7, 33, 6, 13, 35, 76825 }, // ⁓
     { 30, 11, 31, 0, 23, 83, 76860 }, // ⁗
     { 0, 0, 7, 0, 0, 0, 76943 }, //  
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 76943 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 76943 }, // U+2064
     { 15, 17, 15, 0, 28, 64, 76943 }, // ⁰
     { 14, 17, 15, 0, 28, 60, 77007 }, // ⁴
     { 11, 16, 15, 2, 27, 44, 77067 }, // ⁵
@@ -5620,11 +5620,11 @@ static const uint8_t bookerly_16_bolditalicBitmaps[89727] = {
 };
 
 static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 11, 26, 11, 1, 25, 72, 0 }, // !
     { 13, 12, 13, 1, 24, 39, 72 }, // "
@@ -5733,7 +5733,7 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 14, 17, 15, 1, 24, 60, 11485 }, // ª
     { 19, 13, 20, 1, 15, 62, 11545 }, // «
     { 15, 9, 21, 3, 16, 34, 11607 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 11641 }, // ­
+    { 11, 5, 13, 1, 11, 14, 11641 }, // U+00AD
     { 19, 18, 19, 0, 26, 86, 11655 }, // ®
     { 12, 4, 20, 4, 24, 12, 11741 }, // ¯
     { 13, 12, 17, 2, 23, 39, 11753 }, // °
@@ -6208,11 +6208,11 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 76967 }, //  
     { 0, 0, 7, 0, 0, 0, 76967 }, //  
     { 0, 0, 2, 0, 0, 0, 76967 }, //  
-    { 0, 0, 0, 0, 0, 0, 76967 }, // ​
-    { 2, 28, 0, -1, 20, 14, 76967 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 76981 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 77041 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 77134 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 76967 }, // U+200B
+    { 2, 28, 0, -1, 20, 14, 76967 }, // U+200C
+    { 8, 30, 0, -4, 22, 60, 76981 }, // U+200D
+    { 12, 31, 0, -6, 23, 93, 77041 }, // U+200E
+    { 12, 31, 0, -6, 23, 93, 77134 }, // U+200F
     { 11, 5, 13, 1, 11, 14, 77227 }, // ‐
     { 11, 5, 13, 1, 11, 14, 77241 }, // ‑
     { 17, 4, 21, 2, 13, 17, 77255 }, // ‒
@@ -6237,13 +6237,13 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 15, 6, 17, 1, 5, 23, 78037 }, // ‥
     { 29, 6, 33, 2, 5, 44, 78060 }, // …
     { 7, 6, 10, 1, 12, 11, 78104 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 78115 }, //  
-    { 0, 0, 0, 0, 0, 0, 78115 }, //  
-    { 12, 31, 0, -6, 23, 93, 78115 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 78208 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 78301 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 78379 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 78488 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 78115 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 78115 }, // U+2029
+    { 12, 31, 0, -6, 23, 93, 78115 }, // U+202A
+    { 12, 31, 0, -6, 23, 93, 78208 }, // U+202B
+    { 10, 31, 0, -5, 23, 78, 78301 }, // U+202C
+    { 14, 31, 0, -7, 23, 109, 78379 }, // U+202D
+    { 14, 31, 0, -7, 23, 109, 78488 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 78597 }, //  
     { 44, 28, 46, 1, 25, 308, 78597 }, // ‰
     { 8, 11, 8, 0, 23, 22, 78905 }, // ′
@@ -6266,11 +6266,11 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 20, 7, 33, 6, 13, 35, 80113 }, // ⁓
     { 30, 11, 30, 0, 23, 83, 80148 }, // ⁗
     { 0, 0, 7, 0, 0, 0, 80231 }, //  
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 80231 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 80231 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 80231 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 80231 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 80231 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 80231 }, // U+2064
     { 14, 17, 15, 0, 28, 60, 80231 }, // ⁰
     { 14, 16, 15, 0, 28, 56, 80291 }, // ⁴
     { 13, 16, 15, 1, 27, 52, 80347 }, // ⁵
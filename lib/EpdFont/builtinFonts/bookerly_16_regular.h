@@ -5073,11 +5073,11 @@ static const uint8_t bookerly_16_regularBitmaps[80966] = {
 };
 
 static const EpdGlyph bookerly_16_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 6, 26, 9, 2, 25, 39, 0 }, // !
     { 10, 11, 12, 1, 24, 28, 39 }, // "
@@ -5186,7 +5186,7 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 11, 16, 15, 2, 24, 44, 9982 }, // ª
     { 17, 13, 17, 1, 15, 56, 10026 }, // «
     { 15, 8, 21, 3, 15, 30, 10082 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 10112 }, // ­
+    { 11, 3, 12, 1, 10, 9, 10112 }, // U+00AD
     { 19, 18, 19, 0, 26, 86, 10121 }, // ®
     { 12, 4, 22, 5, 24, 12, 10207 }, // ¯
     { 12, 11, 17, 3, 23, 33, 10219 }, // °
@@ -5661,11 +5661,11 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 69419 }, //  
     { 0, 0, 7, 0, 0, 0, 69419 }, //  
     { 0, 0, 2, 0, 0, 0, 69419 }, //  
-    { 0, 0, 0, 0, 0, 0, 69419 }, // ​
-    { 2, 28, 0, -1, 20, 14, 69419 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 69433 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 69493 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 69586 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 69419 }, // U+200B
+    { 2, 28, 0, -1, 20, 14, 69419 }, // U+200C
+    { 8, 30, 0, -4, 22, 60, 69433 }, // U+200D
+    { 12, 31, 0, -6, 23, 93, 69493 }, // U+200E
+    { 12, 31, 0, -6, 23, 93, 69586 }, // U+200F
     { 11, 3, 12, 1, 10, 9, 69679 }, // ‐
     { 11, 3, 12, 1, 10, 9, 69688 }, // ‑
     { 16, 3, 21, 2, 13, 12, 69697 }, // ‒
@@ -5690,13 +5690,13 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 14, 5, 17, 1, 4, 18, 70339 }, // ‥
     { 27, 5, 33, 3, 4, 34, 70357 }, // …
     { 5, 6, 9, 2, 12, 8, 70391 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 70399 }, //  
-    { 0, 0, 0, 0, 0, 0, 70399 }, //  
-    { 12, 31, 0, -6, 23, 93, 70399 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 70492 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 70585 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 70663 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 70772 }, // ‮
+    { 0, 0, 0, 0, 0, 0, 70399 }, // U+2028
+    { 0, 0, 0, 0, 0, 0, 70399 }, // U+2029
+    { 12, 31, 0, -6, 23, 93, 70399 }, // U+202A
+    { 12, 31, 0, -6, 23, 93, 70492 }, // U+202B
+    { 10, 31, 0, -5, 23, 78, 70585 }, // U+202C
+    { 14, 31, 0, -7, 23, 109, 70663 }, // U+202D
+    { 14, 31, 0, -7, 23, 109, 70772 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 70881 }, //  
     { 43, 26, 45, 1, 24, 280, 70881 }, // ‰
     { 7, 11, 9, 1, 23, 20, 71161 }, // ′
@@ -5719,11 +5719,11 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 19, 6, 33, 7, 13, 29, 72253 }, // ⁓
     { 26, 11, 28, 1, 23, 72, 72282 }, // ⁗
     { 0, 0, 7, 0, 0, 0, 72354 }, //  
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 72354 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 72354 }, // U+2060
+    { 0, 0, 0, 0, 0, 0, 72354 }, // U+2061
+    { 0, 0, 0, 0, 0, 0, 72354 }, // U+2062
+    { 0, 0, 0, 0, 0, 0, 72354 }, // U+2063
+    { 0, 0, 0, 0, 0, 0, 72354 }, // U+2064
     { 13, 17, 15, 1, 28, 56, 72354 }, // ⁰
     { 13, 17, 15, 1, 28, 56, 72410 }, // ⁴
     { 10, 16, 15, 2, 27, 40, 72466 }, // ⁵
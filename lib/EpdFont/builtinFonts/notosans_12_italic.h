@@ -3102,8 +3102,8 @@ static const uint8_t notosans_12_italicBitmaps[49440] = {
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 7, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 7, 19, 7, 0, 18, 34, 0 }, // !
     { 9, 7, 10, 2, 18, 16, 34 }, // "
@@ -3212,7 +3212,7 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 8, 10, 8, 2, 19, 20, 5750 }, // ª
     { 11, 11, 12, 1, 12, 31, 5770 }, // «
     { 13, 7, 14, 1, 10, 23, 5801 }, // ¬
-    { 7, 3, 8, 0, 8, 6, 5824 }, // ­
+    { 7, 3, 8, 0, 8, 6, 5824 }, // U+00AD
     { 19, 20, 21, 1, 19, 95, 5830 }, // ®
     { 11, 2, 10, 2, 21, 6, 5925 }, // ¯
     { 9, 9, 11, 1, 19, 21, 5931 }, // °
@@ -3802,11 +3802,11 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 0, 0, 6, 0, 0, 0, 42341 }, //  
     { 0, 0, 4, 0, 0, 0, 42341 }, //  
     { 0, 0, 3, 0, 0, 0, 42341 }, //  
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ​
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 42341 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 42341 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 42380 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 42341 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 42341 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 42341 }, // U+200D
+    { 7, 22, 0, -1, 18, 39, 42341 }, // U+200E
+    { 7, 22, 0, -6, 18, 39, 42380 }, // U+200F
     { 7, 3, 8, 0, 8, 6, 42419 }, // ‐
     { 7, 3, 8, 0, 8, 6, 42425 }, // ‑
     { 13, 2, 14, 1, 10, 7, 42431 }, // ‒
@@ -3831,13 +3831,13 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 10, 5, 13, 0, 4, 13, 42816 }, // ‥
     { 17, 5, 19, 0, 4, 22, 42829 }, // …
     { 4, 5, 6, 1, 9, 5, 42851 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 42856 }, //  
-    { 0, 0, 15, 0, 0, 0, 42856 }, //  
-    { 7, 20, 0, -1, 16, 35, 42856 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 42891 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 42926 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 42959 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 42992 }, // ‮
+    { 0, 0, 15, 0, 0, 0, 42856 }, // U+2028
+    { 0, 0, 15, 0, 0, 0, 42856 }, // U+2029
+    { 7, 20, 0, -1, 16, 35, 42856 }, // U+202A
+    { 7, 20, 0, -6, 16, 35, 42891 }, // U+202B
+    { 6, 22, 0, -3, 18, 33, 42926 }, // U+202C
+    { 6, 22, 0, -3, 18, 33, 42959 }, // U+202D
+    { 6, 22, 0, -3, 18, 33, 42992 }, // U+202E
     { 0, 0, 4, 0, 0, 0, 43025 }, //  
     { 26, 20, 28, 2, 19, 130, 43025 }, // ‰
     { 34, 20, 36, 2, 19, 170, 43155 }, // ‱
@@ -3887,21 +3887,21 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 4, 19, 7, 1, 18, 19, 45547 }, // ⁝
     { 4, 20, 7, 2, 19, 20, 45566 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 45586 }, //  
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 45586 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 45586 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 45619 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 45652 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 45685 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 45718 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 45751 }, // ⁯
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2060
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2061
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2062
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2063
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2064
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2066
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2067
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2068
+    { 0, 0, 15, 0, 0, 0, 45586 }, // U+2069
+    { 6, 22, 0, -3, 18, 33, 45586 }, // U+206A
+    { 6, 22, 0, -3, 18, 33, 45619 }, // U+206B
+    { 6, 22, 0, -3, 18, 33, 45652 }, // U+206C
+    { 6, 22, 0, -3, 18, 33, 45685 }, // U+206D
+    { 6, 22, 0, -3, 18, 33, 45718 }, // U+206E
+    { 6, 22, 0, -3, 18, 33, 45751 }, // U+206F
     { 9, 12, 9, 2, 22, 27, 45784 }, // ⁰
     { 4, 12, 6, 2, 19, 12, 45811 }, // ⁱ
     { 9, 12, 9, 1, 22, 27, 45823 }, // ⁴
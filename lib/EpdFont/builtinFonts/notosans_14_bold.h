@@ -4303,8 +4303,8 @@ static const uint8_t notosans_14_boldBitmaps[68654] = {
 };
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 6, 22, 8, 1, 21, 33, 0 }, // !
     { 12, 8, 14, 1, 21, 24, 33 }, // "
@@ -4413,7 +4413,7 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 10, 12, 11, 0, 22, 30, 7632 }, // ª
     { 16, 14, 18, 1, 15, 56, 7662 }, // «
     { 15, 9, 17, 1, 12, 34, 7718 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 7752 }, // ­
+    { 9, 4, 9, 0, 10, 9, 7752 }, // U+00AD
     { 22, 23, 24, 1, 22, 127, 7761 }, // ®
     { 16, 4, 15, -1, 26, 16, 7888 }, // ¯
     { 11, 11, 12, 1, 22, 31, 7904 }, // °
@@ -5003,11 +5003,11 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 58696 }, //  
     { 0, 0, 5, 0, 0, 0, 58696 }, //  
     { 0, 0, 3, 0, 0, 0, 58696 }, //  
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ​
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 58696 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 58696 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 58746 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 58696 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 58696 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 58696 }, // U+200D
+    { 8, 25, 0, -1, 21, 50, 58696 }, // U+200E
+    { 8, 25, 0, -7, 21, 50, 58746 }, // U+200F
     { 9, 4, 9, 0, 10, 9, 58796 }, // ‐
     { 9, 4, 9, 0, 10, 9, 58805 }, // ‑
     { 15, 4, 17, 1, 12, 15, 58814 }, // ‒
@@ -5032,13 +5032,13 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 15, 6, 17, 1, 5, 23, 59381 }, // ‥
     { 23, 6, 25, 1, 5, 35, 59404 }, // …
     { 6, 6, 8, 1, 11, 9, 59439 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 59448 }, //  
-    { 0, 0, 18, 0, 0, 0, 59448 }, //  
-    { 8, 22, 0, -1, 18, 44, 59448 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 59492 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 59536 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 59586 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 59636 }, // ‮
+    { 0, 0, 18, 0, 0, 0, 59448 }, // U+2028
+    { 0, 0, 18, 0, 0, 0, 59448 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 59448 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 59492 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 59536 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 59586 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 59636 }, // U+202E
     { 0, 0, 5, 0, 0, 0, 59686 }, //  
     { 37, 23, 37, 0, 22, 213, 59686 }, // ‰
     { 48, 23, 49, 0, 22, 276, 59899 }, // ‱
@@ -5088,21 +5088,21 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 6, 24, 8, 1, 23, 36, 63235 }, // ⁝
     { 6, 23, 8, 1, 22, 35, 63271 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 63306 }, //  
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 63306 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 63306 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 63306 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 63356 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 63406 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 63456 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 63506 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 63556 }, // ⁯
+    { 0, 0, 18, 0, 0, 0, 63306 }, // U+2060
+    { 0, 0, 18, 0, 0, 0, 63306 }, // U+2061
+    { 0, 0, 18, 0, 0, 0, 63306 }, // U+2062
+    { 0, 0, 18, 0, 0, 0, 63306 }, // U+2063
+    { 0, 0, 18, 0, 0, 0, 63306 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 63306 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 63306 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 63306 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 63306 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 63306 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 63356 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 63406 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 63456 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 63506 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 63556 }, // U+206F
     { 11, 14, 11, 0, 25, 39, 63606 }, // ⁰
     { 4, 14, 6, 1, 22, 14, 63645 }, // ⁱ
     { 11, 13, 11, 0, 25, 36, 63659 }, // ⁴
@@ -4571,8 +4571,8 @@ static const uint8_t notosans_14_bolditalicBitmaps[72942] = {
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 10, 22, 8, 0, 21, 55, 0 }, // !
     { 12, 8, 13, 2, 21, 24, 55 }, // "
@@ -4681,7 +4681,7 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 11, 12, 11, 2, 22, 33, 8389 }, // ª
     { 16, 14, 17, 1, 15, 56, 8422 }, // «
     { 15, 9, 17, 1, 12, 34, 8478 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 8512 }, // ­
+    { 9, 4, 9, 0, 10, 9, 8512 }, // U+00AD
     { 22, 23, 24, 1, 22, 127, 8521 }, // ®
     { 15, 4, 12, 2, 26, 15, 8648 }, // ¯
     { 11, 11, 12, 1, 22, 31, 8663 }, // °
@@ -5271,11 +5271,11 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 62595 }, //  
     { 0, 0, 5, 0, 0, 0, 62595 }, //  
     { 0, 0, 3, 0, 0, 0, 62595 }, //  
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ​
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 62595 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 62595 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 62645 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 62595 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 62595 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 62595 }, // U+200D
+    { 8, 25, 0, -1, 21, 50, 62595 }, // U+200E
+    { 8, 25, 0, -7, 21, 50, 62645 }, // U+200F
     { 9, 4, 9, 0, 10, 9, 62695 }, // ‐
     { 9, 4, 9, 0, 10, 9, 62704 }, // ‑
     { 15, 4, 16, 1, 12, 15, 62713 }, // ‒
@@ -5300,13 +5300,13 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 14, 6, 17, 0, 5, 21, 63308 }, // ‥
     { 22, 6, 24, 0, 5, 33, 63329 }, // …
     { 6, 6, 9, 2, 11, 9, 63362 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 63371 }, //  
-    { 0, 0, 18, 0, 0, 0, 63371 }, //  
-    { 8, 22, 0, -1, 18, 44, 63371 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 63415 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 63459 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 63509 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 63559 }, // ‮
+    { 0, 0, 18, 0, 0, 0, 63371 }, // U+2028
+    { 0, 0, 18, 0, 0, 0, 63371 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 63371 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 63415 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 63459 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 63509 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 63559 }, // U+202E
     { 0, 0, 5, 0, 0, 0, 63609 }, //  
     { 34, 23, 36, 1, 22, 196, 63609 }, // ‰
     { 45, 23, 46, 1, 22, 259, 63805 }, // ‱
@@ -5356,21 +5356,21 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 6, 24, 8, 1, 23, 36, 67294 }, // ⁝
     { 5, 23, 8, 2, 22, 29, 67330 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 67359 }, //  
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 67359 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 67359 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 67409 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 67459 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 67509 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 67559 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 67609 }, // ⁯
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2060
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2061
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2062
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2063
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2064
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2066
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2067
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2068
+    { 0, 0, 18, 0, 0, 0, 67359 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 67359 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 67409 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 67459 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 67509 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 67559 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 67609 }, // U+206F
     { 11, 14, 11, 2, 25, 39, 67659 }, // ⁰
     { 6, 14, 7, 2, 22, 21, 67698 }, // ⁱ
     { 12, 13, 11, 1, 25, 39, 67719 }, // ⁴
@@ -3919,8 +3919,8 @@ static const uint8_t notosans_14_regularBitmaps[62507] = {
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 8, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 4, 22, 8, 2, 21, 22, 0 }, // !
     { 9, 8, 12, 1, 21, 18, 22 }, // "
@@ -4029,7 +4029,7 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 9, 11, 10, 0, 22, 25, 7065 }, // ª
     { 13, 13, 15, 1, 14, 43, 7090 }, // «
     { 15, 9, 17, 1, 12, 34, 7133 }, // ¬
-    { 8, 3, 9, 1, 9, 6, 7167 }, // ­
+    { 8, 3, 9, 1, 9, 6, 7167 }, // U+00AD
     { 22, 23, 24, 1, 22, 127, 7173 }, // ®
     { 16, 3, 15, -1, 25, 12, 7300 }, // ¯
     { 10, 10, 12, 1, 22, 25, 7312 }, // °
@@ -4619,11 +4619,11 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 53326 }, //  
     { 0, 0, 5, 0, 0, 0, 53326 }, //  
     { 0, 0, 3, 0, 0, 0, 53326 }, //  
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ​
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 53326 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 53326 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 53376 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 53326 }, // U+200D
+    { 8, 25, 0, -1, 21, 50, 53326 }, // U+200E
+    { 8, 25, 0, -7, 21, 50, 53376 }, // U+200F
     { 8, 3, 9, 1, 9, 6, 53426 }, // ‐
     { 8, 3, 9, 1, 9, 6, 53432 }, // ‑
     { 15, 3, 17, 1, 12, 12, 53438 }, // ‒
@@ -4648,13 +4648,13 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 12, 5, 16, 2, 4, 15, 53929 }, // ‥
     { 19, 5, 23, 2, 4, 24, 53944 }, // …
     { 4, 5, 8, 2, 10, 5, 53968 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 53973 }, //  
-    { 0, 0, 18, 0, 0, 0, 53973 }, //  
-    { 8, 22, 0, -1, 18, 44, 53973 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 54017 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 54061 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 54111 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 54161 }, // ‮
+    { 0, 0, 18, 0, 0, 0, 53973 }, // U+2028
+    { 0, 0, 18, 0, 0, 0, 53973 }, // U+2029
+    { 8, 22, 0, -1, 18, 44, 53973 }, // U+202A
+    { 8, 22, 0, -7, 18, 44, 54017 }, // U+202B
+    { 8, 25, 0, -4, 21, 50, 54061 }, // U+202C
+    { 8, 25, 0, -4, 21, 50, 54111 }, // U+202D
+    { 8, 25, 0, -4, 21, 50, 54161 }, // U+202E
     { 0, 0, 5, 0, 0, 0, 54211 }, //  
     { 32, 23, 34, 1, 22, 184, 54211 }, // ‰
     { 43, 23, 45, 1, 22, 248, 54395 }, // ‱
@@ -4704,21 +4704,21 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 4, 22, 8, 2, 21, 22, 57454 }, // ⁝
     { 4, 23, 8, 2, 22, 23, 57476 }, // ⁞
     { 0, 0, 6, 0, 0, 0, 57499 }, //  
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 57499 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 57499 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 57499 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 57549 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 57599 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 57649 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 57699 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 57749 }, // ⁯
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2060
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2061
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2062
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2063
+    { 0, 0, 18, 0, 0, 0, 57499 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 57499 }, // U+2069
+    { 8, 25, 0, -4, 21, 50, 57499 }, // U+206A
+    { 8, 25, 0, -4, 21, 50, 57549 }, // U+206B
+    { 8, 25, 0, -4, 21, 50, 57599 }, // U+206C
+    { 8, 25, 0, -4, 21, 50, 57649 }, // U+206D
+    { 8, 25, 0, -4, 21, 50, 57699 }, // U+206E
+    { 8, 25, 0, -4, 21, 50, 57749 }, // U+206F
     { 10, 14, 10, 0, 25, 35, 57799 }, // ⁰
     { 3, 14, 5, 1, 22, 11, 57834 }, // ⁱ
     { 10, 13, 10, 0, 25, 33, 57845 }, // ⁴
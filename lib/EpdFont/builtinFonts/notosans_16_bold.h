@@ -5561,8 +5561,8 @@ static const uint8_t notosans_16_boldBitmaps[88779] = {
 };
 
 static const EpdGlyph notosans_16_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 9, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 7, 25, 9, 1, 24, 44, 0 }, // !
     { 12, 9, 16, 2, 24, 27, 44 }, // "
@@ -5671,7 +5671,7 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 12, 13, 13, 0, 25, 39, 9829 }, // ª
     { 19, 16, 20, 1, 17, 76, 9868 }, // «
     { 17, 10, 19, 1, 14, 43, 9944 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 9987 }, // ­
+    { 10, 5, 11, 0, 11, 13, 9987 }, // U+00AD
     { 26, 26, 28, 1, 25, 169, 10000 }, // ®
     { 18, 4, 17, -1, 29, 18, 10169 }, // ¯
     { 12, 13, 14, 1, 25, 39, 10187 }, // °
@@ -6261,11 +6261,11 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 76009 }, //  
     { 0, 0, 6, 0, 0, 0, 76009 }, //  
     { 0, 0, 3, 0, 0, 0, 76009 }, //  
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ​
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 76009 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 76009 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 76072 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 76009 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 76009 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 76009 }, // U+200D
+    { 9, 28, 0, -1, 23, 63, 76009 }, // U+200E
+    { 9, 28, 0, -8, 23, 63, 76072 }, // U+200F
     { 10, 5, 11, 0, 11, 13, 76135 }, // ‐
     { 10, 5, 11, 0, 11, 13, 76148 }, // ‑
     { 17, 5, 19, 1, 14, 22, 76161 }, // ‒
@@ -6290,13 +6290,13 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 17, 7, 19, 1, 6, 30, 76881 }, // ‥
     { 26, 7, 29, 1, 6, 46, 76911 }, // …
     { 7, 7, 9, 1, 12, 13, 76957 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 76970 }, //  
-    { 0, 0, 20, 0, 0, 0, 76970 }, //  
-    { 9, 26, 0, -1, 21, 59, 76970 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 77029 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 77088 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 77144 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 77200 }, // ‮
+    { 0, 0, 20, 0, 0, 0, 76970 }, // U+2028
+    { 0, 0, 20, 0, 0, 0, 76970 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 76970 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 77029 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 77088 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 77144 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 77200 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 77256 }, //  
     { 41, 26, 43, 1, 25, 267, 77256 }, // ‰
     { 55, 26, 56, 0, 25, 358, 77523 }, // ‱
@@ -6346,21 +6346,21 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 7, 27, 9, 1, 26, 48, 81858 }, // ⁝
     { 7, 26, 10, 1, 25, 46, 81906 }, // ⁞
     { 0, 0, 7, 0, 0, 0, 81952 }, //  
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 81952 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 81952 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 81952 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 82008 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 82064 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 82120 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 82178 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 82234 }, // ⁯
+    { 0, 0, 20, 0, 0, 0, 81952 }, // U+2060
+    { 0, 0, 20, 0, 0, 0, 81952 }, // U+2061
+    { 0, 0, 20, 0, 0, 0, 81952 }, // U+2062
+    { 0, 0, 20, 0, 0, 0, 81952 }, // U+2063
+    { 0, 0, 20, 0, 0, 0, 81952 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 81952 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 81952 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 81952 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 81952 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 81952 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 82008 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 82064 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 82120 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 82178 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 82234 }, // U+206F
     { 12, 16, 13, 0, 29, 48, 82290 }, // ⁰
     { 5, 16, 6, 1, 25, 20, 82338 }, // ⁱ
     { 13, 16, 13, 0, 29, 52, 82358 }, // ⁴
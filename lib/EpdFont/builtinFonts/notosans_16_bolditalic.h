@@ -5913,8 +5913,8 @@ static const uint8_t notosans_16_bolditalicBitmaps[94410] = {
 };
 
 static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 9, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 11, 25, 10, 0, 24, 69, 0 }, // !
     { 13, 9, 15, 3, 24, 30, 69 }, // "
@@ -6023,7 +6023,7 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 13, 13, 13, 2, 25, 43, 10842 }, // ª
     { 18, 16, 19, 1, 17, 72, 10885 }, // «
     { 17, 10, 19, 1, 14, 43, 10957 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 11000 }, // ­
+    { 10, 5, 11, 0, 11, 13, 11000 }, // U+00AD
     { 26, 26, 28, 1, 25, 169, 11013 }, // ®
     { 16, 4, 14, 3, 29, 16, 11182 }, // ¯
     { 12, 13, 14, 1, 25, 39, 11198 }, // °
@@ -6613,11 +6613,11 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 81168 }, //  
     { 0, 0, 6, 0, 0, 0, 81168 }, //  
     { 0, 0, 3, 0, 0, 0, 81168 }, //  
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ​
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 81168 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 81168 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 81231 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 81168 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 81168 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 81168 }, // U+200D
+    { 9, 28, 0, -1, 23, 63, 81168 }, // U+200E
+    { 9, 28, 0, -8, 23, 63, 81231 }, // U+200F
     { 10, 5, 11, 0, 11, 13, 81294 }, // ‐
     { 10, 5, 11, 0, 11, 13, 81307 }, // ‑
     { 17, 5, 18, 1, 14, 22, 81320 }, // ‒
@@ -6642,13 +6642,13 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 16, 7, 19, 0, 6, 28, 82069 }, // ‥
     { 25, 7, 28, 0, 6, 44, 82097 }, // …
     { 7, 7, 11, 2, 13, 13, 82141 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 82154 }, //  
-    { 0, 0, 20, 0, 0, 0, 82154 }, //  
-    { 9, 26, 0, -1, 21, 59, 82154 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 82213 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 82272 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 82328 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 82384 }, // ‮
+    { 0, 0, 20, 0, 0, 0, 82154 }, // U+2028
+    { 0, 0, 20, 0, 0, 0, 82154 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 82154 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 82213 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 82272 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 82328 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 82384 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 82440 }, //  
     { 39, 26, 41, 1, 25, 254, 82440 }, // ‰
     { 51, 26, 53, 1, 25, 332, 82694 }, // ‱
@@ -6698,21 +6698,21 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 7, 27, 9, 1, 26, 48, 87179 }, // ⁝
     { 6, 26, 10, 2, 25, 39, 87227 }, // ⁞
     { 0, 0, 7, 0, 0, 0, 87266 }, //  
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 87266 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 87266 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 87322 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 87378 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 87434 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 87492 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 87548 }, // ⁯
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2060
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2061
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2062
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2063
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2064
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2066
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2067
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2068
+    { 0, 0, 20, 0, 0, 0, 87266 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 87266 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 87322 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 87378 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 87434 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 87492 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 87548 }, // U+206F
     { 12, 16, 13, 3, 29, 48, 87604 }, // ⁰
     { 7, 16, 8, 2, 25, 28, 87652 }, // ⁱ
     { 14, 16, 13, 1, 29, 56, 87680 }, // ⁴
@@ -5373,8 +5373,8 @@ static const uint8_t notosans_16_italicBitmaps[85772] = {
 };
 
 static const EpdGlyph notosans_16_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 9, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 10, 25, 9, 0, 24, 63, 0 }, // !
     { 11, 9, 13, 3, 24, 25, 63 }, // "
@@ -5483,7 +5483,7 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 11, 13, 11, 2, 25, 36, 9947 }, // ª
     { 15, 15, 16, 1, 16, 57, 9983 }, // «
     { 16, 9, 19, 2, 13, 36, 10040 }, // ¬
-    { 10, 4, 10, 0, 11, 10, 10076 }, // ­
+    { 10, 4, 10, 0, 11, 10, 10076 }, // U+00AD
     { 26, 26, 28, 1, 25, 169, 10086 }, // ®
     { 15, 3, 13, 3, 28, 12, 10255 }, // ¯
     { 12, 12, 14, 1, 25, 36, 10267 }, // °
@@ -6073,11 +6073,11 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 73597 }, //  
     { 0, 0, 6, 0, 0, 0, 73597 }, //  
     { 0, 0, 3, 0, 0, 0, 73597 }, //  
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ​
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 73597 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 73597 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 73660 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 73597 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 73597 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 73597 }, // U+200D
+    { 9, 28, 0, -1, 23, 63, 73597 }, // U+200E
+    { 9, 28, 0, -8, 23, 63, 73660 }, // U+200F
     { 10, 4, 10, 0, 11, 10, 73723 }, // ‐
     { 10, 4, 10, 0, 11, 10, 73733 }, // ‑
     { 17, 4, 18, 1, 14, 17, 73743 }, // ‒
@@ -6102,13 +6102,13 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 14, 6, 17, 0, 5, 21, 74378 }, // ‥
     { 22, 6, 26, 0, 5, 33, 74399 }, // …
     { 5, 6, 9, 2, 12, 8, 74432 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 74440 }, //  
-    { 0, 0, 20, 0, 0, 0, 74440 }, //  
-    { 9, 26, 0, -1, 21, 59, 74440 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 74499 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 74558 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 74614 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 74670 }, // ‮
+    { 0, 0, 20, 0, 0, 0, 74440 }, // U+2028
+    { 0, 0, 20, 0, 0, 0, 74440 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 74440 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 74499 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 74558 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 74614 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 74670 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 74726 }, //  
     { 35, 26, 38, 2, 25, 228, 74726 }, // ‰
     { 45, 26, 48, 2, 25, 293, 74954 }, // ‱
@@ -6158,21 +6158,21 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 5, 25, 9, 2, 24, 32, 79033 }, // ⁝
     { 5, 26, 9, 3, 25, 33, 79065 }, // ⁞
     { 0, 0, 7, 0, 0, 0, 79098 }, //  
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 79098 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 79098 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 79154 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 79210 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 79266 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 79324 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 79380 }, // ⁯
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2060
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2061
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2062
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2063
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2064
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2066
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2067
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2068
+    { 0, 0, 20, 0, 0, 0, 79098 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 79098 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 79154 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 79210 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 79266 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 79324 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 79380 }, // U+206F
     { 11, 16, 12, 3, 29, 44, 79436 }, // ⁰
     { 6, 16, 7, 2, 25, 24, 79480 }, // ⁱ
     { 12, 16, 12, 2, 29, 48, 79504 }, // ⁴
@@ -5024,8 +5024,8 @@ static const uint8_t notosans_16_regularBitmaps[80180] = {
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 9, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 5, 25, 9, 2, 24, 32, 0 }, // !
     { 10, 9, 14, 2, 24, 23, 32 }, // "
@@ -5134,7 +5134,7 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 10, 13, 12, 1, 25, 33, 9050 }, // ª
     { 15, 15, 17, 1, 16, 57, 9083 }, // «
     { 17, 9, 19, 1, 13, 39, 9140 }, // ¬
-    { 9, 4, 11, 1, 11, 9, 9179 }, // ­
+    { 9, 4, 11, 1, 11, 9, 9179 }, // U+00AD
     { 26, 26, 28, 1, 25, 169, 9188 }, // ®
     { 18, 3, 17, -1, 28, 14, 9357 }, // ¯
     { 12, 12, 14, 1, 25, 36, 9371 }, // °
@@ -5724,11 +5724,11 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 0, 0, 9, 0, 0, 0, 68456 }, //  
     { 0, 0, 6, 0, 0, 0, 68456 }, //  
     { 0, 0, 3, 0, 0, 0, 68456 }, //  
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ​
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 68456 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 68456 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 68519 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 68456 }, // U+200D
+    { 9, 28, 0, -1, 23, 63, 68456 }, // U+200E
+    { 9, 28, 0, -8, 23, 63, 68519 }, // U+200F
     { 9, 4, 11, 1, 11, 9, 68582 }, // ‐
     { 9, 4, 11, 1, 11, 9, 68591 }, // ‑
     { 17, 4, 19, 1, 14, 17, 68600 }, // ‒
@@ -5753,13 +5753,13 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 14, 6, 18, 2, 5, 21, 69212 }, // ‥
     { 22, 6, 26, 2, 5, 33, 69233 }, // …
     { 5, 6, 9, 2, 11, 8, 69266 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 69274 }, //  
-    { 0, 0, 20, 0, 0, 0, 69274 }, //  
-    { 9, 26, 0, -1, 21, 59, 69274 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 69333 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 69392 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 69448 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 69504 }, // ‮
+    { 0, 0, 20, 0, 0, 0, 69274 }, // U+2028
+    { 0, 0, 20, 0, 0, 0, 69274 }, // U+2029
+    { 9, 26, 0, -1, 21, 59, 69274 }, // U+202A
+    { 9, 26, 0, -8, 21, 59, 69333 }, // U+202B
+    { 8, 28, 0, -4, 23, 56, 69392 }, // U+202C
+    { 8, 28, 0, -4, 23, 56, 69448 }, // U+202D
+    { 8, 28, 0, -4, 23, 56, 69504 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 69560 }, //  
     { 37, 26, 39, 1, 25, 241, 69560 }, // ‰
     { 49, 26, 51, 1, 25, 319, 69801 }, // ‱
@@ -5809,21 +5809,21 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 5, 25, 9, 2, 24, 32, 73711 }, // ⁝
     { 5, 26, 9, 2, 25, 33, 73743 }, // ⁞
     { 0, 0, 7, 0, 0, 0, 73776 }, //  
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 73776 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 73776 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 73776 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 73832 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 73888 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 73944 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 74002 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 74058 }, // ⁯
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2060
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2061
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2062
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2063
+    { 0, 0, 20, 0, 0, 0, 73776 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 73776 }, // U+2069
+    { 8, 28, 0, -4, 23, 56, 73776 }, // U+206A
+    { 8, 28, 0, -4, 23, 56, 73832 }, // U+206B
+    { 8, 28, 0, -4, 23, 56, 73888 }, // U+206C
+    { 8, 29, 0, -4, 24, 58, 73944 }, // U+206D
+    { 8, 28, 0, -4, 23, 56, 74002 }, // U+206E
+    { 8, 28, 0, -4, 23, 56, 74058 }, // U+206F
     { 11, 16, 12, 0, 29, 44, 74114 }, // ⁰
     { 3, 16, 6, 1, 25, 12, 74158 }, // ⁱ
     { 12, 16, 12, 0, 29, 48, 74170 }, // ⁴
@@ -6721,8 +6721,8 @@ static const uint8_t notosans_18_italicBitmaps[107329] = {
 };
 
 static const EpdGlyph notosans_18_italicGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 10, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 11, 28, 10, 0, 27, 77, 0 }, // !
     { 12, 10, 15, 4, 27, 30, 77 }, // "
@@ -6831,7 +6831,7 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 12, 14, 13, 3, 28, 42, 12390 }, // ª
     { 17, 16, 18, 1, 18, 68, 12432 }, // «
     { 19, 11, 21, 2, 15, 53, 12500 }, // ¬
-    { 11, 4, 12, 0, 12, 11, 12553 }, // ­
+    { 11, 4, 12, 0, 12, 11, 12553 }, // U+00AD
     { 29, 29, 31, 1, 28, 211, 12564 }, // ®
     { 17, 4, 15, 3, 32, 17, 12775 }, // ¯
     { 12, 13, 16, 2, 28, 39, 12792 }, // °
@@ -7421,11 +7421,11 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 92163 }, //  
     { 0, 0, 6, 0, 0, 0, 92163 }, //  
     { 0, 0, 4, 0, 0, 0, 92163 }, //  
-    { 0, 0, 0, 0, 0, 0, 92163 }, // ​
-    { 0, 0, 0, 0, 0, 0, 92163 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 92163 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 92163 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 92233 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 92163 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 92163 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 92163 }, // U+200D
+    { 9, 31, 0, -1, 26, 70, 92163 }, // U+200E
+    { 9, 31, 0, -8, 26, 70, 92233 }, // U+200F
     { 11, 4, 12, 0, 12, 11, 92303 }, // ‐
     { 11, 4, 12, 0, 12, 11, 92314 }, // ‑
     { 18, 3, 21, 2, 15, 14, 92325 }, // ‒
@@ -7450,13 +7450,13 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 15, 6, 19, 0, 5, 23, 93101 }, // ‥
     { 25, 6, 29, 0, 5, 38, 93124 }, // …
     { 6, 6, 10, 2, 13, 9, 93162 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 93171 }, //  
-    { 0, 0, 23, 0, 0, 0, 93171 }, //  
-    { 9, 28, 0, -1, 23, 63, 93171 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 93234 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 93297 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 93375 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 93453 }, // ‮
+    { 0, 0, 23, 0, 0, 0, 93171 }, // U+2028
+    { 0, 0, 23, 0, 0, 0, 93171 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 93171 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 93234 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 93297 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 93375 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 93453 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 93531 }, //  
     { 38, 29, 42, 3, 28, 276, 93531 }, // ‰
     { 50, 29, 54, 3, 28, 363, 93807 }, // ‱
@@ -7506,21 +7506,21 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 6, 28, 10, 2, 27, 42, 98907 }, // ⁝
     { 6, 29, 10, 3, 28, 44, 98949 }, // ⁞
     { 0, 0, 8, 0, 0, 0, 98993 }, //  
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁤
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁦
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁧
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁨
-    { 0, 0, 23, 0, 0, 0, 98993 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 98993 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 99071 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 99149 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 99227 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 99305 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 99383 }, // ⁯
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2060
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2061
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2062
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2063
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2064
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2066
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2067
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2068
+    { 0, 0, 23, 0, 0, 0, 98993 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 98993 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 99071 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 99149 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 99227 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 99305 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 99383 }, // U+206F
     { 13, 18, 13, 3, 33, 59, 99461 }, // ⁰
     { 6, 18, 8, 3, 28, 27, 99520 }, // ⁱ
     { 13, 17, 13, 2, 32, 56, 99547 }, // ⁴
@@ -6301,8 +6301,8 @@ static const uint8_t notosans_18_regularBitmaps[100620] = {
 };
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 10, 0, 0, 0, 0 }, // U+000D
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 6, 28, 10, 2, 27, 42, 0 }, // !
     { 11, 10, 15, 2, 27, 28, 42 }, // "
@@ -6411,7 +6411,7 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 11, 14, 13, 1, 28, 39, 11313 }, // ª
     { 17, 16, 19, 1, 18, 68, 11352 }, // «
     { 19, 11, 21, 1, 15, 53, 11420 }, // ¬
-    { 10, 4, 12, 1, 12, 10, 11473 }, // ­
+    { 10, 4, 12, 1, 12, 10, 11473 }, // U+00AD
     { 29, 29, 31, 1, 28, 211, 11483 }, // ®
     { 20, 3, 19, -1, 31, 15, 11694 }, // ¯
     { 12, 13, 16, 2, 28, 39, 11709 }, // °
@@ -7001,11 +7001,11 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 0, 0, 10, 0, 0, 0, 85910 }, //  
     { 0, 0, 6, 0, 0, 0, 85910 }, //  
     { 0, 0, 4, 0, 0, 0, 85910 }, //  
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ​
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 85910 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 85910 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 85980 }, // ‏
+    { 0, 0, 0, 0, 0, 0, 85910 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 85910 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 85910 }, // U+200D
+    { 9, 31, 0, -1, 26, 70, 85910 }, // U+200E
+    { 9, 31, 0, -8, 26, 70, 85980 }, // U+200F
     { 10, 4, 12, 1, 12, 10, 86050 }, // ‐
     { 10, 4, 12, 1, 12, 10, 86060 }, // ‑
     { 19, 3, 21, 1, 15, 15, 86070 }, // ‒
@@ -7030,13 +7030,13 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 16, 6, 20, 2, 5, 24, 86819 }, // ‥
     { 25, 6, 30, 2, 5, 38, 86843 }, // …
     { 6, 6, 10, 2, 12, 9, 86881 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 86890 }, //  
-    { 0, 0, 23, 0, 0, 0, 86890 }, //  
-    { 9, 28, 0, -1, 23, 63, 86890 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 86953 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 87016 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 87094 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 87172 }, // ‮
+    { 0, 0, 23, 0, 0, 0, 86890 }, // U+2028
+    { 0, 0, 23, 0, 0, 0, 86890 }, // U+2029
+    { 9, 28, 0, -1, 23, 63, 86890 }, // U+202A
+    { 9, 28, 0, -8, 23, 63, 86953 }, // U+202B
+    { 10, 31, 0, -5, 26, 78, 87016 }, // U+202C
+    { 10, 31, 0, -5, 26, 78, 87094 }, // U+202D
+    { 10, 31, 0, -5, 26, 78, 87172 }, // U+202E
     { 0, 0, 6, 0, 0, 0, 87250 }, //  
     { 42, 29, 44, 1, 28, 305, 87250 }, // ‰
     { 56, 29, 58, 1, 28, 406, 87555 }, // ‱
@@ -7086,21 +7086,21 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 6, 28, 10, 2, 27, 42, 92494 }, // ⁝
     { 6, 29, 10, 2, 28, 44, 92536 }, // ⁞
     { 0, 0, 8, 0, 0, 0, 92580 }, //  
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 92580 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 92580 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 92580 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 92658 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 92736 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 92814 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 92892 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 92970 }, // ⁯
+    { 0, 0, 23, 0, 0, 0, 92580 }, // U+2060
+    { 0, 0, 23, 0, 0, 0, 92580 }, // U+2061
+    { 0, 0, 23, 0, 0, 0, 92580 }, // U+2062
+    { 0, 0, 23, 0, 0, 0, 92580 }, // U+2063
+    { 0, 0, 23, 0, 0, 0, 92580 }, // U+2064
+    { 0, 0, 0, 0, 0, 0, 92580 }, // U+2066
+    { 0, 0, 0, 0, 0, 0, 92580 }, // U+2067
+    { 0, 0, 0, 0, 0, 0, 92580 }, // U+2068
+    { 0, 0, 0, 0, 0, 0, 92580 }, // U+2069
+    { 10, 31, 0, -5, 26, 78, 92580 }, // U+206A
+    { 10, 31, 0, -5, 26, 78, 92658 }, // U+206B
+    { 10, 31, 0, -5, 26, 78, 92736 }, // U+206C
+    { 10, 31, 0, -5, 26, 78, 92814 }, // U+206D
+    { 10, 31, 0, -5, 26, 78, 92892 }, // U+206E
+    { 10, 31, 0, -5, 26, 78, 92970 }, // U+206F
     { 13, 17, 13, 0, 32, 56, 93048 }, // ⁰
     { 4, 18, 6, 1, 28, 18, 93104 }, // ⁱ
     { 13, 17, 13, 0, 32, 56, 93122 }, // ⁴
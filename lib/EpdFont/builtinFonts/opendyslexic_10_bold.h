@@ -2828,7 +2828,7 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 7, 7, 14, 4, 16, 13, 5645 }, // ª
     { 12, 12, 11, 0, 12, 36, 5658 }, // «
     { 11, 8, 13, 1, 8, 22, 5694 }, // ¬
-    { 11, 3, 13, 1, 8, 9, 5716 }, // ­
+    { 11, 3, 13, 1, 8, 9, 5716 }, // U+00AD
     { 10, 9, 14, 2, 23, 23, 5725 }, // ®
     { 10, 4, 11, 0, 16, 10, 5748 }, // ¯
     { 10, 10, 14, 2, 16, 25, 5758 }, // °
@@ -3322,11 +3322,11 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 37499 }, //  
     { 0, 0, 8, 0, 0, 0, 37499 }, //  
     { 0, 0, 6, 0, 0, 0, 37499 }, //  
-    { 0, 0, 3, 0, 0, 0, 37499 }, // ​
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 37499 }, // ‏
+    { 0, 0, 3, 0, 0, 0, 37499 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 37499 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 37499 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 37499 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 37499 }, // U+200F
     { 11, 3, 11, 0, 8, 9, 37499 }, // ‐
     { 11, 3, 11, 0, 8, 9, 37508 }, // ‑
     { 17, 3, 11, -3, 8, 13, 37517 }, // ‒
@@ -2966,7 +2966,7 @@ static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 8, 8, 9, 3, 16, 16, 6164 }, // ª
     { 14, 10, 17, 2, 10, 35, 6180 }, // «
     { 10, 6, 13, 3, 7, 15, 6215 }, // ¬
-    { 10, 3, 11, 3, 8, 8, 6230 }, // ­
+    { 10, 3, 11, 3, 8, 8, 6230 }, // U+00AD
     { 10, 8, 11, 5, 22, 20, 6238 }, // ®
     { 8, 3, 11, 5, 15, 6, 6258 }, // ¯
     { 11, 10, 11, 3, 17, 28, 6264 }, // °
@@ -3460,11 +3460,11 @@ static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 39818 }, //  
     { 0, 0, 11, 0, 0, 0, 39818 }, //  
     { 0, 0, 10, 0, 0, 0, 39818 }, //  
-    { 0, 0, 7, 0, 0, 0, 39818 }, // ​
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 39818 }, // ‏
+    { 0, 0, 7, 0, 0, 0, 39818 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 39818 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 39818 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 39818 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 39818 }, // U+200F
     { 10, 3, 11, 3, 8, 8, 39818 }, // ‐
     { 10, 3, 11, 3, 8, 8, 39826 }, // ‑
     { 16, 3, 16, 3, 8, 12, 39834 }, // ‒
@@ -2498,7 +2498,7 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 7, 8, 9, 2, 16, 14, 5002 }, // ª
     { 11, 10, 13, 1, 10, 28, 5016 }, // «
     { 11, 6, 13, 1, 7, 17, 5044 }, // ¬
-    { 10, 3, 11, 1, 8, 8, 5061 }, // ­
+    { 10, 3, 11, 1, 8, 8, 5061 }, // U+00AD
     { 9, 8, 11, 1, 22, 18, 5069 }, // ®
     { 9, 3, 11, 1, 15, 7, 5087 }, // ¯
     { 10, 10, 11, 1, 17, 25, 5094 }, // °
@@ -2992,11 +2992,11 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 0, 0, 5, 0, 0, 0, 33183 }, //  
     { 0, 0, 11, 0, 0, 0, 33183 }, //  
     { 0, 0, 10, 0, 0, 0, 33183 }, //  
-    { 0, 0, 7, 0, 0, 0, 33183 }, // ​
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 33183 }, // ‏
+    { 0, 0, 7, 0, 0, 0, 33183 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 33183 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 33183 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 33183 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 33183 }, // U+200F
     { 10, 3, 11, 1, 8, 8, 33183 }, // ‐
     { 10, 3, 11, 1, 8, 8, 33191 }, // ‑
     { 15, 3, 16, 1, 8, 12, 33199 }, // ‒
@@ -5359,7 +5359,7 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 10, 10, 19, 6, 22, 25, 10814 }, // ª
     { 16, 16, 16, 0, 15, 64, 10839 }, // «
     { 16, 11, 18, 1, 11, 44, 10903 }, // ¬
-    { 16, 4, 18, 1, 11, 16, 10947 }, // ­
+    { 16, 4, 18, 1, 11, 16, 10947 }, // U+00AD
     { 14, 13, 20, 3, 32, 46, 10963 }, // ®
     { 13, 5, 15, 1, 22, 17, 11009 }, // ¯
     { 14, 13, 20, 3, 22, 46, 11026 }, // °
@@ -5853,11 +5853,11 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 72722 }, //  
     { 0, 0, 11, 0, 0, 0, 72722 }, //  
     { 0, 0, 9, 0, 0, 0, 72722 }, //  
-    { 0, 0, 5, 0, 0, 0, 72722 }, // ​
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 72722 }, // ‏
+    { 0, 0, 5, 0, 0, 0, 72722 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 72722 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 72722 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 72722 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 72722 }, // U+200F
     { 16, 4, 16, 0, 11, 16, 72722 }, // ‐
     { 16, 4, 16, 0, 11, 16, 72738 }, // ‑
     { 24, 4, 16, -4, 11, 24, 72754 }, // ‒
@@ -4557,7 +4557,7 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 10, 10, 12, 2, 22, 25, 9315 }, // ª
     { 15, 14, 19, 2, 14, 53, 9340 }, // «
     { 14, 9, 18, 2, 10, 32, 9393 }, // ¬
-    { 14, 3, 16, 2, 10, 11, 9425 }, // ­
+    { 14, 3, 16, 2, 10, 11, 9425 }, // U+00AD
     { 12, 11, 16, 2, 31, 33, 9436 }, // ®
     { 11, 3, 15, 2, 21, 9, 9469 }, // ¯
     { 14, 14, 16, 1, 23, 49, 9478 }, // °
@@ -5051,11 +5051,11 @@ static const EpdGlyph opendyslexic_14_regularGlyphs[] = {
     { 0, 0, 8, 0, 0, 0, 61903 }, //  
     { 0, 0, 15, 0, 0, 0, 61903 }, //  
     { 0, 0, 14, 0, 0, 0, 61903 }, //  
-    { 0, 0, 9, 0, 0, 0, 61903 }, // ​
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 61903 }, // ‏
+    { 0, 0, 9, 0, 0, 0, 61903 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 61903 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 61903 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 61903 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 61903 }, // U+200F
     { 14, 3, 16, 2, 10, 11, 61903 }, // ‐
     { 14, 3, 16, 2, 10, 11, 61914 }, // ‑
     { 20, 3, 22, 2, 10, 15, 61925 }, // ‒
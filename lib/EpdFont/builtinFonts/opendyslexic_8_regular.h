@@ -1682,7 +1682,7 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 6, 6, 7, 1, 13, 9, 3316 }, // ª
     { 9, 8, 11, 1, 8, 18, 3325 }, // «
     { 8, 5, 10, 1, 6, 10, 3343 }, // ¬
-    { 8, 2, 9, 1, 6, 4, 3353 }, // ­
+    { 8, 2, 9, 1, 6, 4, 3353 }, // U+00AD
     { 7, 7, 9, 1, 18, 13, 3357 }, // ®
     { 7, 3, 9, 1, 13, 6, 3370 }, // ¯
     { 9, 8, 9, 0, 14, 18, 3376 }, // °
@@ -2176,11 +2176,11 @@ static const EpdGlyph opendyslexic_8_regularGlyphs[] = {
     { 0, 0, 4, 0, 0, 0, 21728 }, //  
     { 0, 0, 9, 0, 0, 0, 21728 }, //  
     { 0, 0, 8, 0, 0, 0, 21728 }, //  
-    { 0, 0, 5, 0, 0, 0, 21728 }, // ​
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 21728 }, // ‏
+    { 0, 0, 5, 0, 0, 0, 21728 }, // U+200B
+    { 0, 0, 0, 0, 0, 0, 21728 }, // U+200C
+    { 0, 0, 0, 0, 0, 0, 21728 }, // U+200D
+    { 0, 0, 0, 0, 0, 0, 21728 }, // U+200E
+    { 0, 0, 0, 0, 0, 0, 21728 }, // U+200F
     { 8, 2, 9, 1, 6, 4, 21728 }, // ‐
     { 8, 2, 9, 1, 6, 4, 21732 }, // ‑
     { 12, 2, 12, 1, 6, 6, 21736 }, // ‒
@@ -793,11 +793,11 @@ static const uint8_t ubuntu_10_regularBitmaps[12484] = {
 };
 
 static const EpdGlyph ubuntu_10_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 5, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 15, 6, 1, 15, 8, 0 }, // !
     { 7, 5, 9, 1, 16, 5, 8 }, // "
@@ -906,7 +906,7 @@ static const EpdGlyph ubuntu_10_regularGlyphs[] = {
     { 8, 8, 8, 0, 15, 8, 1797 }, // ª
     { 10, 9, 10, 0, 10, 12, 1805 }, // «
     { 10, 8, 12, 1, 9, 10, 1817 }, // ¬
-    { 6, 2, 6, 0, 7, 2, 1827 }, // ­
+    { 6, 2, 6, 0, 7, 2, 1827 }, // U+00AD
     { 15, 15, 17, 1, 15, 29, 1829 }, // ®
     { 7, 2, 8, 0, 15, 2, 1858 }, // ¯
     { 7, 6, 7, 0, 16, 6, 1860 }, // °
@@ -1189,11 +1189,11 @@ static const uint8_t ubuntu_12_boldBitmaps[18832] = {
 };
 
 static const EpdGlyph ubuntu_12_boldGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 17, 7, 1, 17, 11, 0 }, // !
     { 10, 7, 12, 1, 19, 9, 11 }, // "
@@ -1302,7 +1302,7 @@ static const EpdGlyph ubuntu_12_boldGlyphs[] = {
     { 10, 10, 10, 0, 18, 13, 2699 }, // ª
     { 15, 13, 15, 0, 14, 25, 2712 }, // «
     { 12, 9, 14, 1, 10, 14, 2737 }, // ¬
-    { 8, 3, 9, 0, 9, 3, 2751 }, // ­
+    { 8, 3, 9, 0, 9, 3, 2751 }, // U+00AD
     { 18, 18, 20, 1, 18, 41, 2754 }, // ®
     { 9, 3, 9, 0, 19, 4, 2795 }, // ¯
     { 9, 7, 9, 0, 19, 8, 2799 }, // °
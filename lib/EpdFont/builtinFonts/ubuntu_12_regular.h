@@ -1081,11 +1081,11 @@ static const uint8_t ubuntu_12_regularBitmaps[17102] = {
 };
 
 static const EpdGlyph ubuntu_12_regularGlyphs[] = {
-    { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
-    { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
-    { 0, 0, 0, 0, 0, 0, 0 }, // 
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0000
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+0008
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+0009
+    { 0, 0, 6, 0, 0, 0, 0 }, // U+000D
+    { 0, 0, 0, 0, 0, 0, 0 }, // U+001D
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 17, 7, 1, 17, 11, 0 }, // !
     { 8, 6, 10, 1, 20, 6, 11 }, // "
@@ -1194,7 +1194,7 @@ static const EpdGlyph ubuntu_12_regularGlyphs[] = {
     { 9, 9, 10, 0, 17, 11, 2429 }, // ª
     { 12, 11, 12, 0, 13, 17, 2440 }, // «
     { 12, 9, 14, 1, 10, 14, 2457 }, // ¬
-    { 7, 2, 7, 0, 8, 2, 2471 }, // ­
+    { 7, 2, 7, 0, 8, 2, 2471 }, // U+00AD
     { 18, 17, 20, 1, 17, 39, 2473 }, // ®
     { 8, 2, 9, 1, 18, 2, 2512 }, // ¯
     { 8, 7, 8, 0, 19, 7, 2514 }, // °
@@ -5,10 +5,20 @@ import sys
 import re
 import math
 import argparse
+import unicodedata
 from collections import namedtuple
 
 # Originally from https://github.com/vroland/epdiy
 
+def glyph_comment(code_point):
+    # Control and format characters (bidi overrides, zero width joiners, ...) would act on the source itself, and a
+    # backslash would continue the comment onto the next line
+    if code_point == 92:
+        return "<backslash>"
+    if unicodedata.category(chr(code_point)) in ("Cc", "Cf", "Zl", "Zp"):
+        return f"U+{code_point:04X}"
+    return chr(code_point)
+
 parser = argparse.ArgumentParser(description="Generate a header file from a font to be used with epdiy.")
 parser.add_argument("name", action="store", help="name of the font.")
 parser.add_argument("size", type=int, help="font size to use.")
@@ -288,7 +298,7 @@ print ("};\n");
 
 print(f"static const EpdGlyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
-    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
+    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {glyph_comment(g.code_point)}")
 print ("};\n");
 
 print(f"static const EpdUnicodeInterval {font_name}Intervals[] = {{")
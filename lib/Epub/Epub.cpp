@@ -4,13 +4,39 @@
 #include <HalStorage.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
+#include <PngToBmpConverter.h>
 #include <ZipFile.h>
 
+#include "Epub/BookCacheKey.h"
+#include "Epub/SectionLayoutCache.h"
 #include "Epub/parsers/ContainerParser.h"
 #include "Epub/parsers/ContentOpfParser.h"
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+Epub::Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
+  // create a cache key based on the file contents, so moved/renamed books and duplicate copies share a cache
+  cachePath = cacheDir + "/epub_" + std::to_string(BookCacheKey::get(cacheDir, this->filepath));
+  migrateLegacyCacheDir(cacheDir);
+}
+
+// Caches used to be keyed on a hash of the file path, adopt one of those rather than re-indexing the book
+void Epub::migrateLegacyCacheDir(const std::string& cacheDir) const {
+  const auto legacyPath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(filepath));
+  if (legacyPath == cachePath || !Storage.exists(legacyPath.c_str()) || Storage.exists(cachePath.c_str())) {
+    return;
+  }
+
+  auto legacyDir = Storage.open(legacyPath.c_str());
+  if (!legacyDir) {
+    return;
+  }
+  const bool success = legacyDir.rename(cachePath.c_str());
+  legacyDir.close();
+  LOG_DBG("EBP", "Migrated legacy cache %s -> %s: %s", legacyPath.c_str(), cachePath.c_str(),
+          success ? "ok" : "failed");
+}
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -256,7 +282,7 @@ void Epub::parseCssFiles() const {
 }
 
 // load in the meta data for the epub file
-bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
+bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss, const std::function<bool()>& shouldAbort) {
   LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
 
   // Initialize spine/TOC cache
@@ -284,6 +310,14 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     return false;
   }
 
+  const auto aborted = [&shouldAbort] {
+    if (shouldAbort && shouldAbort()) {
+      LOG_DBG("EBP", "Cache build aborted");
+      return true;
+    }
+    return false;
+  };
+
   // Cache doesn't exist or is invalid, build it
   LOG_DBG("EBP", "Cache not found, building spine/TOC cache");
   setupCacheDir();
@@ -312,6 +346,9 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     return false;
   }
   LOG_DBG("EBP", "OPF pass completed in %lu ms", millis() - opfStart);
+  if (aborted()) {
+    return false;
+  }
 
   // TOC Pass - try EPUB 3 nav first, fall back to NCX
   const uint32_t tocStart = millis();
@@ -344,6 +381,9 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss) {
     return false;
   }
   LOG_DBG("EBP", "TOC pass completed in %lu ms", millis() - tocStart);
+  if (aborted()) {
+    return false;
+  }
 
   // Close the cache files
   if (!bookMetadataCache->endWrite()) {
@@ -391,6 +431,7 @@ bool Epub::clearCache() const {
     return false;
   }
 
+  SectionLayoutCache::getInstance().invalidate();
   LOG_DBG("EPB", "Cache cleared successfully");
   return true;
 }
@@ -456,31 +497,34 @@ bool Epub::generateCoverBmp(bool cropped) const {
     return false;
   }
 
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating BMP from JPG cover image (%s mode)", cropped ? "cropped" : "fit");
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
+  const bool isJpg = coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
+                     coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg";
+  const bool isPng = coverImageHref.substr(coverImageHref.length() - 4) == ".png";
+  if (isJpg || isPng) {
+    LOG_DBG("EBP", "Generating BMP from %s cover image (%s mode)", isPng ? "PNG" : "JPG", cropped ? "cropped" : "fit");
+    const auto coverTempPath = getCachePath() + (isPng ? "/.cover.png" : "/.cover.jpg");
 
-    FsFile coverJpg;
-    if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
+    FsFile coverImage;
+    if (!Storage.openFileForWrite("EBP", coverTempPath, coverImage)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
+    readItemContentsToStream(coverImageHref, coverImage, 1024);
+    coverImage.close();
 
-    if (!Storage.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
+    if (!Storage.openFileForRead("EBP", coverTempPath, coverImage)) {
       return false;
     }
 
     FsFile coverBmp;
     if (!Storage.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverJpg.close();
+      coverImage.close();
       return false;
     }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp, cropped);
-    coverJpg.close();
+    const bool success = isPng ? PngToBmpConverter::pngFileToBmpStream(coverImage, coverBmp, cropped)
+                               : JpegToBmpConverter::jpegFileToBmpStream(coverImage, coverBmp, cropped);
+    coverImage.close();
     coverBmp.close();
-    Storage.remove(coverJpgTempPath.c_str());
+    Storage.remove(coverTempPath.c_str());
 
     if (!success) {
       LOG_ERR("EBP", "Failed to generate BMP from cover image");
@@ -513,41 +557,46 @@ bool Epub::generateThumbBmp(int height) const {
   if (coverImageHref.empty()) {
     LOG_DBG("EBP", "No known cover image for thumbnail");
   } else if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-             coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating thumb BMP from JPG cover image");
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
-
-    FsFile coverJpg;
-    if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
+             coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg" ||
+             coverImageHref.substr(coverImageHref.length() - 4) == ".png") {
+    const bool isPng = coverImageHref.substr(coverImageHref.length() - 4) == ".png";
+    LOG_DBG("EBP", "Generating thumb BMP from %s cover image", isPng ? "PNG" : "JPG");
+    const auto coverTempPath = getCachePath() + (isPng ? "/.cover.png" : "/.cover.jpg");
+
+    FsFile coverImage;
+    if (!Storage.openFileForWrite("EBP", coverTempPath, coverImage)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
+    readItemContentsToStream(coverImageHref, coverImage, 1024);
+    coverImage.close();
 
-    if (!Storage.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
+    if (!Storage.openFileForRead("EBP", coverTempPath, coverImage)) {
       return false;
     }
 
     FsFile thumbBmp;
     if (!Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp)) {
-      coverJpg.close();
+      coverImage.close();
       return false;
     }
     // Use smaller target size for Continue Reading card (half of screen: 240x400)
     // Generate 1-bit BMP for fast home screen rendering (no gray passes needed)
     int THUMB_TARGET_WIDTH = height * 0.6;
     int THUMB_TARGET_HEIGHT = height;
-    const bool success = JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(coverJpg, thumbBmp, THUMB_TARGET_WIDTH,
-                                                                             THUMB_TARGET_HEIGHT);
-    coverJpg.close();
+    const bool success =
+        isPng ? PngToBmpConverter::pngFileTo1BitBmpStreamWithSize(coverImage, thumbBmp, THUMB_TARGET_WIDTH,
+                                                                  THUMB_TARGET_HEIGHT)
+              : JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(coverImage, thumbBmp, THUMB_TARGET_WIDTH,
+                                                                    THUMB_TARGET_HEIGHT);
+    coverImage.close();
     thumbBmp.close();
-    Storage.remove(coverJpgTempPath.c_str());
+    Storage.remove(coverTempPath.c_str());
 
     if (!success) {
-      LOG_ERR("EBP", "Failed to generate thumb BMP from JPG cover image");
+      LOG_ERR("EBP", "Failed to generate thumb BMP from cover image");
       Storage.remove(getThumbBmpPath(height).c_str());
     }
-    LOG_DBG("EBP", "Generated thumb BMP from JPG cover image, success: %s", success ? "yes" : "no");
+    LOG_DBG("EBP", "Generated thumb BMP from cover image, success: %s", success ? "yes" : "no");
     return success;
   } else {
     LOG_ERR("EBP", "Cover image is not a supported format, skipping thumbnail");
@@ -0,0 +1,199 @@
+#include "BookCacheKey.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Fnv.h"
+
+namespace {
+constexpr uint8_t CACHE_KEYS_FILE_VERSION = 2;
+constexpr char CACHE_KEYS_FILE[] = "/cache_keys.bin";
+// Covers the 22 byte EOCD record plus the tail of the central directory, which lists every entry's CRC and size
+constexpr size_t TAIL_BYTES = 1024;
+constexpr size_t SAMPLE_BYTES = 512;
+constexpr int SAMPLE_COUNT = 4;
+static_assert(SAMPLE_BYTES <= TAIL_BYTES, "Samples are read into the tail buffer");
+// Oldest entries are dropped beyond this, a miss only costs a re-fingerprint
+constexpr size_t MAX_ENTRIES = 256;
+
+struct PathKeyEntry {
+  uint64_t pathHash;
+  uint32_t fileSize;
+  // FAT modification date and time, catches same-size overwrites made on a computer
+  uint32_t modified;
+  uint64_t key;
+};
+
+std::vector<PathKeyEntry> entries;
+std::string loadedCacheDir;
+
+uint64_t hashPath(const std::string& path) {
+  return fnv::update64(fnv::OFFSET_BASIS_64, reinterpret_cast<const uint8_t*>(path.data()), path.size());
+}
+
+void loadEntries(const std::string& cacheDir) {
+  if (loadedCacheDir == cacheDir) {
+    return;
+  }
+  loadedCacheDir = cacheDir;
+  entries.clear();
+
+  FsFile file;
+  if (!Storage.openFileForRead("BCK", cacheDir + CACHE_KEYS_FILE, file)) {
+    return;
+  }
+
+  uint8_t version;
+  serialization::readPod(file, version);
+  if (version != CACHE_KEYS_FILE_VERSION) {
+    LOG_ERR("BCK", "Deserialization failed: Unknown version %u", version);
+    file.close();
+    return;
+  }
+
+  uint16_t count;
+  serialization::readPod(file, count);
+  entries.reserve(count);
+  for (uint16_t i = 0; i < count; i++) {
+    PathKeyEntry entry;
+    serialization::readPod(file, entry.pathHash);
+    serialization::readPod(file, entry.fileSize);
+    serialization::readPod(file, entry.modified);
+    serialization::readPod(file, entry.key);
+    entries.push_back(entry);
+  }
+  file.close();
+}
+
+void saveEntries(const std::string& cacheDir) {
+  Storage.mkdir(cacheDir.c_str());
+
+  FsFile file;
+  if (!Storage.openFileForWrite("BCK", cacheDir + CACHE_KEYS_FILE, file)) {
+    return;
+  }
+
+  serialization::writePod(file, CACHE_KEYS_FILE_VERSION);
+  const uint16_t count = static_cast<uint16_t>(entries.size());
+  serialization::writePod(file, count);
+  for (const auto& entry : entries) {
+    serialization::writePod(file, entry.pathHash);
+    serialization::writePod(file, entry.fileSize);
+    serialization::writePod(file, entry.modified);
+    serialization::writePod(file, entry.key);
+  }
+  file.close();
+}
+
+uint32_t modifiedStamp(FsFile& file) {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  if (!file.getModifyDateTime(&date, &time)) {
+    return 0;
+  }
+  return static_cast<uint32_t>(date) << 16 | time;
+}
+
+// Hashes `length` bytes at `offset`. Fails unless all of them could be read, so a read error never leaves the key
+// depending on what was in the buffer.
+bool hashRange(FsFile& file, const uint32_t offset, uint8_t* buffer, const size_t length, uint64_t* hash) {
+  if (!file.seek(offset) || file.read(buffer, length) != static_cast<int>(length)) {
+    return false;
+  }
+  *hash = fnv::update64(*hash, buffer, length);
+  return true;
+}
+}  // namespace
+
+bool BookCacheKey::fingerprint(const std::string& filepath, uint64_t* key) {
+  FsFile file;
+  if (!Storage.openFileForRead("BCK", filepath, file)) {
+    return false;
+  }
+
+  const uint32_t fileSize = static_cast<uint32_t>(file.size());
+  uint64_t hash = fnv::update64(fnv::OFFSET_BASIS_64, reinterpret_cast<const uint8_t*>(&fileSize), sizeof(fileSize));
+
+  uint8_t buffer[TAIL_BYTES];
+  const size_t tailLen = std::min<size_t>(fileSize, TAIL_BYTES);
+  if (!hashRange(file, fileSize - tailLen, buffer, tailLen, &hash)) {
+    LOG_ERR("BCK", "Failed to read %s", filepath.c_str());
+    file.close();
+    return false;
+  }
+
+  // Sample blocks catch edits that keep the central directory tail intact
+  for (int i = 1; i <= SAMPLE_COUNT; i++) {
+    const uint32_t offset = static_cast<uint32_t>(static_cast<uint64_t>(fileSize) * i / (SAMPLE_COUNT + 1));
+    if (offset + SAMPLE_BYTES > fileSize) {
+      break;
+    }
+    if (!hashRange(file, offset, buffer, SAMPLE_BYTES, &hash)) {
+      LOG_ERR("BCK", "Failed to read %s", filepath.c_str());
+      file.close();
+      return false;
+    }
+  }
+
+  file.close();
+  *key = hash;
+  return true;
+}
+
+uint64_t BookCacheKey::get(const std::string& cacheDir, const std::string& filepath) {
+  loadEntries(cacheDir);
+  const uint64_t pathHash = hashPath(filepath);
+
+  FsFile file;
+  if (!Storage.openFileForRead("BCK", filepath, file)) {
+    return pathHash;
+  }
+  const uint32_t fileSize = static_cast<uint32_t>(file.size());
+  const uint32_t modified = modifiedStamp(file);
+  file.close();
+
+  auto it = std::find_if(entries.begin(), entries.end(),
+                         [&](const PathKeyEntry& entry) { return entry.pathHash == pathHash; });
+  if (it != entries.end() && it->fileSize == fileSize && it->modified == modified) {
+    return it->key;
+  }
+
+  const uint32_t start = millis();
+  uint64_t key;
+  if (!fingerprint(filepath, &key)) {
+    return pathHash;
+  }
+  LOG_DBG("BCK", "Fingerprinted %s in %lu ms", filepath.c_str(), millis() - start);
+
+  if (it != entries.end()) {
+    entries.erase(it);
+  }
+  if (entries.size() >= MAX_ENTRIES) {
+    entries.erase(entries.begin());
+  }
+  entries.push_back({pathHash, fileSize, modified, key});
+  saveEntries(cacheDir);
+  return key;
+}
+
+void BookCacheKey::forget(const std::string& cacheDir, const std::string& filepath) {
+  loadEntries(cacheDir);
+  const uint64_t pathHash = hashPath(filepath);
+  const auto it = std::find_if(entries.begin(), entries.end(),
+                               [&](const PathKeyEntry& entry) { return entry.pathHash == pathHash; });
+  if (it != entries.end()) {
+    entries.erase(it);
+    saveEntries(cacheDir);
+  }
+}
+
+bool BookCacheKey::isShared(const std::string& cacheDir, const std::string& filepath, const uint64_t key) {
+  loadEntries(cacheDir);
+  const uint64_t pathHash = hashPath(filepath);
+  return std::any_of(entries.begin(), entries.end(),
+                     [&](const PathKeyEntry& entry) { return entry.key == key && entry.pathHash != pathHash; });
+}
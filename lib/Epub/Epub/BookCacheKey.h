@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Content-based cache keys for books, so a cache survives renames and moves. Duplicate copies of a book share one
+// cache, and with it their reading progress.
+//
+// The fingerprint is the file size plus an FNV-1a hash of the ZIP tail (end-of-central-directory and the end of the
+// central directory) and a few evenly spaced sample blocks. Computing it costs a handful of small reads, so results
+// are memoised per path in <cacheDir>/cache_keys.bin and only recomputed when the file size or modification time
+// changes or the path is explicitly forgotten.
+class BookCacheKey {
+ public:
+  // Returns the key for `filepath`. Falls back to a hash of the path when the file can't be read.
+  static uint64_t get(const std::string& cacheDir, const std::string& filepath);
+
+  // Drop the memoised key for `filepath`, e.g. after the file was overwritten, renamed or moved
+  static void forget(const std::string& cacheDir, const std::string& filepath);
+
+  // Whether a path other than `filepath` is remembered with `key`, i.e. another copy of the book uses its cache
+  static bool isShared(const std::string& cacheDir, const std::string& filepath, uint64_t key);
+
+  // Compute the fingerprint directly, bypassing the path map
+  static bool fingerprint(const std::string& filepath, uint64_t* key);
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// FNV-1a, for the cache keys and fingerprints that only need to tell inputs apart
+namespace fnv {
+constexpr uint32_t OFFSET_BASIS_32 = 2166136261u;
+constexpr uint64_t OFFSET_BASIS_64 = 14695981039346656037ull;
+
+inline uint32_t update32(uint32_t hash, const void* data, const size_t len) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+inline uint64_t update64(uint64_t hash, const void* data, const size_t len) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+}  // namespace fnv
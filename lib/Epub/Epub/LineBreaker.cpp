@@ -0,0 +1,259 @@
+#include "LineBreaker.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+constexpr int32_t INFINITE_COST = std::numeric_limits<int32_t>::max();
+constexpr uint16_t NO_POSITION = UINT16_MAX;
+
+// Saturates below INFINITE_COST so a very ragged paragraph still has a reachable end
+int32_t addCost(const int32_t cost, const long long lineCost) {
+  const long long total = static_cast<long long>(cost) + lineCost;
+  return total >= INFINITE_COST ? INFINITE_COST - 1 : static_cast<int32_t>(total);
+}
+
+// Where a line starting with word `w` starts: word positions are followed by one position per hyphen point of the
+// word. The position after the last word comes last.
+size_t wordPosition(const std::vector<LineBreaker::Word>& words, const size_t endPosition, const size_t w) {
+  return w == words.size() ? endPosition : w + words[w].firstPoint;
+}
+}  // namespace
+
+// Positions are the places a line can start: the beginning of each word followed by each of its hyphen points, then
+// the end of the paragraph. The shortest path through them is found with a forward pass, each position trying every
+// line end that fits. Unless the paragraph ends there, the last position starts a line of words still to come, and the
+// line before it is an ordinary one.
+bool LineBreaker::findPaths(const std::vector<Word>& words, const std::vector<HyphenPoint>& points,
+                            const Params& params, const bool paragraphEnds, std::vector<int32_t>& cost,
+                            std::vector<uint16_t>& previous) {
+  const size_t wordCount = words.size();
+  const size_t positionCount = wordCount + points.size() + 1;
+  if (wordCount == 0 || positionCount > MAX_POSITIONS) {
+    return false;
+  }
+  const size_t endPosition = positionCount - 1;
+  const auto wordPosition = [&](const size_t w) { return ::wordPosition(words, endPosition, w); };
+
+  cost.assign(positionCount, INFINITE_COST);
+  previous.assign(positionCount, NO_POSITION);
+  cost[0] = 0;
+
+  for (size_t w = 0; w < wordCount; ++w) {
+    for (int k = -1; k < words[w].pointCount; ++k) {
+      const size_t from = wordPosition(w) + k + 1;
+      if (cost[from] == INFINITE_COST) {
+        continue;
+      }
+
+      const bool startsHyphenated = k >= 0 || (from == 0 && params.startsHyphenated);
+      const int lineWidth = from == 0 ? params.pageWidth - params.firstLineIndent : params.pageWidth;
+      bool relaxed = false;
+      const auto relax = [&](const size_t to, const int width, const bool endsHyphenated) {
+        long long lineCost = 0;
+        if (to != endPosition || !paragraphEnds) {
+          const long long slack = lineWidth - width;
+          lineCost = slack * slack;
+        }
+        if (endsHyphenated) {
+          lineCost += params.hyphenPenalty;
+          if (startsHyphenated) {
+            lineCost += params.consecutiveHyphenPenalty;
+          }
+        }
+        const int32_t total = addCost(cost[from], lineCost);
+        if (total < cost[to]) {
+          cost[to] = total;
+          previous[to] = static_cast<uint16_t>(from);
+        }
+        relaxed = true;
+      };
+
+      int width = k >= 0 ? points[words[w].firstPoint + k].suffixWidth : words[w].width;
+      if (width <= lineWidth) {
+        if (w + 1 == wordCount || !words[w + 1].continues) {
+          relax(wordPosition(w + 1), width, false);
+        }
+        for (size_t j = w + 1; j < wordCount; ++j) {
+          const int gap = words[j].continues ? 0 : params.spaceWidth;
+          for (int p = 0; p < words[j].pointCount; ++p) {
+            const int prefixWidth = width + gap + points[words[j].firstPoint + p].prefixWidth;
+            if (prefixWidth <= lineWidth) {
+              relax(wordPosition(j) + p + 1, prefixWidth, true);
+            }
+          }
+          width += gap + words[j].width;
+          if (width > lineWidth) {
+            break;
+          }
+          if (j + 1 == wordCount || !words[j + 1].continues) {
+            relax(wordPosition(j + 1), width, false);
+          }
+        }
+      }
+
+      // Nothing fits: give this fragment (or continuation group start) a line of its own at no extra cost, so one
+      // oversized word doesn't make the rest of the paragraph unreachable
+      if (!relaxed) {
+        const size_t to = wordPosition(w + 1);
+        if (cost[from] < cost[to]) {
+          cost[to] = cost[from];
+          previous[to] = static_cast<uint16_t>(from);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Follows the path back from `position` and returns the breaks along it, in order
+std::vector<LineBreaker::Break> LineBreaker::tracePath(const std::vector<Word>& words,
+                                                       const std::vector<uint16_t>& previous, const size_t position) {
+  const size_t wordCount = words.size();
+  const size_t endPosition = previous.size() - 1;
+  const auto wordPosition = [&](const size_t w) { return ::wordPosition(words, endPosition, w); };
+
+  std::vector<Break> breaks;
+  for (size_t at = position; at != 0; at = previous[at]) {
+    if (previous[at] == NO_POSITION) {
+      return {};
+    }
+    if (at == endPosition) {
+      breaks.push_back({static_cast<uint16_t>(wordCount), NO_POINT});
+      continue;
+    }
+    // Last word starting at or before this position
+    size_t low = 0, high = wordCount;
+    while (high - low > 1) {
+      const size_t mid = (low + high) / 2;
+      if (wordPosition(mid) <= at) {
+        low = mid;
+      } else {
+        high = mid;
+      }
+    }
+    const size_t pointOffset = at - wordPosition(low);
+    breaks.push_back({static_cast<uint16_t>(low),
+                      pointOffset == 0 ? NO_POINT : static_cast<uint16_t>(words[low].firstPoint + pointOffset - 1)});
+  }
+  std::reverse(breaks.begin(), breaks.end());
+  return breaks;
+}
+
+std::vector<LineBreaker::Break> LineBreaker::totalFit(const std::vector<Word>& words,
+                                                      const std::vector<HyphenPoint>& points, const Params& params) {
+  std::vector<int32_t> cost;
+  std::vector<uint16_t> previous;
+  if (!findPaths(words, points, params, true, cost, previous)) {
+    return {};
+  }
+  return tracePath(words, previous, previous.size() - 1);
+}
+
+// Words still to come can only extend lines that start at an active position: one whose line, holding every word from
+// there on, still has room. The final layout goes through one of them, so the breaks on the way to their last common
+// ancestor can't change anymore.
+std::vector<LineBreaker::Break> LineBreaker::stableBreaks(const std::vector<Word>& words,
+                                                          const std::vector<HyphenPoint>& points,
+                                                          const Params& params) {
+  std::vector<int32_t> cost;
+  std::vector<uint16_t> previous;
+  if (!findPaths(words, points, params, false, cost, previous)) {
+    return {};
+  }
+  const size_t wordCount = words.size();
+  const size_t endPosition = previous.size() - 1;
+
+  // Positions only ever come after their predecessors, so the common ancestor is found by stepping back from the
+  // later of the two
+  size_t common = endPosition;
+  const auto addActive = [&](size_t position) {
+    if (cost[position] == INFINITE_COST) {
+      return;
+    }
+    while (common != position) {
+      if (common > position) {
+        common = previous[common];
+      } else {
+        position = previous[position];
+      }
+    }
+  };
+  if (cost[endPosition] == INFINITE_COST) {
+    return {};
+  }
+
+  // Width of the words after word w, each with the gap before it
+  int rest = 0;
+  for (size_t w = wordCount; w-- > 0;) {
+    for (int k = -1; k < words[w].pointCount; ++k) {
+      const size_t from = ::wordPosition(words, endPosition, w) + k + 1;
+      const int lineWidth = from == 0 ? params.pageWidth - params.firstLineIndent : params.pageWidth;
+      const int width = (k >= 0 ? points[words[w].firstPoint + k].suffixWidth : words[w].width) + rest;
+      if (width <= lineWidth) {
+        addActive(from);
+      }
+    }
+    rest += (words[w].continues ? 0 : params.spaceWidth) + words[w].width;
+    if (rest > params.pageWidth) {
+      break;
+    }
+  }
+
+  // Keep the last line back even if it is final, the paragraph's words can't run out before it ends
+  if (common == endPosition) {
+    common = previous[endPosition];
+  }
+  if (common == 0 || common == NO_POSITION) {
+    return {};
+  }
+  return tracePath(words, previous, common);
+}
+
+std::vector<LineBreaker::Break> LineBreaker::greedy(const std::vector<Word>& words,
+                                                    const std::vector<HyphenPoint>& points, const Params& params) {
+  const size_t wordCount = words.size();
+  std::vector<Break> breaks;
+  size_t lineStart = 0;
+  uint16_t startPoint = NO_POINT;
+
+  while (lineStart < wordCount) {
+    const int lineWidth = breaks.empty() ? params.pageWidth - params.firstLineIndent : params.pageWidth;
+    int width = startPoint != NO_POINT ? points[startPoint].suffixWidth : words[lineStart].width;
+    Break lineEnd = {static_cast<uint16_t>(wordCount), NO_POINT};
+
+    // The first fragment always goes on the line, even if it overflows
+    for (size_t j = lineStart + 1; j < wordCount; ++j) {
+      const int gap = words[j].continues ? 0 : params.spaceWidth;
+      if (width + gap + words[j].width <= lineWidth) {
+        width += gap + words[j].width;
+        continue;
+      }
+
+      uint16_t chosen = NO_POINT;
+      for (int p = 0; p < words[j].pointCount; ++p) {
+        const uint16_t point = words[j].firstPoint + p;
+        if (width + gap + points[point].prefixWidth <= lineWidth &&
+            (chosen == NO_POINT || points[point].prefixWidth > points[chosen].prefixWidth)) {
+          chosen = point;
+        }
+      }
+
+      size_t end = j;
+      if (chosen == NO_POINT) {
+        // Don't break before a continuation word, move the whole group to the next line
+        while (end > lineStart + 1 && words[end].continues) {
+          --end;
+        }
+      }
+      lineEnd = {static_cast<uint16_t>(end), chosen};
+      break;
+    }
+
+    breaks.push_back(lineEnd);
+    lineStart = lineEnd.wordIndex;
+    startPoint = lineEnd.pointIndex;
+  }
+
+  return breaks;
+}
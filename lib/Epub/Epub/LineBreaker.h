@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Line breaking over pre-measured words. Independent of GfxRenderer so the algorithms can be benchmarked on the host
+// (test/line_breaking_bench).
+class LineBreaker {
+ public:
+  // A legal hyphenation point inside a word, with the widths of the two parts it would produce
+  struct HyphenPoint {
+    uint16_t prefixWidth;  // Includes the inserted hyphen if one is needed
+    uint16_t suffixWidth;
+    uint8_t byteOffset;
+    bool insertHyphen;
+  };
+
+  // Points of a word must be contiguous in the point list, and words must appear in the same order as their points
+  struct Word {
+    uint16_t width;
+    bool continues;  // Attaches to the previous word, no break before it
+    uint16_t firstPoint;
+    uint8_t pointCount;
+  };
+
+  static constexpr uint16_t NO_POINT = UINT16_MAX;
+
+  // End of a line: before word `wordIndex`, or after the prefix at hyphen point `pointIndex` of that word
+  struct Break {
+    uint16_t wordIndex;
+    uint16_t pointIndex;
+  };
+
+  struct Params {
+    int pageWidth;
+    int firstLineIndent;
+    int spaceWidth;
+    // Added for every line ending in a hyphen, in the same unit as squared slack
+    int hyphenPenalty;
+    // Added on top when the previous line ended in a hyphen as well
+    int consecutiveHyphenPenalty;
+    // The first word is what remains of a word hyphenated at the end of the line before
+    bool startsHyphenated = false;
+  };
+
+  // Upper bound on words + hyphen points + 1 for totalFit(), which needs 6 bytes of scratch per position
+  static constexpr size_t MAX_POSITIONS = 3072;
+
+  // Knuth-Plass style total fit: minimizes the sum of squared slack over all lines but the last, with hyphen points as
+  // penalized breakpoints. Returns an empty vector if the paragraph exceeds MAX_POSITIONS.
+  static std::vector<Break> totalFit(const std::vector<Word>& words, const std::vector<HyphenPoint>& points,
+                                     const Params& params);
+
+  // For a paragraph still being read, with `words` the ones so far: the leading breaks that every optimal layout
+  // shares, whatever words follow. The last break is where the rest of the paragraph starts. Empty if no line is final
+  // yet or the words exceed MAX_POSITIONS.
+  static std::vector<Break> stableBreaks(const std::vector<Word>& words, const std::vector<HyphenPoint>& points,
+                                         const Params& params);
+
+  // First fit: fills each line as far as it goes, hyphenating the overflowing word at the widest prefix that fits
+  static std::vector<Break> greedy(const std::vector<Word>& words, const std::vector<HyphenPoint>& points,
+                                   const Params& params);
+
+ private:
+  static bool findPaths(const std::vector<Word>& words, const std::vector<HyphenPoint>& points, const Params& params,
+                        bool paragraphEnds, std::vector<int32_t>& cost, std::vector<uint16_t>& previous);
+  static std::vector<Break> tracePath(const std::vector<Word>& words, const std::vector<uint16_t>& previous,
+                                      size_t position);
+};
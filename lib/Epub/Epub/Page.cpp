@@ -1,69 +1,327 @@
 #include "Page.h"
 
+#include <Bitmap.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
+#include <cstring>
+#include <iterator>
+
+namespace {
+// Far above any real page, guards the allocation against a corrupt size
+constexpr uint32_t MAX_RECORD_SIZE = 64 * 1024;
+
+// Word styles are stored as runs, one byte each: style in the low bits, run length - 1 above
+constexpr uint8_t STYLE_RUN_SHIFT = 3;
+constexpr uint8_t STYLE_MASK = (1 << STYLE_RUN_SHIFT) - 1;
+constexpr size_t MAX_STYLE_RUN = 256 >> STYLE_RUN_SHIFT;
+
+// Block style flags byte: alignment in the low bits, then the "defined" flags
+constexpr uint8_t ALIGNMENT_MASK = 0x07;
+constexpr uint8_t TEXT_ALIGN_DEFINED = 1 << 3;
+constexpr uint8_t TEXT_INDENT_DEFINED = 1 << 4;
+
+// Spacing fields in the order of the presence mask bits, only non-zero ones are written
+int16_t BlockStyle::* const SPACING_FIELDS[] = {
+    &BlockStyle::marginTop,
+    &BlockStyle::marginBottom,
+    &BlockStyle::marginLeft,
+    &BlockStyle::marginRight,
+    &BlockStyle::paddingTop,
+    &BlockStyle::paddingBottom,
+    &BlockStyle::paddingLeft,
+    &BlockStyle::paddingRight,
+    &BlockStyle::textIndent,
+};
+
+constexpr char EM_SPACE[] = "\xe2\x80\x83";
+constexpr size_t EM_SPACE_LENGTH = sizeof(EM_SPACE) - 1;
+}  // namespace
+
+void Page::clear() {
+  elements.clear();
+  words.clear();
+  text.clear();
+  images.clear();
 }
 
-bool PageLine::serialize(FsFile& file) {
-  serialization::writePod(file, xPos);
-  serialization::writePod(file, yPos);
+uint32_t Page::appendText(const std::string_view word) {
+  const auto offset = static_cast<uint32_t>(text.size());
+  text.insert(text.end(), word.begin(), word.end());
+  text.push_back('\0');
+  return offset;
+}
 
-  // serialize TextBlock pointed to by PageLine
-  return block->serialize(file);
+bool Page::addLine(const TextBlock& line, const int16_t xPos, const int16_t yPos) {
+  const auto& lineWords = line.getWords();
+  const auto& lineXpos = line.getWordXpos();
+  const auto& lineStyles = line.getWordStyles();
+  if (lineWords.size() != lineXpos.size() || lineWords.size() != lineStyles.size()) {
+    LOG_ERR("PGE", "Line skipped: size mismatch (words=%u, xpos=%u, styles=%u)", (uint32_t)lineWords.size(),
+            (uint32_t)lineXpos.size(), (uint32_t)lineStyles.size());
+    return false;
+  }
+  if (words.size() + lineWords.size() > UINT16_MAX) {
+    LOG_ERR("PGE", "Line skipped: too many words on page");
+    return false;
+  }
+
+  elements.push_back({TAG_PageLine, xPos, yPos, static_cast<uint16_t>(words.size()),
+                      static_cast<uint16_t>(lineWords.size()), line.getBlockStyle()});
+  auto xIt = lineXpos.begin();
+  auto styleIt = lineStyles.begin();
+  for (const auto& w : lineWords) {
+    words.push_back({appendText(w), *xIt++, *styleIt++});
+  }
+  return true;
+}
+
+bool Page::addImage(const PageImage& image, const int16_t xPos, const int16_t yPos) {
+  if (images.size() >= UINT16_MAX) {
+    LOG_ERR("PGE", "Image skipped: too many images on page");
+    return false;
+  }
+  elements.push_back({TAG_PageImage, xPos, yPos, static_cast<uint16_t>(images.size()), 0, {}});
+  images.push_back(image);
+  return true;
 }
 
-std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
-  int16_t xPos;
-  int16_t yPos;
-  serialization::readPod(file, xPos);
-  serialization::readPod(file, yPos);
+void Page::renderLine(GfxRenderer& renderer, const int fontId, const PageElement& line, const int x,
+                      const int y) const {
+  for (uint32_t i = line.firstWord; i < line.firstWord + line.wordCount; i++) {
+    const PageWord& word = words[i];
+    const char* w = text.data() + word.textOffset;
+    const int wordX = word.x + x;
+    renderer.drawText(fontId, wordX, y, w, true, word.style);
+
+    if ((word.style & EpdFontFamily::UNDERLINE) != 0) {
+      // y is the top of the text line; add ascender to reach baseline, then offset 2px below
+      const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+
+      int startX = wordX;
+      int underlineWidth;
+
+      // if word starts with em-space, account for the additional indent before drawing the line
+      if (strncmp(w, EM_SPACE, EM_SPACE_LENGTH) == 0) {
+        startX = wordX + renderer.getTextAdvanceX(fontId, EM_SPACE);
+        underlineWidth = renderer.getTextWidth(fontId, w + EM_SPACE_LENGTH, word.style);
+      } else {
+        underlineWidth = renderer.getTextWidth(fontId, w, word.style);
+      }
 
-  auto tb = TextBlock::deserialize(file);
-  return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
+      renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
+    }
+  }
+}
+
+void Page::renderImage(GfxRenderer& renderer, const PageImage& image, const int x, const int y) const {
+  if (!imageFile || !*imageFile) {
+    return;
+  }
+  Bitmap bitmap(*imageFile, false, image.offset);
+  const BmpReaderError error = bitmap.parseHeaders();
+  if (error != BmpReaderError::Ok) {
+    LOG_ERR("PGE", "Image at %u unreadable: %s", image.offset, Bitmap::errorToString(error));
+    return;
+  }
+  renderer.drawBitmap(bitmap, x, y, image.width, image.height);
 }
 
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
-  for (auto& element : elements) {
-    element->render(renderer, fontId, xOffset, yOffset);
+  for (const auto& element : elements) {
+    switch (element.tag) {
+      case TAG_PageLine:
+        renderLine(renderer, fontId, element, element.xPos + xOffset, element.yPos + yOffset);
+        break;
+      case TAG_PageImage:
+        // Images are 1-bit, the grayscale passes have nothing to add to them
+        if (renderer.getRenderMode() == GfxRenderer::BW) {
+          renderImage(renderer, images[element.firstWord], element.xPos + xOffset, element.yPos + yOffset);
+        }
+        break;
+    }
   }
 }
 
 bool Page::serialize(FsFile& file) const {
-  const uint16_t count = elements.size();
-  serialization::writePod(file, count);
+  serialization::StringTable wordTable;
+  std::vector<uint8_t> body;
+  serialization::writeVarUint(body, elements.size());
 
   for (const auto& el : elements) {
-    // Only PageLine exists currently
-    serialization::writePod(file, static_cast<uint8_t>(TAG_PageLine));
-    if (!el->serialize(file)) {
-      return false;
+    body.push_back(el.tag);
+    serialization::writeVarInt(body, el.xPos);
+    serialization::writeVarInt(body, el.yPos);
+
+    if (el.tag == TAG_PageImage) {
+      const PageImage& image = images[el.firstWord];
+      serialization::writeVarUint(body, image.offset);
+      serialization::writeVarUint(body, image.width);
+      serialization::writeVarUint(body, image.height);
+      continue;
+    }
+
+    // Words as indexes into the page's table
+    const PageWord* first = words.data() + el.firstWord;
+    const PageWord* last = first + el.wordCount;
+    serialization::writeVarUint(body, el.wordCount);
+    for (auto w = first; w != last; ++w) {
+      serialization::writeVarUint(body, wordTable.intern(text.data() + w->textOffset));
+    }
+
+    // Positions as the distance from the previous word, mostly a single byte. Wraps around if a word is ever left of
+    // its predecessor.
+    uint16_t previousX = 0;
+    for (auto w = first; w != last; ++w) {
+      serialization::writeVarUint(body, static_cast<uint16_t>(w->x - previousX));
+      previousX = w->x;
+    }
+
+    // Styles as runs, typically one byte per line
+    for (auto w = first; w != last;) {
+      const EpdFontFamily::Style style = w->style;
+      size_t run = 0;
+      while (w != last && w->style == style && run < MAX_STYLE_RUN) {
+        ++w;
+        run++;
+      }
+      body.push_back(static_cast<uint8_t>((style & STYLE_MASK) | ((run - 1) << STYLE_RUN_SHIFT)));
+    }
+
+    // Style (alignment + margins/padding/indent)
+    const BlockStyle& blockStyle = el.blockStyle;
+    uint8_t flags = static_cast<uint8_t>(blockStyle.alignment) & ALIGNMENT_MASK;
+    if (blockStyle.textAlignDefined) flags |= TEXT_ALIGN_DEFINED;
+    if (blockStyle.textIndentDefined) flags |= TEXT_INDENT_DEFINED;
+    uint32_t presentFields = 0;
+    for (size_t i = 0; i < std::size(SPACING_FIELDS); i++) {
+      if (blockStyle.*SPACING_FIELDS[i] != 0) presentFields |= 1 << i;
+    }
+    body.push_back(flags);
+    serialization::writeVarUint(body, presentFields);
+    for (const auto field : SPACING_FIELDS) {
+      if (blockStyle.*field != 0) serialization::writeVarInt(body, blockStyle.*field);
     }
   }
 
-  return true;
+  std::vector<uint8_t> record;
+  wordTable.write(record);
+  record.insert(record.end(), body.begin(), body.end());
+
+  const uint32_t size = record.size();
+  serialization::writePod(file, size);
+  return file.write(record.data(), size) == size;
 }
 
-std::unique_ptr<Page> Page::deserialize(FsFile& file) {
-  auto page = std::unique_ptr<Page>(new Page());
+bool Page::deserialize(FsFile& file, LoadBuffers& buffers) {
+  clear();
 
-  uint16_t count;
-  serialization::readPod(file, count);
+  uint32_t size = 0;
+  serialization::readPod(file, size);
+  if (size == 0 || size > MAX_RECORD_SIZE) {
+    LOG_ERR("PGE", "Deserialization failed: Invalid record size %u", size);
+    return false;
+  }
 
-  for (uint16_t i = 0; i < count; i++) {
-    uint8_t tag;
-    serialization::readPod(file, tag);
+  auto& record = buffers.record;
+  record.resize(size);
+  if (file.read(record.data(), size) != static_cast<int>(size)) {
+    LOG_ERR("PGE", "Deserialization failed: Record truncated");
+    return false;
+  }
 
-    if (tag == TAG_PageLine) {
-      auto pl = PageLine::deserialize(file);
-      page->elements.push_back(std::move(pl));
-    } else {
+  serialization::BufferReader in(record.data(), size);
+  auto& wordTable = buffers.words;
+  if (!serialization::readStringTable(in, wordTable)) {
+    LOG_ERR("PGE", "Deserialization failed: Invalid word table");
+    return false;
+  }
+  // Each distinct word is copied into the page once, lines refer to it by offset
+  auto& textOffsets = buffers.textOffsets;
+  textOffsets.clear();
+  for (const auto& w : wordTable) {
+    textOffsets.push_back(appendText(w));
+  }
+
+  const uint32_t count = in.readVarUint();
+  for (uint32_t i = 0; i < count && !in.failed; i++) {
+    const uint8_t tag = in.readByte();
+    if (tag == TAG_PageImage) {
+      const auto xPos = static_cast<int16_t>(in.readVarInt());
+      const auto yPos = static_cast<int16_t>(in.readVarInt());
+      PageImage image{0, 0, 0};
+      image.offset = in.readVarUint();
+      image.width = static_cast<uint16_t>(in.readVarUint());
+      image.height = static_cast<uint16_t>(in.readVarUint());
+      addImage(image, xPos, yPos);
+      continue;
+    }
+    if (tag != TAG_PageLine) {
       LOG_ERR("PGE", "Deserialization failed: Unknown tag %u", tag);
-      return nullptr;
+      clear();
+      return false;
+    }
+
+    PageElement line{TAG_PageLine, 0, 0, 0, 0, {}};
+    line.xPos = static_cast<int16_t>(in.readVarInt());
+    line.yPos = static_cast<int16_t>(in.readVarInt());
+
+    const uint32_t wc = in.readVarUint();
+    if (wc > in.remaining() || words.size() + wc > UINT16_MAX) {
+      LOG_ERR("PGE", "Deserialization failed: word count %u exceeds record", wc);
+      clear();
+      return false;
+    }
+    line.firstWord = static_cast<uint16_t>(words.size());
+    line.wordCount = static_cast<uint16_t>(wc);
+    for (uint32_t w = 0; w < wc; w++) {
+      const uint32_t index = in.readVarUint();
+      if (index >= textOffsets.size()) {
+        LOG_ERR("PGE", "Deserialization failed: word %u not in page table", index);
+        clear();
+        return false;
+      }
+      words.push_back({textOffsets[index], 0, EpdFontFamily::REGULAR});
+    }
+    PageWord* lineWords = words.data() + line.firstWord;
+    uint16_t x = 0;
+    for (uint32_t w = 0; w < wc; w++) {
+      x = static_cast<uint16_t>(x + in.readVarUint());
+      lineWords[w].x = x;
     }
+    for (uint32_t w = 0; w < wc && !in.failed;) {
+      const uint8_t run = in.readByte();
+      const auto style = static_cast<EpdFontFamily::Style>(run & STYLE_MASK);
+      const uint32_t runEnd = w + (run >> STYLE_RUN_SHIFT) + 1;
+      if (runEnd > wc) {
+        LOG_ERR("PGE", "Deserialization failed: style runs do not match word count");
+        clear();
+        return false;
+      }
+      for (; w < runEnd; w++) lineWords[w].style = style;
+    }
+
+    // Style (alignment + margins/padding/indent)
+    BlockStyle& blockStyle = line.blockStyle;
+    const uint8_t flags = in.readByte();
+    blockStyle.alignment = static_cast<CssTextAlign>(flags & ALIGNMENT_MASK);
+    blockStyle.textAlignDefined = (flags & TEXT_ALIGN_DEFINED) != 0;
+    blockStyle.textIndentDefined = (flags & TEXT_INDENT_DEFINED) != 0;
+    const uint32_t presentFields = in.readVarUint();
+    for (size_t f = 0; f < std::size(SPACING_FIELDS); f++) {
+      if ((presentFields & (1 << f)) != 0) blockStyle.*SPACING_FIELDS[f] = static_cast<int16_t>(in.readVarInt());
+    }
+
+    elements.push_back(line);
   }
 
-  return page;
+  if (in.failed) {
+    LOG_ERR("PGE", "Deserialization failed: Record truncated");
+    clear();
+    return false;
+  }
+
+  return true;
 }
@@ -1,43 +1,76 @@
 #pragma once
 #include <HalStorage.h>
 
-#include <utility>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "blocks/TextBlock.h"
 
+class GfxRenderer;
+
 enum PageElementTag : uint8_t {
   TAG_PageLine = 1,
+  TAG_PageImage = 2,
 };
 
-// represents something that has been added to a page
-class PageElement {
- public:
-  int16_t xPos;
-  int16_t yPos;
-  explicit PageElement(const int16_t xPos, const int16_t yPos) : xPos(xPos), yPos(yPos) {}
-  virtual ~PageElement() = default;
-  virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
-  virtual bool serialize(FsFile& file) = 0;
+// A word of a page line, the text is NUL-terminated in the page's text buffer
+struct PageWord {
+  uint32_t textOffset;
+  uint16_t x;
+  EpdFontFamily::Style style;
 };
 
-// a line from a block element
-class PageLine final : public PageElement {
-  std::shared_ptr<TextBlock> block;
+// An image decoded when the section was built, a BMP stored in the section file at `offset`, already scaled to the
+// size it is drawn at
+struct PageImage {
+  uint32_t offset;
+  uint16_t width;
+  uint16_t height;
+};
 
- public:
-  PageLine(std::shared_ptr<TextBlock> block, const int16_t xPos, const int16_t yPos)
-      : PageElement(xPos, yPos), block(std::move(block)) {}
-  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
-  bool serialize(FsFile& file) override;
-  static std::unique_ptr<PageLine> deserialize(FsFile& file);
+// Something that has been added to a page. Plain records tagged by type, a line refers to a run of the page's words,
+// an image to the page's image at index firstWord.
+struct PageElement {
+  PageElementTag tag;
+  int16_t xPos;
+  int16_t yPos;
+  uint16_t firstWord;
+  uint16_t wordCount;
+  BlockStyle blockStyle;
 };
 
+// A page keeps its elements, words and text in three flat arrays. Loading a page into the same Page again reuses their
+// capacity, so turning pages doesn't allocate once the buffers have grown to the size of a full page.
 class Page {
+  std::vector<PageElement> elements;
+  std::vector<PageWord> words;
+  std::vector<char> text;
+  std::vector<PageImage> images;
+  // Open section file the images are read from, owned by the Section that loaded the page
+  FsFile* imageFile = nullptr;
+
+  uint32_t appendText(std::string_view word);
+  void renderLine(GfxRenderer& renderer, int fontId, const PageElement& line, int x, int y) const;
+  void renderImage(GfxRenderer& renderer, const PageImage& image, int x, int y) const;
+
  public:
-  // the list of block index and line numbers on this page
-  std::vector<std::shared_ptr<PageElement>> elements;
+  // Scratch space for deserialize(), kept between loads
+  struct LoadBuffers {
+    std::vector<uint8_t> record;
+    std::vector<std::string_view> words;
+    std::vector<uint32_t> textOffsets;
+  };
+
+  void clear();
+  // Copies the line's words into the page
+  bool addLine(const TextBlock& line, int16_t xPos, int16_t yPos);
+  bool addImage(const PageImage& image, int16_t xPos, int16_t yPos);
+  void setImageFile(FsFile* file) { imageFile = file; }
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
+  // A page is one record: its size, the page's word table, then the elements. It is written and read back with a
+  // single file call.
   bool serialize(FsFile& file) const;
-  static std::unique_ptr<Page> deserialize(FsFile& file);
+  // Replaces the contents of this page with the record at the current file position
+  bool deserialize(FsFile& file, LoadBuffers& buffers);
 };
@@ -6,18 +6,23 @@
 #include <cmath>
 #include <functional>
 #include <iterator>
-#include <limits>
 #include <vector>
 
+#include "LineBreaker.h"
 #include "hyphenation/Hyphenator.h"
 
-constexpr int MAX_COST = std::numeric_limits<int>::max();
-
 namespace {
 
 // Soft hyphen byte pattern used throughout EPUBs (UTF-8 for U+00AD).
 constexpr char SOFT_HYPHEN_UTF8[] = "\xC2\xAD";
 constexpr size_t SOFT_HYPHEN_BYTES = 2;
+// A hyphenated line end costs as much as this many spaces of slack on one line. Stacked hyphens cost extra, tuned with
+// test/run_line_breaking_bench.sh to hyphenate no more often than the old greedy breaker with far fewer stacks.
+constexpr int HYPHEN_PENALTY_SPACES = 4;
+constexpr int CONSECUTIVE_HYPHEN_PENALTY_SPACES = 8;
+// A paragraph still being read with no final line by this many words (e.g. a run of words far wider than the page) is
+// laid out as if it ended there, all lines but the last are extracted
+constexpr size_t MAX_WINDOW_WORDS = 750;
 
 bool containsSoftHyphen(const std::string& word) { return word.find(SOFT_HYPHEN_UTF8) != std::string::npos; }
 
@@ -29,25 +34,21 @@ void stripSoftHyphensInPlace(std::string& word) {
   }
 }
 
-// Returns the rendered width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
+bool isSoftHyphen(const uint32_t cp) { return cp == 0xAD; }
+
+// Returns the rendered width of the bytes [begin, end) of a word, measured in place, ignoring soft hyphen glyphs and
+// optionally appending a visible hyphen.
+uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const char* begin, const char* end,
                           const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
+  if (end - begin == 1 && *begin == ' ' && !appendHyphen) {
     return renderer.getSpaceWidth(fontId);
   }
-  const bool hasSoftHyphen = containsSoftHyphen(word);
-  if (!hasSoftHyphen && !appendHyphen) {
-    return renderer.getTextWidth(fontId, word.c_str(), style);
-  }
+  return renderer.getTextWidth(fontId, begin, end, style, isSoftHyphen, appendHyphen ? '-' : 0);
+}
 
-  std::string sanitized = word;
-  if (hasSoftHyphen) {
-    stripSoftHyphensInPlace(sanitized);
-  }
-  if (appendHyphen) {
-    sanitized.push_back('-');
-  }
-  return renderer.getTextWidth(fontId, sanitized.c_str(), style);
+uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
+                          const EpdFontFamily::Style style) {
+  return measureWordWidth(renderer, fontId, word.data(), word.data() + word.size(), style);
 }
 
 }  // namespace
@@ -67,8 +68,8 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
 
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
-                                       const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
+                                       const std::function<void(const TextBlock&)>& processLine,
+                                       const bool paragraphEnds) {
   if (words.empty()) {
     return;
   }
@@ -84,17 +85,34 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   std::vector<bool> continuesVec(wordContinues.begin(), wordContinues.end());
 
   std::vector<size_t> lineBreakIndices;
-  if (hyphenationEnabled) {
-    // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+  bool extractLastLine = true;
+  if (!paragraphEnds) {
+    // Only the leading lines that stay the same whatever words follow
+    lineBreakIndices =
+        computeTotalFitLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec, false);
+    if (lineBreakIndices.empty() && words.size() >= MAX_WINDOW_WORDS) {
+      std::vector<bool> splitBreaks;
+      lineBreakIndices = computeTotalFitLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec,
+                                                   true, &splitBreaks);
+      extractLastLine = false;
+      // The words kept back start after the last line extracted
+      startsHyphenated = splitBreaks.size() >= 2 && splitBreaks[splitBreaks.size() - 2];
+    }
   } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    // Optimal layout, which with hyphenation on also considers breaking inside words at hyphenation points. The same
+    // breaker lays out the windows above, so a paragraph ends the way it would have been laid out in one go.
+    lineBreakIndices =
+        computeTotalFitLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec, true);
   }
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
+  const size_t lineCount = extractLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, processLine);
+    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, paragraphEnds, processLine);
   }
+  if (lineCount > 0) {
+    continuesParagraph = true;
+  }
+  layoutWindowLimit = words.size() + LAYOUT_WINDOW_WORDS;
 }
 
 std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
@@ -116,21 +134,33 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
   return wordWidths;
 }
 
-std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
-                                                  const int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec) {
-  if (words.empty()) {
-    return {};
+void ParsedText::applyParagraphIndent() {
+  if (extraParagraphSpacing || words.empty() || indentApplied) {
+    return;
   }
+  indentApplied = true;
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  if (blockStyle.textIndentDefined) {
+    // CSS text-indent is explicitly set (even if 0) - don't use fallback EmSpace
+    // The actual indent positioning is handled in extractLine()
+  } else if (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left) {
+    // No CSS text-indent defined - use EmSpace fallback for visual indent
+    words.front().insert(0, "\xe2\x80\x83");
+  }
+}
 
-  // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
+// First line indent (only for left/justified text without extra paragraph spacing)
+int ParsedText::getFirstLineIndent() const {
+  return !continuesParagraph && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
+                 (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
+             ? blockStyle.textIndent
+             : 0;
+}
+
+// Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
+void ParsedText::splitOversizedWords(const GfxRenderer& renderer, const int fontId, const int pageWidth,
+                                     std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec) {
+  const int firstLineIndent = getFirstLineIndent();
   for (size_t i = 0; i < wordWidths.size(); ++i) {
     // First word needs to fit in reduced width if there's an indent
     const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
@@ -141,171 +171,90 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
       }
     }
   }
+}
 
-  const size_t totalWordCount = words.size();
-
-  // DP table to store the minimum badness (cost) of lines starting at index i
-  std::vector<int> dp(totalWordCount);
-  // 'ans[i]' stores the index 'j' of the *last word* in the optimal line starting at 'i'
-  std::vector<size_t> ans(totalWordCount);
-
-  // Base Case
-  dp[totalWordCount - 1] = 0;
-  ans[totalWordCount - 1] = totalWordCount - 1;
-
-  for (int i = totalWordCount - 2; i >= 0; --i) {
-    int currlen = 0;
-    dp[i] = MAX_COST;
-
-    // First line has reduced width due to text-indent
-    const int effectivePageWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
-
-    for (size_t j = i; j < totalWordCount; ++j) {
-      // Add space before word j, unless it's the first word on the line or a continuation
-      const int gap = j > static_cast<size_t>(i) && !continuesVec[j] ? spaceWidth : 0;
-      currlen += wordWidths[j] + gap;
-
-      if (currlen > effectivePageWidth) {
-        break;
-      }
-
-      // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
-        continue;
-      }
+// Total-fit layout with hyphenation points as extra, penalized breakpoints (see LineBreaker). Words are only split
+// where the chosen breaks fall inside them. With paragraphEnds false only the stable leading breaks are returned.
+// splitBreaks, if given, receives for every returned break whether it split a word.
+std::vector<size_t> ParsedText::computeTotalFitLineBreaks(const GfxRenderer& renderer, const int fontId,
+                                                          const int pageWidth, const int spaceWidth,
+                                                          std::vector<uint16_t>& wordWidths,
+                                                          std::vector<bool>& continuesVec, const bool paragraphEnds,
+                                                          std::vector<bool>* splitBreaks) {
+  splitOversizedWords(renderer, fontId, pageWidth, wordWidths, continuesVec);
+
+  // Measure both halves at every hyphenation point, up to what the breaker can take
+  std::vector<LineBreaker::Word> breakerWords;
+  std::vector<LineBreaker::HyphenPoint> points;
+  std::vector<Hyphenator::BreakInfo> breakInfos;
+  breakerWords.reserve(wordWidths.size());
+  const size_t maxPoints =
+      wordWidths.size() < LineBreaker::MAX_POSITIONS ? LineBreaker::MAX_POSITIONS - wordWidths.size() - 1 : 0;
 
-      int cost;
-      if (j == totalWordCount - 1) {
-        cost = 0;  // Last line
-      } else {
-        const int remainingSpace = effectivePageWidth - currlen;
-        // Use long long for the square to prevent overflow
-        const long long cost_ll = static_cast<long long>(remainingSpace) * remainingSpace + dp[j + 1];
-
-        if (cost_ll > MAX_COST) {
-          cost = MAX_COST;
-        } else {
-          cost = static_cast<int>(cost_ll);
+  auto wordIt = words.begin();
+  auto styleIt = wordStyles.begin();
+  for (size_t i = 0; i < wordWidths.size(); ++i, ++wordIt, ++styleIt) {
+    LineBreaker::Word breakerWord = {wordWidths[i], static_cast<bool>(continuesVec[i]),
+                                     static_cast<uint16_t>(points.size()), 0};
+    if (hyphenationEnabled && points.size() < maxPoints) {
+      Hyphenator::breakOffsets(*wordIt, false, breakInfos);
+      for (const auto& info : breakInfos) {
+        if (info.byteOffset == 0 || info.byteOffset >= wordIt->size() || info.byteOffset > UINT8_MAX ||
+            points.size() >= maxPoints || breakerWord.pointCount == UINT8_MAX) {
+          continue;
         }
-      }
-
-      if (cost < dp[i]) {
-        dp[i] = cost;
-        ans[i] = j;  // j is the index of the last word in this optimal line
-      }
-    }
-
-    // Handle oversized word: if no valid configuration found, force single-word line
-    // This prevents cascade failure where one oversized word breaks all preceding words
-    if (dp[i] == MAX_COST) {
-      ans[i] = i;  // Just this word on its own line
-      // Inherit cost from next word to allow subsequent words to find valid configurations
-      if (i + 1 < static_cast<int>(totalWordCount)) {
-        dp[i] = dp[i + 1];
-      } else {
-        dp[i] = 0;
+        const char* split = wordIt->data() + info.byteOffset;
+        const uint16_t prefixWidth =
+            measureWordWidth(renderer, fontId, wordIt->data(), split, *styleIt, info.requiresInsertedHyphen);
+        const uint16_t suffixWidth =
+            measureWordWidth(renderer, fontId, split, wordIt->data() + wordIt->size(), *styleIt);
+        points.push_back({prefixWidth, suffixWidth, static_cast<uint8_t>(info.byteOffset), info.requiresInsertedHyphen});
+        breakerWord.pointCount++;
       }
     }
+    breakerWords.push_back(breakerWord);
   }
 
-  // Stores the index of the word that starts the next line (last_word_index + 1)
-  std::vector<size_t> lineBreakIndices;
-  size_t currentWordIndex = 0;
-
-  while (currentWordIndex < totalWordCount) {
-    size_t nextBreakIndex = ans[currentWordIndex] + 1;
-
-    // Safety check: prevent infinite loop if nextBreakIndex doesn't advance
-    if (nextBreakIndex <= currentWordIndex) {
-      // Force advance by at least one word to avoid infinite loop
-      nextBreakIndex = currentWordIndex + 1;
+  const LineBreaker::Params params = {pageWidth, getFirstLineIndent(), spaceWidth,
+                                      HYPHEN_PENALTY_SPACES * HYPHEN_PENALTY_SPACES * spaceWidth * spaceWidth,
+                                      CONSECUTIVE_HYPHEN_PENALTY_SPACES * CONSECUTIVE_HYPHEN_PENALTY_SPACES *
+                                          spaceWidth * spaceWidth,
+                                      startsHyphenated};
+  std::vector<LineBreaker::Break> breaks;
+  if (!paragraphEnds) {
+    breaks = LineBreaker::stableBreaks(breakerWords, points, params);
+    // The words left over start with the rest of a split word
+    if (!breaks.empty()) {
+      startsHyphenated = breaks.back().pointIndex != LineBreaker::NO_POINT;
+    }
+  } else {
+    breaks = LineBreaker::totalFit(breakerWords, points, params);
+    if (breaks.empty()) {
+      // Paragraph too large for the optimal breaker's scratch budget
+      breaks = LineBreaker::greedy(breakerWords, points, params);
     }
-
-    lineBreakIndices.push_back(nextBreakIndex);
-    currentWordIndex = nextBreakIndex;
-  }
-
-  return lineBreakIndices;
-}
-
-void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
-    return;
-  }
-
-  if (blockStyle.textIndentDefined) {
-    // CSS text-indent is explicitly set (even if 0) - don't use fallback EmSpace
-    // The actual indent positioning is handled in extractLine()
-  } else if (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left) {
-    // No CSS text-indent defined - use EmSpace fallback for visual indent
-    words.front().insert(0, "\xe2\x80\x83");
   }
-}
-
-// Builds break indices while opportunistically splitting the word that would overflow the current line.
-std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
-                                                            const int pageWidth, const int spaceWidth,
-                                                            std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  breakerWords.clear();
+  breakerWords.shrink_to_fit();
 
+  // Split words at the chosen points, every split shifts the following indices by one
   std::vector<size_t> lineBreakIndices;
-  size_t currentIndex = 0;
-  bool isFirstLine = true;
-
-  while (currentIndex < wordWidths.size()) {
-    const size_t lineStart = currentIndex;
-    int lineWidth = 0;
-
-    // First line has reduced width due to text-indent
-    const int effectivePageWidth = isFirstLine ? pageWidth - firstLineIndent : pageWidth;
-
-    // Consume as many words as possible for current line, splitting when prefixes fit
-    while (currentIndex < wordWidths.size()) {
-      const bool isFirstWord = currentIndex == lineStart;
-      const int spacing = isFirstWord || continuesVec[currentIndex] ? 0 : spaceWidth;
-      const int candidateWidth = spacing + wordWidths[currentIndex];
-
-      // Word fits on current line
-      if (lineWidth + candidateWidth <= effectivePageWidth) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-        continue;
-      }
-
-      // Word would overflow — try to split based on hyphenation points
-      const int availableWidth = effectivePageWidth - lineWidth - spacing;
-      const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
-
-      if (availableWidth > 0 && hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths,
-                                                     allowFallbackBreaks, &continuesVec)) {
-        // Prefix now fits; append it to this line and move to next line
-        lineWidth += spacing + wordWidths[currentIndex];
-        ++currentIndex;
-        break;
-      }
-
-      // Could not split: force at least one word per line to avoid infinite loop
-      if (currentIndex == lineStart) {
-        lineWidth += candidateWidth;
-        ++currentIndex;
-      }
-      break;
+  lineBreakIndices.reserve(breaks.size());
+  size_t insertedWords = 0;
+  for (const auto& lineBreak : breaks) {
+    const size_t wordIndex = lineBreak.wordIndex + insertedWords;
+    if (splitBreaks) {
+      splitBreaks->push_back(lineBreak.pointIndex != LineBreaker::NO_POINT);
     }
-
-    // Don't break before a continuation word (e.g., orphaned "?" after "question").
-    // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
-      --currentIndex;
+    if (lineBreak.pointIndex == LineBreaker::NO_POINT) {
+      lineBreakIndices.push_back(wordIndex);
+      continue;
     }
-
-    lineBreakIndices.push_back(currentIndex);
-    isFirstLine = false;
+    const auto& point = points[lineBreak.pointIndex];
+    splitWordAt(wordIndex, point.byteOffset, point.insertHyphen, point.prefixWidth, point.suffixWidth, wordWidths,
+                &continuesVec);
+    insertedWords++;
+    lineBreakIndices.push_back(wordIndex + 1);
   }
 
   return lineBreakIndices;
@@ -348,7 +297,7 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     }
 
     const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    const int prefixWidth = measureWordWidth(renderer, fontId, word.data(), word.data() + offset, style, needsHyphen);
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
       continue;  // Skip if too wide or not an improvement
     }
@@ -363,57 +312,54 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     return false;
   }
 
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  wordIt->resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    wordIt->push_back('-');
-  }
-
-  // Insert the remainder word (with matching style and continuation flag) directly after the prefix.
-  auto insertWordIt = std::next(wordIt);
-  auto insertStyleIt = std::next(styleIt);
-  words.insert(insertWordIt, remainder);
-  wordStyles.insert(insertStyleIt, style);
+  splitWordAt(wordIndex, chosenOffset, chosenNeedsHyphen, static_cast<uint16_t>(chosenWidth),
+              measureWordWidth(renderer, fontId, word.data() + chosenOffset, word.data() + word.size(), style),
+              wordWidths, continuesVec);
+  return true;
+}
 
-  // The remainder inherits whatever continuation status the original word had with the word after it.
-  // Find the continues entry for the original word and insert the remainder's entry after it.
+// Splits words[wordIndex] at byteOffset, appending a hyphen to the prefix if required. The prefix keeps its place
+// (and its attachment to the previous word), the remainder becomes a separate word right after it.
+void ParsedText::splitWordAt(const size_t wordIndex, const size_t byteOffset, const bool insertHyphen,
+                             const uint16_t prefixWidth, const uint16_t suffixWidth, std::vector<uint16_t>& wordWidths,
+                             std::vector<bool>* continuesVec) {
+  auto wordIt = words.begin();
+  auto styleIt = wordStyles.begin();
   auto continuesIt = wordContinues.begin();
+  std::advance(wordIt, wordIndex);
+  std::advance(styleIt, wordIndex);
   std::advance(continuesIt, wordIndex);
-  const bool originalContinuedToNext = *continuesIt;
-  // The original word (now prefix) does NOT continue to remainder (hyphen separates them)
-  *continuesIt = false;
-  const auto insertContinuesIt = std::next(continuesIt);
-  wordContinues.insert(insertContinuesIt, originalContinuedToNext);
 
-  // Keep the indexed vector in sync if provided
+  std::string remainder = wordIt->substr(byteOffset);
+  wordIt->resize(byteOffset);
+  if (insertHyphen) {
+    wordIt->push_back('-');
+  }
+
+  // The remainder starts a new line, it doesn't attach to the prefix (a hyphen or line break separates them)
+  words.insert(std::next(wordIt), std::move(remainder));
+  wordStyles.insert(std::next(styleIt), *styleIt);
+  wordContinues.insert(std::next(continuesIt), false);
   if (continuesVec) {
-    (*continuesVec)[wordIndex] = false;
-    continuesVec->insert(continuesVec->begin() + wordIndex + 1, originalContinuedToNext);
+    continuesVec->insert(continuesVec->begin() + wordIndex + 1, false);
   }
 
   // Update cached widths to reflect the new prefix/remainder pairing.
-  wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
-  wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
-  return true;
+  wordWidths[wordIndex] = prefixWidth;
+  wordWidths.insert(wordWidths.begin() + wordIndex + 1, suffixWidth);
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
                              const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
-                             const std::vector<size_t>& lineBreakIndices,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
+                             const std::vector<size_t>& lineBreakIndices, const bool paragraphEnds,
+                             const std::function<void(const TextBlock&)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
   const size_t lineWordCount = lineBreak - lastBreakAt;
 
   // Calculate first line indent (only for left/justified text without extra paragraph spacing)
   const bool isFirstLine = breakIndex == 0;
-  const int firstLineIndent =
-      isFirstLine && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  const int firstLineIndent = isFirstLine ? getFirstLineIndent() : 0;
 
   // Calculate total word width for this line and count actual word gaps
   // (continuation words attach to previous word with no gap)
@@ -433,7 +379,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   const int spareSpace = effectivePageWidth - lineWordWidthSum;
 
   int spacing = spaceWidth;
-  const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
+  const bool isLastLine = paragraphEnds && breakIndex == lineBreakIndices.size() - 1;
 
   // For justified text, calculate spacing based on actual gap count
   if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine && actualGapCount >= 1) {
@@ -487,6 +433,5 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     }
   }
 
-  processLine(
-      std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), blockStyle));
+  processLine(TextBlock(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), blockStyle));
 }
@@ -20,22 +20,35 @@ class ParsedText {
   BlockStyle blockStyle;
   bool extraParagraphSpacing;
   bool hyphenationEnabled;
+  bool indentApplied = false;
+  // Lines of this paragraph were extracted already, the words left continue it
+  bool continuesParagraph = false;
+  // The first word is what remains of a word hyphenated at the end of the last extracted line
+  bool startsHyphenated = false;
+  // Word count at which isLayoutWindowFull() asks for the next layout of a paragraph still being read
+  size_t layoutWindowLimit = LAYOUT_WINDOW_WORDS;
 
   void applyParagraphIndent();
-  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
-                                        std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec);
+  int getFirstLineIndent() const;
+  void splitOversizedWords(const GfxRenderer& renderer, int fontId, int pageWidth, std::vector<uint16_t>& wordWidths,
+                           std::vector<bool>& continuesVec);
+  std::vector<size_t> computeTotalFitLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
+                                                std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec,
+                                                bool paragraphEnds, std::vector<bool>* splitBreaks = nullptr);
   bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
                             std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks,
                             std::vector<bool>* continuesVec = nullptr);
+  void splitWordAt(size_t wordIndex, size_t byteOffset, bool insertHyphen, uint16_t prefixWidth, uint16_t suffixWidth,
+                   std::vector<uint16_t>& wordWidths, std::vector<bool>* continuesVec);
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
                    const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
-                   const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
+                   bool paragraphEnds, const std::function<void(const TextBlock&)>& processLine);
   std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
 
  public:
+  // A paragraph still being read is laid out each time this many more words are buffered
+  static constexpr size_t LAYOUT_WINDOW_WORDS = 120;
+
   explicit ParsedText(const bool extraParagraphSpacing, const bool hyphenationEnabled = false,
                       const BlockStyle& blockStyle = BlockStyle())
       : blockStyle(blockStyle), extraParagraphSpacing(extraParagraphSpacing), hyphenationEnabled(hyphenationEnabled) {}
@@ -46,7 +59,9 @@ class ParsedText {
   BlockStyle& getBlockStyle() { return blockStyle; }
   size_t size() const { return words.size(); }
   bool isEmpty() const { return words.empty(); }
+  bool isLayoutWindowFull() const { return words.size() >= layoutWindowLimit; }
+  // With paragraphEnds false the paragraph is still being read: only the lines that no words still to come can change
+  // are extracted, the rest stay buffered for the next call.
   void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             bool includeLastLine = true);
+                             const std::function<void(const TextBlock&)>& processLine, bool paragraphEnds = true);
 };
\ No newline at end of file
@@ -1,20 +1,80 @@
 #include "Section.h"
 
 #include <HalStorage.h>
+#include <JpegToBmpConverter.h>
 #include <Logging.h>
+#include <PngToBmpConverter.h>
+#include <RenderTimings.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "Fnv.h"
 #include "Page.h"
+#include "SectionAnchors.h"
+#include "SectionLayoutCache.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 12;
+constexpr uint8_t SECTION_FILE_VERSION = 16;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
+
+bool hasExtension(const std::string& href, const char* extension) {
+  const size_t length = strlen(extension);
+  return href.size() >= length &&
+         std::equal(href.end() - length, href.end(), extension,
+                    [](const char a, const char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+}
+
+uint32_t fileSizeOnDisk(const std::string& path) {
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("SCT", path, file)) {
+    return 0;
+  }
+  const auto size = static_cast<uint32_t>(file.size());
+  file.close();
+  return size;
+}
 }  // namespace
 
+uint32_t Section::layoutKeyFor(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  // The header still holds the parameters themselves, so a key collision only costs a rebuild
+  uint32_t hash = fnv::OFFSET_BASIS_32;
+  hash = fnv::update32(hash, &fontId, sizeof(fontId));
+  hash = fnv::update32(hash, &lineCompression, sizeof(lineCompression));
+  hash = fnv::update32(hash, &extraParagraphSpacing, sizeof(extraParagraphSpacing));
+  hash = fnv::update32(hash, &paragraphAlignment, sizeof(paragraphAlignment));
+  hash = fnv::update32(hash, &viewportWidth, sizeof(viewportWidth));
+  hash = fnv::update32(hash, &viewportHeight, sizeof(viewportHeight));
+  hash = fnv::update32(hash, &hyphenationEnabled, sizeof(hyphenationEnabled));
+  hash = fnv::update32(hash, &embeddedStyle, sizeof(embeddedStyle));
+  return hash;
+}
+
+void Section::selectLayout(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                           const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                           const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  layoutKey = layoutKeyFor(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                           viewportHeight, hyphenationEnabled, embeddedStyle);
+  filePath = sectionsDir + "/" + SectionLayoutCache::sectionFileName(spineIndex, layoutKey);
+  closeReadFile();
+}
+
+void Section::closeReadFile() {
+  if (readFile) {
+    readFile.close();
+  }
+  // The loaded page's images were read through it
+  loadedPage.setImageFile(nullptr);
+}
+
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   if (!file) {
     LOG_ERR("SCT", "File not open for writing page %d", pageCount);
@@ -32,6 +92,51 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   return position;
 }
 
+bool Section::storeImage(const std::string& href, const uint16_t maxWidth, const uint16_t maxHeight,
+                         PageImage* image) {
+  const bool isPng = hasExtension(href, ".png");
+  if (!isPng && !hasExtension(href, ".jpg") && !hasExtension(href, ".jpeg")) {
+    LOG_DBG("SCT", "Image %s: format not supported", href.c_str());
+    return false;
+  }
+
+  const uint32_t start = millis();
+  const auto tmpImagePath = epub->getCachePath() + "/.tmp_image";
+  FsFile source;
+  if (!Storage.openFileForWrite("SCT", tmpImagePath, source)) {
+    return false;
+  }
+  const bool extracted = epub->readItemContentsToStream(href, source, 1024);
+  source.close();
+  if (!extracted || !Storage.openFileForRead("SCT", tmpImagePath, source)) {
+    LOG_ERR("SCT", "Image %s: not found in book", href.c_str());
+    Storage.remove(tmpImagePath.c_str());
+    return false;
+  }
+
+  // Ahead of the page that shows it, which is only written once complete
+  const uint32_t offset = file.position();
+  int width = 0, height = 0;
+  const bool converted =
+      isPng ? PngToBmpConverter::pngFileTo1BitBmpStreamToFit(source, file, maxWidth, maxHeight, &width, &height)
+            : JpegToBmpConverter::jpegFileTo1BitBmpStreamToFit(source, file, maxWidth, maxHeight, &width, &height);
+  source.close();
+  Storage.remove(tmpImagePath.c_str());
+  if (!converted) {
+    // The next record overwrites whatever was written
+    file.seek(offset);
+    LOG_ERR("SCT", "Image %s: failed to decode", href.c_str());
+    return false;
+  }
+
+  *image = {offset, static_cast<uint16_t>(width), static_cast<uint16_t>(height)};
+  const unsigned long elapsed = millis() - start;
+  RENDER_TIMINGS.record(RenderTimings::IMAGE_BUILD, elapsed);
+  LOG_DBG("SCT", "Image %s: %dx%d, %u bytes in %lu ms", href.c_str(), width, height,
+          static_cast<uint32_t>(file.position() - offset), elapsed);
+  return true;
+}
+
 void Section::writeSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                      const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                      const uint16_t viewportHeight, const bool hyphenationEnabled,
@@ -55,13 +160,15 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   serialization::writePod(file, hyphenationEnabled);
   serialization::writePod(file, embeddedStyle);
   serialization::writePod(file, pageCount);  // Placeholder for page count (will be initially 0 when written)
-  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset
+  serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset, 0 until the build completes
 }
 
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
-  if (!Storage.openFileForRead("SCT", filePath, file)) {
+  selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+               hyphenationEnabled, embeddedStyle);
+  if (!Storage.exists(filePath.c_str()) || !Storage.openFileForRead("SCT", filePath, file)) {
     return false;
   }
 
@@ -103,23 +210,36 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
     }
   }
 
+  uint32_t lutOffset;
   serialization::readPod(file, pageCount);
+  serialization::readPod(file, lutOffset);
   file.close();
+  if (lutOffset == 0) {
+    // Build was interrupted (power loss, abort) after some pages had been published
+    LOG_ERR("SCT", "Deserialization failed: Section file incomplete");
+    clearCache();
+    return false;
+  }
   LOG_DBG("SCT", "Deserialization succeeded: %d pages", pageCount);
+  SectionLayoutCache::getInstance().touch(sectionsDir, layoutKey);
   return true;
 }
 
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
-bool Section::clearCache() const {
+bool Section::clearCache() {
+  closeReadFile();
   if (!Storage.exists(filePath.c_str())) {
     LOG_DBG("SCT", "Cache does not exist, no action needed");
     return true;
   }
 
+  const uint32_t sizeBytes = fileSizeOnDisk(filePath);
+
   if (!Storage.remove(filePath.c_str())) {
     LOG_ERR("SCT", "Failed to clear cache");
     return false;
   }
+  SectionLayoutCache::getInstance().recordRemoval(sectionsDir, layoutKey, sizeBytes);
 
   LOG_DBG("SCT", "Cache cleared successfully");
   return true;
@@ -128,15 +248,15 @@ bool Section::clearCache() const {
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const std::function<void()>& popupFn) {
+                                const std::function<void()>& popupFn, const std::function<bool()>& shouldAbort,
+                                const std::function<void()>& pagePublishedFn) {
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
   // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    Storage.mkdir(sectionsDir.c_str());
-  }
+  Storage.mkdir(sectionsDir.c_str());
+  selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+               hyphenationEnabled, embeddedStyle);
 
   // Retry logic for SD card timing issues
   bool success = false;
@@ -174,12 +294,16 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 
   LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
 
+  // Overwritten below, the layout's size is corrected once the new file is complete
+  const uint32_t replacedBytes = fileSizeOnDisk(filePath);
   if (!Storage.openFileForWrite("SCT", filePath, file)) {
     return false;
   }
+  pageCount = 0;
   writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
                          viewportHeight, hyphenationEnabled, embeddedStyle);
-  std::vector<uint32_t> lut = {};
+  lut.clear();
+  building = true;
 
   CssParser* cssParser = nullptr;
   if (embeddedStyle) {
@@ -190,19 +314,55 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
       }
     }
   }
+  SectionAnchors anchors;
+  const std::string imageDir = localPath.substr(0, localPath.find_last_of('/') + 1);
+  int imageCount = 0;
+  uint32_t imageMs = 0;
   ChapterHtmlSlimParser visitor(
       tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, popupFn, cssParser);
+      [this, &pagePublishedFn](std::unique_ptr<Page> page) {
+        const uint32_t position = this->onPageComplete(std::move(page));
+        lut.emplace_back(position);
+        if (position != 0 && pagePublishedFn) {
+          pagePublishedFn();
+        }
+      },
+      embeddedStyle, popupFn, cssParser, shouldAbort,
+      [&anchors](const std::string_view id, const uint16_t page) { anchors.add(id, page); },
+      [this, &imageDir, &imageCount, &imageMs](const std::string& src, const uint16_t maxWidth,
+                                               const uint16_t maxHeight, PageImage* image) {
+        // Inline data isn't supported, everything else is relative to the chapter
+        if (src.compare(0, 5, "data:") == 0) {
+          return false;
+        }
+        const uint32_t start = millis();
+        const bool stored = storeImage(imageDir + src, maxWidth, maxHeight, image);
+        if (stored) {
+          imageCount++;
+          imageMs += millis() - start;
+        }
+        return stored;
+      });
   Hyphenator::setPreferredLanguage(epub->getLanguage());
+  const uint32_t packPageReadsBefore = Hyphenator::packPageReads();
   success = visitor.parseAndBuildPages();
+  building = false;
+  if (hyphenationEnabled) {
+    LOG_DBG("SCT", "Hyphenation: %u pattern pack page reads", Hyphenator::packPageReads() - packPageReadsBefore);
+  }
 
   Storage.remove(tmpHtmlPath.c_str());
+  if (imageCount > 0) {
+    LOG_DBG("SCT", "Images: %d decoded in %u ms", imageCount, imageMs);
+  }
   if (!success) {
     LOG_ERR("SCT", "Failed to parse XML and build pages");
     file.close();
     Storage.remove(filePath.c_str());
+    SectionLayoutCache::getInstance().recordRemoval(sectionsDir, layoutKey, replacedBytes);
+    lut.clear();
+    pageCount = 0;
     if (cssParser) {
       cssParser->clear();
     }
@@ -220,38 +380,96 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     serialization::writePod(file, pos);
   }
 
+  lut.clear();
+  lut.shrink_to_fit();
+
   if (hasFailedLutRecords) {
     LOG_ERR("SCT", "Failed to write LUT due to invalid page positions");
     file.close();
     Storage.remove(filePath.c_str());
+    SectionLayoutCache::getInstance().recordRemoval(sectionsDir, layoutKey, replacedBytes);
+    pageCount = 0;
     return false;
   }
 
+  // Anchor table right after the LUT
+  if (!anchors.write(file)) {
+    LOG_ERR("SCT", "Failed to write anchor table");
+    file.close();
+    Storage.remove(filePath.c_str());
+    SectionLayoutCache::getInstance().recordRemoval(sectionsDir, layoutKey, replacedBytes);
+    pageCount = 0;
+    return false;
+  }
+  LOG_DBG("SCT", "Anchor table: %u ids", static_cast<unsigned>(anchors.size()));
+
   // Go back and write LUT offset
   file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
+  const auto sizeBytes = static_cast<uint32_t>(file.size());
   file.close();
   if (cssParser) {
     cssParser->clear();
   }
+  SectionLayoutCache::getInstance().recordBuild(sectionsDir, layoutKey, replacedBytes, sizeBytes);
   return true;
 }
 
-std::unique_ptr<Page> Section::loadPageFromSectionFile() {
-  if (!Storage.openFileForRead("SCT", filePath, file)) {
+const Page* Section::loadPage(const int index) {
+  RenderTimings::Scope timer(RenderTimings::PAGE_LOAD);
+  if (building) {
+    if (index < 0 || index >= static_cast<int>(lut.size())) {
+      return nullptr;
+    }
+    // Still being written through `file`, flush so a second handle sees the published pages
+    file.flush();
+  }
+
+  if (building || readFilePartial) {
+    closeReadFile();
+  }
+  if (!readFile && !Storage.openFileForRead("SCT", filePath, readFile)) {
     return nullptr;
   }
+  readFilePartial = building;
 
-  file.seek(HEADER_SIZE - sizeof(uint32_t));
-  uint32_t lutOffset;
-  serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
   uint32_t pagePos;
-  serialization::readPod(file, pagePos);
-  file.seek(pagePos);
+  if (building) {
+    pagePos = lut[index];
+    if (pagePos == 0) {
+      return nullptr;
+    }
+  } else {
+    readFile.seek(HEADER_SIZE - sizeof(uint32_t));
+    uint32_t lutOffset;
+    serialization::readPod(readFile, lutOffset);
+    readFile.seek(lutOffset + sizeof(uint32_t) * index);
+    serialization::readPod(readFile, pagePos);
+  }
+  readFile.seek(pagePos);
 
-  auto page = Page::deserialize(file);
-  file.close();
-  return page;
+  const bool loaded = loadedPage.deserialize(readFile, pageLoadBuffers);
+  // Its images are stored in the same file
+  loadedPage.setImageFile(&readFile);
+  return loaded ? &loadedPage : nullptr;
+}
+
+int Section::getPageForAnchor(const std::string& anchor) {
+  if (building || anchor.empty()) {
+    return -1;
+  }
+
+  FsFile anchorFile;
+  if (!Storage.openFileForRead("SCT", filePath, anchorFile)) {
+    return -1;
+  }
+  const uint32_t start = millis();
+  anchorFile.seek(HEADER_SIZE - sizeof(uint32_t));
+  uint32_t lutOffset;
+  serialization::readPod(anchorFile, lutOffset);
+  const int page = SectionAnchors::findPage(anchorFile, lutOffset + sizeof(uint32_t) * pageCount, anchor);
+  anchorFile.close();
+  LOG_DBG("SCT", "Anchor #%s: page %d (%lu ms)", anchor.c_str(), page, millis() - start);
+  return page < pageCount ? page : -1;
 }
@@ -1,39 +1,73 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
+#include "Page.h"
 
-class Page;
 class GfxRenderer;
 
 class Section {
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
+  std::string sectionsDir;
+  // One file per layout, chosen by selectLayout() once the layout parameters are known
   std::string filePath;
+  uint32_t layoutKey = 0;
   FsFile file;
+  // Pages and their images are read through this handle, kept open between page turns
+  FsFile readFile;
+  // readFile was opened while the file was being written and doesn't see the pages published since
+  bool readFilePartial = false;
+  // Page offsets while the section file is being written, pages can be read back before the LUT is on disk
+  std::vector<uint32_t> lut;
+  bool building = false;
+  // The page last loaded, reused so page turns don't allocate
+  Page loadedPage;
+  Page::LoadBuffers pageLoadBuffers;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void closeReadFile();
+  // Decodes the image at href into the section file being written, as a 1-bit BMP that fits the box
+  bool storeImage(const std::string& href, uint16_t maxWidth, uint16_t maxHeight, PageImage* image);
+  void selectLayout(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                    uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
 
  public:
   uint16_t pageCount = 0;
   int currentPage = 0;
 
+  // Key of the layout the parameters produce, which names the section files built for it
+  static uint32_t layoutKeyFor(int fontId, float lineCompression, bool extraParagraphSpacing,
+                               uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                               bool hyphenationEnabled, bool embeddedStyle);
+
   explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
       : epub(epub),
         spineIndex(spineIndex),
         renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
-  ~Section() = default;
+        sectionsDir(epub->getCachePath() + "/sections") {}
+  ~Section() { closeReadFile(); }
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
-  bool clearCache() const;
+  bool clearCache();
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
-                         const std::function<void()>& popupFn = nullptr);
-  std::unique_ptr<Page> loadPageFromSectionFile();
+                         const std::function<void()>& popupFn = nullptr,
+                         const std::function<bool()>& shouldAbort = nullptr,
+                         const std::function<void()>& pagePublishedFn = nullptr);
+  // True while createSectionFile() is running. pageCount then only covers the pages laid out so far, all of which
+  // can already be loaded; pagePublishedFn is called each time it grows.
+  bool isBuilding() const { return building; }
+  // Loads currentPage. The page stays valid until the next call.
+  const Page* loadPageFromSectionFile() { return loadPage(currentPage); }
+  // Loads the given page, sharing the buffer loadPageFromSectionFile() uses
+  const Page* loadPage(int index);
+  // Page an element id (the fragment of a TOC entry or link) lands on, -1 if unknown. Only once the build is done.
+  int getPageForAnchor(const std::string& anchor);
 };
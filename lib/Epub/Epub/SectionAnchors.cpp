@@ -0,0 +1,91 @@
+#include "SectionAnchors.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+constexpr uint32_t ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint16_t);
+}  // namespace
+
+void SectionAnchors::add(const std::string_view id, const uint16_t page) {
+  if (id.empty() || id.size() > MAX_ID_LENGTH) {
+    return;
+  }
+  anchors.push_back({static_cast<uint32_t>(names.size()), static_cast<uint8_t>(id.size()), page});
+  names.insert(names.end(), id.begin(), id.end());
+}
+
+bool SectionAnchors::write(FsFile& file) {
+  // Stable, so the first of several equal ids stays in front and survives the dedup
+  std::stable_sort(anchors.begin(), anchors.end(),
+                   [this](const Anchor& a, const Anchor& b) { return nameOf(a) < nameOf(b); });
+  anchors.erase(std::unique(anchors.begin(), anchors.end(),
+                            [this](const Anchor& a, const Anchor& b) { return nameOf(a) == nameOf(b); }),
+                anchors.end());
+
+  // Written straight from `anchors` and `names`, which are as large as the table itself. Names go in table order, so
+  // a lookup reads neighbouring ones.
+  const auto count = static_cast<uint32_t>(anchors.size());
+  bool ok = file.write(&count, sizeof(count)) == sizeof(count);
+  uint32_t nameOffset = 0;
+  for (const auto& anchor : anchors) {
+    uint8_t entry[ENTRY_SIZE];
+    memcpy(entry, &nameOffset, sizeof(nameOffset));
+    entry[sizeof(nameOffset)] = anchor.nameLength;
+    memcpy(entry + sizeof(nameOffset) + sizeof(anchor.nameLength), &anchor.page, sizeof(anchor.page));
+    ok = ok && file.write(entry, ENTRY_SIZE) == ENTRY_SIZE;
+    nameOffset += anchor.nameLength;
+  }
+  for (const auto& anchor : anchors) {
+    ok = ok && file.write(names.data() + anchor.nameOffset, anchor.nameLength) == anchor.nameLength;
+  }
+  return ok;
+}
+
+int SectionAnchors::findPage(FsFile& file, const uint32_t tableOffset, const std::string_view id) {
+  if (id.empty() || id.size() > MAX_ID_LENGTH) {
+    return -1;
+  }
+
+  uint32_t count = 0;
+  file.seek(tableOffset);
+  serialization::readPod(file, count);
+  const uint32_t namesOffset = tableOffset + sizeof(count) + count * ENTRY_SIZE;
+
+  uint8_t entry[ENTRY_SIZE];
+  char name[MAX_ID_LENGTH];
+  uint32_t low = 0, high = count;
+  while (low < high) {
+    const uint32_t mid = low + (high - low) / 2;
+    file.seek(tableOffset + sizeof(count) + mid * ENTRY_SIZE);
+    if (file.read(entry, ENTRY_SIZE) != static_cast<int>(ENTRY_SIZE)) {
+      LOG_ERR("SCT", "Anchor table truncated");
+      return -1;
+    }
+    uint32_t nameOffset;
+    uint16_t page;
+    memcpy(&nameOffset, entry, sizeof(nameOffset));
+    const uint8_t nameLength = entry[sizeof(nameOffset)];
+    memcpy(&page, entry + sizeof(nameOffset) + sizeof(nameLength), sizeof(page));
+
+    file.seek(namesOffset + nameOffset);
+    if (file.read(name, nameLength) != static_cast<int>(nameLength)) {
+      LOG_ERR("SCT", "Anchor table truncated");
+      return -1;
+    }
+    const int order = std::string_view(name, nameLength).compare(id);
+    if (order == 0) {
+      return page;
+    }
+    if (order < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return -1;
+}
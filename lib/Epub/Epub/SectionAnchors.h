@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class FsFile;
+
+// The element ids of a section and the page each one lands on, so TOC entries and links to "chapter.xhtml#id" can
+// open the right page. Collected while the section is built and written after its LUT as a table sorted by id:
+//
+//   uint32_t count
+//   count x { uint32_t nameOffset, uint8_t nameLength, uint16_t page }
+//   names, back to back
+//
+// Entries have a fixed size, so a lookup is a binary search over the file that never loads the whole table.
+class SectionAnchors {
+  struct Anchor {
+    uint32_t nameOffset;
+    uint8_t nameLength;
+    uint16_t page;
+  };
+
+  std::vector<char> names;
+  std::vector<Anchor> anchors;
+
+  std::string_view nameOf(const Anchor& anchor) const { return {names.data() + anchor.nameOffset, anchor.nameLength}; }
+
+ public:
+  // Ids longer than this are not recorded
+  static constexpr size_t MAX_ID_LENGTH = UINT8_MAX;
+
+  void add(std::string_view id, uint16_t page);
+  size_t size() const { return anchors.size(); }
+  // Writes the table at the current file position. When an id occurs more than once, its first page is kept.
+  bool write(FsFile& file);
+
+  // Page of `id` in the table starting at tableOffset, -1 if the section has no such id
+  static int findPage(FsFile& file, uint32_t tableOffset, std::string_view id);
+};
@@ -0,0 +1,260 @@
+#include "SectionLayoutCache.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr uint8_t LAYOUTS_FILE_VERSION = 2;
+constexpr char LAYOUTS_FILE[] = "/layouts.bin";
+
+struct SectionFile {
+  std::string name;
+  uint32_t layoutKey;
+  uint32_t sizeBytes;
+};
+
+// "<spine>_<key>.bin" gives the layout key. "<spine>.bin" is from before layouts were kept apart.
+bool parseSectionFileName(const char* name, uint32_t* layoutKey, bool* legacy) {
+  char* end;
+  strtoul(name, &end, 10);
+  if (end == name) {
+    return false;
+  }
+  if (strcmp(end, ".bin") == 0) {
+    *legacy = true;
+    return true;
+  }
+  if (*end != '_') {
+    return false;
+  }
+  const char* keyStart = end + 1;
+  *layoutKey = static_cast<uint32_t>(strtoul(keyStart, &end, 16));
+  *legacy = false;
+  return end - keyStart == 8 && strcmp(end, ".bin") == 0;
+}
+
+// Lists the section files in `dir`, deleting the ones from before layouts were kept apart
+std::vector<SectionFile> listSectionFiles(const std::string& dir) {
+  std::vector<SectionFile> files;
+  auto root = Storage.open(dir.c_str());
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return files;
+  }
+
+  std::vector<std::string> legacyFiles;
+  char name[64];
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    uint32_t key = 0;
+    bool legacy = false;
+    if (!file.isDirectory() && parseSectionFileName(name, &key, &legacy)) {
+      if (legacy) {
+        legacyFiles.emplace_back(name);
+      } else {
+        files.push_back({name, key, static_cast<uint32_t>(file.size())});
+      }
+    }
+    file.close();
+  }
+  root.close();
+
+  for (const auto& legacyName : legacyFiles) {
+    Storage.remove((dir + "/" + legacyName).c_str());
+  }
+  return files;
+}
+}  // namespace
+
+SectionLayoutCache SectionLayoutCache::instance;
+
+std::string SectionLayoutCache::sectionFileName(const int spineIndex, const uint32_t layoutKey) {
+  char name[32];
+  snprintf(name, sizeof(name), "%d_%08x.bin", spineIndex, static_cast<unsigned>(layoutKey));
+  return name;
+}
+
+SectionLayoutCache::Layout& SectionLayoutCache::findOrCreate(const uint32_t key) {
+  auto it = std::find_if(layouts.begin(), layouts.end(), [key](const Layout& layout) { return layout.key == key; });
+  if (it != layouts.end()) {
+    return *it;
+  }
+  layouts.push_back({key, 0, 0});
+  return layouts.back();
+}
+
+void SectionLayoutCache::select(const std::string& dir) {
+  if (dir == sectionsDir) {
+    return;
+  }
+  sectionsDir = dir;
+  if (!loadFromFile()) {
+    rebuildFromDisk();
+    saveToFile();
+  }
+}
+
+// Layouts found on disk count as least recently used
+void SectionLayoutCache::rebuildFromDisk() {
+  layouts.clear();
+  useCounter = 0;
+  for (const auto& file : listSectionFiles(sectionsDir)) {
+    findOrCreate(file.layoutKey).sizeBytes += file.sizeBytes;
+  }
+}
+
+void SectionLayoutCache::touch(const std::string& dir, const uint32_t layoutKey) {
+  select(dir);
+  auto& layout = findOrCreate(layoutKey);
+  // Reading on in the same layout is the common case, skip the write
+  if (layout.lastUse != 0 && layout.lastUse == useCounter) {
+    return;
+  }
+  layout.lastUse = ++useCounter;
+  saveToFile();
+}
+
+void SectionLayoutCache::recordBuild(const std::string& dir, const uint32_t layoutKey, const uint32_t replacedBytes,
+                                     const uint32_t sizeBytes) {
+  select(dir);
+  auto& layout = findOrCreate(layoutKey);
+  layout.lastUse = ++useCounter;
+  layout.sizeBytes = layout.sizeBytes - std::min(layout.sizeBytes, replacedBytes) + sizeBytes;
+  enforceBudget(layoutKey);
+  saveToFile();
+}
+
+void SectionLayoutCache::recordRemoval(const std::string& dir, const uint32_t layoutKey, const uint32_t sizeBytes) {
+  if (sizeBytes == 0) {
+    return;
+  }
+  select(dir);
+  auto& layout = findOrCreate(layoutKey);
+  layout.sizeBytes -= std::min(layout.sizeBytes, sizeBytes);
+  saveToFile();
+}
+
+void SectionLayoutCache::invalidate() {
+  sectionsDir.clear();
+  layouts.clear();
+  useCounter = 0;
+}
+
+void SectionLayoutCache::enforceBudget(const uint32_t keepKey) {
+  const auto totalBytes = [this] {
+    uint64_t total = 0;
+    for (const auto& layout : layouts) {
+      total += layout.sizeBytes;
+    }
+    return total;
+  };
+  if (totalBytes() <= BUDGET_BYTES) {
+    return;
+  }
+
+  // Files have to be listed to delete them anyway, which also corrects sizes that drifted from what is on disk
+  const uint32_t start = millis();
+  const auto files = listSectionFiles(sectionsDir);
+  for (auto& layout : layouts) {
+    layout.sizeBytes = 0;
+  }
+  for (const auto& file : files) {
+    findOrCreate(file.layoutKey).sizeBytes += file.sizeBytes;
+  }
+  layouts.erase(std::remove_if(layouts.begin(), layouts.end(),
+                               [keepKey](const Layout& layout) {
+                                 return layout.sizeBytes == 0 && layout.key != keepKey;
+                               }),
+                layouts.end());
+
+  uint64_t total = totalBytes();
+  int evicted = 0;
+  while (total > BUDGET_BYTES) {
+    auto victim = layouts.end();
+    for (auto it = layouts.begin(); it != layouts.end(); ++it) {
+      if (it->key != keepKey && (victim == layouts.end() || it->lastUse < victim->lastUse)) {
+        victim = it;
+      }
+    }
+    if (victim == layouts.end()) {
+      break;
+    }
+
+    uint32_t freed = 0;
+    for (const auto& file : files) {
+      if (file.layoutKey == victim->key && Storage.remove((sectionsDir + "/" + file.name).c_str())) {
+        freed += file.sizeBytes;
+      }
+    }
+    LOG_INF("SLC", "Evicted layout %08x (%u KB, last use #%u)", static_cast<unsigned>(victim->key), freed / 1024,
+            victim->lastUse);
+    total -= victim->sizeBytes;
+    layouts.erase(victim);
+    evicted++;
+  }
+
+  LOG_DBG("SLC", "Section layouts: %u cached, %u KB of %u KB budget, %d evicted in %lu ms",
+          static_cast<unsigned>(layouts.size()), static_cast<unsigned>(total / 1024), BUDGET_BYTES / 1024, evicted,
+          millis() - start);
+}
+
+bool SectionLayoutCache::saveToFile() const {
+  FsFile outputFile;
+  if (!Storage.openFileForWrite("SLC", sectionsDir + LAYOUTS_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, LAYOUTS_FILE_VERSION);
+  serialization::writePod(outputFile, useCounter);
+  const uint8_t count = static_cast<uint8_t>(std::min<size_t>(layouts.size(), UINT8_MAX));
+  serialization::writePod(outputFile, count);
+  for (uint8_t i = 0; i < count; i++) {
+    serialization::writePod(outputFile, layouts[i].key);
+    serialization::writePod(outputFile, layouts[i].lastUse);
+    serialization::writePod(outputFile, layouts[i].sizeBytes);
+  }
+
+  outputFile.close();
+  return true;
+}
+
+bool SectionLayoutCache::loadFromFile() {
+  layouts.clear();
+  useCounter = 0;
+
+  const std::string path = sectionsDir + LAYOUTS_FILE;
+  if (!Storage.exists(path.c_str())) {
+    return false;
+  }
+  FsFile inputFile;
+  if (!Storage.openFileForRead("SLC", path, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != LAYOUTS_FILE_VERSION) {
+    LOG_ERR("SLC", "Deserialization failed: Unknown version %u", version);
+    inputFile.close();
+    return false;
+  }
+
+  uint8_t count;
+  serialization::readPod(inputFile, useCounter);
+  serialization::readPod(inputFile, count);
+  layouts.resize(count);
+  for (auto& layout : layouts) {
+    serialization::readPod(inputFile, layout.key);
+    serialization::readPod(inputFile, layout.lastUse);
+    serialization::readPod(inputFile, layout.sizeBytes);
+  }
+
+  inputFile.close();
+  return true;
+}
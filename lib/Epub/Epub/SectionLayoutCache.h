@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Section files are named after a key of the layout they were built for (font, spacing, viewport, ...), so several
+// layouts of a book can be cached side by side and switching a setting back or rotating the device reuses what was
+// built before. This tracks when each layout of one book was last used and how much space its section files take, in
+// sections/layouts.bin, and removes the least recently used layouts once the book's section files go over budget.
+//
+// The index of the book being read stays in memory and is updated as sections are opened, built and removed. The
+// sections directory is only listed when the index is missing or outdated, or to delete the files of an evicted layout.
+class SectionLayoutCache {
+  struct Layout {
+    uint32_t key;
+    // Monotonic per book, higher is more recent
+    uint32_t lastUse;
+    // Combined size of the layout's section files
+    uint32_t sizeBytes;
+  };
+
+  // Static instance
+  static SectionLayoutCache instance;
+
+  // Book whose index is loaded, empty if none
+  std::string sectionsDir;
+  std::vector<Layout> layouts;
+  uint32_t useCounter = 0;
+
+  void select(const std::string& dir);
+  bool loadFromFile();
+  void rebuildFromDisk();
+  bool saveToFile() const;
+  Layout& findOrCreate(uint32_t key);
+  void enforceBudget(uint32_t keepKey);
+
+ public:
+  // Room for a few full-book layouts
+  static constexpr uint32_t BUDGET_BYTES = 8 * 1024 * 1024;
+
+  // Get singleton instance
+  static SectionLayoutCache& getInstance() { return instance; }
+
+  static std::string sectionFileName(int spineIndex, uint32_t layoutKey);
+
+  // Mark a layout as the most recently used. Call when a section file is opened.
+  void touch(const std::string& dir, uint32_t layoutKey);
+
+  // Mark a layout as used after one of its section files was written, `replacedBytes` being the size of the file it
+  // overwrote, and remove other layouts until the section files fit the budget. The layout just built is never removed.
+  void recordBuild(const std::string& dir, uint32_t layoutKey, uint32_t replacedBytes, uint32_t sizeBytes);
+
+  // Account for a section file of the layout that was deleted
+  void recordRemoval(const std::string& dir, uint32_t layoutKey, uint32_t sizeBytes);
+
+  // Drop the index held in memory, e.g. after the book's cache directory was deleted
+  void invalidate();
+};
@@ -1,15 +1,13 @@
 #pragma once
 #include <EpdFontFamily.h>
-#include <HalStorage.h>
 
 #include <list>
-#include <memory>
 #include <string>
 
 #include "Block.h"
 #include "BlockStyle.h"
 
-// Represents a line of text on a page
+// A line of text as laid out by ParsedText, copied into a Page by Page::addLine()
 class TextBlock final : public Block {
  private:
   std::list<std::string> words;
@@ -27,11 +25,10 @@ class TextBlock final : public Block {
   ~TextBlock() override = default;
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   const BlockStyle& getBlockStyle() const { return blockStyle; }
+  const std::list<std::string>& getWords() const { return words; }
+  const std::list<uint16_t>& getWordXpos() const { return wordXpos; }
+  const std::list<EpdFontFamily::Style>& getWordStyles() const { return wordStyles; }
   bool isEmpty() override { return words.empty(); }
   void layout(GfxRenderer& renderer) override {};
-  // given a renderer works out where to break the words into lines
-  void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
-  bool serialize(FsFile& file) const;
-  static std::unique_ptr<TextBlock> deserialize(FsFile& file);
 };
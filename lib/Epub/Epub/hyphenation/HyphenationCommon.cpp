@@ -135,14 +135,14 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
-  if (cps.empty()) {
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo*& cps, size_t& count) {
+  if (count == 0) {
     return;
   }
 
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
+  if (count >= 3) {
+    int end = static_cast<int>(count) - 1;
     while (end >= 0 && isPunctuation(cps[end].value)) {
       --end;
     }
@@ -152,17 +152,46 @@ void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
         --pos;
       }
       if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+        count = static_cast<size_t>(pos);
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  while (count > 0 && isPunctuation(cps[0].value)) {
+    ++cps;
+    --count;
+  }
+  while (count > 0 && isPunctuation(cps[count - 1].value)) {
+    --count;
+  }
+}
+
+void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+  const CodepointInfo* begin = cps.data();
+  size_t count = cps.size();
+  trimSurroundingPunctuationAndFootnote(begin, count);
+
+  const size_t start = static_cast<size_t>(begin - cps.data());
+  cps.erase(cps.begin() + start + count, cps.end());
+  cps.erase(cps.begin(), cps.begin() + start);
+}
+
+size_t collectCodepoints(const std::string& word, CodepointInfo* out) {
+  // Every codepoint takes at least one byte, so this bounds the output as well
+  if (word.size() > MAX_HYPHENATION_WORD_BYTES) {
+    return 0;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+
+  size_t count = 0;
+  const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
+  const unsigned char* ptr = base;
+  while (*ptr != 0) {
+    const unsigned char* current = ptr;
+    const uint32_t cp = utf8NextCodepoint(&ptr);
+    out[count++] = {cp, static_cast<size_t>(current - base)};
   }
+
+  return count;
 }
 
 std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
@@ -23,3 +23,14 @@ bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
 std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+
+// Longest word the hyphenation path handles, in UTF-8 bytes: the parser's MAX_WORD_SIZE of 200 plus the em space
+// ParsedText puts in front of indented paragraphs, rounded up. Working buffers are sized from this so hyphenating a
+// word never touches the heap. Longer words are not hyphenated.
+constexpr size_t MAX_HYPHENATION_WORD_BYTES = 208;
+
+// Buffer-based variants of the above. `out` must hold MAX_HYPHENATION_WORD_BYTES entries; returns the codepoint count,
+// or 0 if the word is too long.
+size_t collectCodepoints(const std::string& word, CodepointInfo* out);
+// Narrows the range to the word itself instead of erasing from a vector
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo*& cps, size_t& count);
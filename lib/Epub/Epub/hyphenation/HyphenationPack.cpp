@@ -0,0 +1,90 @@
+#include "HyphenationPack.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// magic[4], version, script, minPrefix, minSuffix, trie size (LE32), then zero padding up to DATA_OFFSET
+constexpr size_t HEADER_SIZE = 12;
+
+uint32_t readLe32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+}  // namespace
+
+bool HyphenationPack::open(ReadFn readFn, const size_t memoryBudget) {
+  uint8_t header[HEADER_SIZE];
+  if (!readFn || !readFn(0, header, sizeof(header))) {
+    return false;
+  }
+  if (memcmp(header, MAGIC, sizeof(MAGIC)) != 0 || header[4] != VERSION ||
+      header[5] > static_cast<uint8_t>(Script::CYRILLIC) || header[6] == 0 || header[7] == 0) {
+    return false;
+  }
+  const uint32_t size = readLe32(header + 8);
+  const size_t pageCount = (static_cast<size_t>(size) + PAGE_SIZE - 1) / PAGE_SIZE;
+  const size_t slotCount = std::min(pageCount, std::max<size_t>(memoryBudget / PAGE_SIZE, 1));
+  // Too small to hold the root offset, or too large to index pages with 16 bits
+  if (size < 4 || pageCount >= NO_SLOT) {
+    return false;
+  }
+
+  read = std::move(readFn);
+  script_ = static_cast<Script>(header[5]);
+  minPrefix_ = header[6];
+  minSuffix_ = header[7];
+  trieSize = size;
+
+  pages.reset(new uint8_t[slotCount * PAGE_SIZE]);
+  pageSlot.assign(pageCount, NO_SLOT);
+  slotPage.assign(slotCount, NO_PAGE);
+  slotLastUse.assign(slotCount, 0);
+  useCounter = 0;
+  currentPage = NO_PAGE;
+  currentData = nullptr;
+  stats_ = {};
+  return true;
+}
+
+void HyphenationPack::selectPage(const uint32_t page) {
+  useCounter++;
+
+  uint16_t slot = pageSlot[page];
+  if (slot != NO_SLOT) {
+    stats_.pageHits++;
+  } else {
+    stats_.pageMisses++;
+    if (isResident()) {
+      // Room for every page, no eviction
+      slot = static_cast<uint16_t>(page);
+    } else {
+      // Least recently used slot, empty ones first
+      slot = 0;
+      for (uint16_t i = 1; i < slotPage.size(); i++) {
+        if (slotLastUse[i] < slotLastUse[slot]) {
+          slot = i;
+        }
+      }
+      if (slotPage[slot] != NO_PAGE) {
+        pageSlot[slotPage[slot]] = NO_SLOT;
+      }
+    }
+
+    uint8_t* data = pages.get() + slot * PAGE_SIZE;
+    const size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+    const size_t length = std::min(PAGE_SIZE, trieSize - offset);
+    if (!read(static_cast<uint32_t>(DATA_OFFSET + offset), data, length)) {
+      // Zeroed bytes decode as nodes without transitions, so a failed read only costs words their breaks until the
+      // page is evicted
+      stats_.readErrors++;
+      memset(data, 0, PAGE_SIZE);
+    }
+    pageSlot[page] = slot;
+    slotPage[slot] = page;
+  }
+
+  slotLastUse[slot] = useCounter;
+  currentPage = page;
+  currentData = pages.get() + slot * PAGE_SIZE;
+}
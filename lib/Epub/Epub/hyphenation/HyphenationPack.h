@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Liang patterns read on demand from a pattern pack file (see docs/hyphenation-trie-format.md) instead of being
+// compiled into flash. The trie is the same hypher blob the generated headers embed, read in fixed size pages as the
+// walk touches them. Memory use is bounded: tries that fit the budget end up fully resident after a few words, larger
+// ones are paged through it.
+class HyphenationPack {
+ public:
+  // Reads `length` bytes at `offset` from the start of the pack file
+  using ReadFn = std::function<bool(uint32_t offset, uint8_t* buffer, size_t length)>;
+
+  // One SD sector. The header is padded to a full page so trie pages line up with sectors.
+  static constexpr size_t PAGE_SIZE = 512;
+  static constexpr size_t DATA_OFFSET = PAGE_SIZE;
+  // Fits Russian's trie (~33 KB), the largest one a slim build reads from a pack. Smaller tries only take what they
+  // need.
+  static constexpr size_t DEFAULT_MEMORY_BUDGET = 40 * 1024;
+  static constexpr char MAGIC[4] = {'H', 'Y', 'P', 'K'};
+  static constexpr uint8_t VERSION = 1;
+
+  // Letter classes a pack can ask for, selecting the isLetter/toLower helpers in HyphenationCommon
+  enum class Script : uint8_t { LATIN = 0, CYRILLIC = 1 };
+
+  struct Stats {
+    uint32_t pageHits = 0;
+    uint32_t pageMisses = 0;
+    uint32_t readErrors = 0;
+  };
+
+  // Reads and checks the header. Returns false if this isn't a pack this firmware understands.
+  bool open(ReadFn readFn, size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+  Script script() const { return script_; }
+  uint8_t minPrefix() const { return minPrefix_; }
+  uint8_t minSuffix() const { return minSuffix_; }
+  // Size of the trie, the addressable range for at()
+  size_t size() const { return trieSize; }
+  // Heap held for pages
+  size_t memoryUsed() const { return slotPage.size() * PAGE_SIZE; }
+  // Whether the whole trie fits the budget, so every page is read at most once
+  bool isResident() const { return slotPage.size() == pageSlot.size(); }
+  const Stats& stats() const { return stats_; }
+
+  // Trie byte at `addr`, which must be below size(). Consecutive reads mostly stay on one page, so that case is kept
+  // inline.
+  uint8_t at(const size_t addr) {
+    const uint32_t page = static_cast<uint32_t>(addr / PAGE_SIZE);
+    if (page != currentPage) {
+      selectPage(page);
+    }
+    return currentData[addr % PAGE_SIZE];
+  }
+
+ private:
+  static constexpr uint32_t NO_PAGE = UINT32_MAX;
+  static constexpr uint16_t NO_SLOT = UINT16_MAX;
+
+  ReadFn read;
+  Script script_ = Script::LATIN;
+  uint8_t minPrefix_ = 0;
+  uint8_t minSuffix_ = 0;
+  size_t trieSize = 0;
+
+  std::unique_ptr<uint8_t[]> pages;
+  // Slot holding each trie page, NO_SLOT if not loaded
+  std::vector<uint16_t> pageSlot;
+  std::vector<uint32_t> slotPage;
+  std::vector<uint32_t> slotLastUse;
+  uint32_t useCounter = 0;
+  uint32_t currentPage = NO_PAGE;
+  const uint8_t* currentData = nullptr;
+  Stats stats_;
+
+  void selectPage(uint32_t page);
+};
@@ -0,0 +1,40 @@
+#include "HyphenationPackStorage.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+
+#include <memory>
+
+#include "HyphenationPack.h"
+
+namespace {
+constexpr char PACK_DIR[] = "/hyphenation/";
+constexpr char PACK_EXTENSION[] = ".hyp";
+}  // namespace
+
+bool openHyphenationPackFromStorage(const std::string& primaryTag, HyphenationPack& pack) {
+  const std::string path = PACK_DIR + primaryTag + PACK_EXTENSION;
+  if (!Storage.exists(path.c_str())) {
+    return false;
+  }
+
+  std::shared_ptr<FsFile> file(new FsFile(), [](FsFile* f) {
+    f->close();
+    delete f;
+  });
+  if (!Storage.openFileForRead("HYP", path, *file)) {
+    return false;
+  }
+
+  const auto readFn = [file](const uint32_t offset, uint8_t* buffer, const size_t length) {
+    return file->seek(offset) && file->read(buffer, length) == static_cast<int>(length);
+  };
+  if (!pack.open(readFn)) {
+    LOG_ERR("HYP", "%s is not a supported hyphenation pack", path.c_str());
+    return false;
+  }
+
+  LOG_INF("HYP", "Using %s: %u byte trie, %u bytes in memory%s", path.c_str(), static_cast<unsigned>(pack.size()),
+          static_cast<unsigned>(pack.memoryUsed()), pack.isResident() ? "" : " (paged)");
+  return true;
+}
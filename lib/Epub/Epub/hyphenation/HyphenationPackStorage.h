@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+class HyphenationPack;
+
+// Opens /hyphenation/<primaryTag>.hyp from the SD card. Installed with Hyphenator::setPackOpener() at boot; the file
+// stays open for as long as the pack is in use.
+bool openHyphenationPackFromStorage(const std::string& primaryTag, HyphenationPack& pack);
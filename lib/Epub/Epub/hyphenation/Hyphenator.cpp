@@ -1,18 +1,65 @@
 #include "Hyphenator.h"
 
+#include <memory>
 #include <vector>
 
 #include "HyphenationCommon.h"
+#include "HyphenationPack.h"
 #include "LanguageRegistry.h"
 
 const LanguageHyphenator* Hyphenator::cachedHyphenator_ = nullptr;
 
 namespace {
 
-// Maps a BCP-47 language tag to a language-specific hyphenator.
-const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
-  if (langTag.empty()) return nullptr;
+Hyphenator::PackOpener packOpener = nullptr;
+
+// The pattern pack currently in use, if the preferred language has no built-in patterns
+struct LoadedPack {
+  std::string primaryTag;
+  HyphenationPack pack;
+  std::unique_ptr<LanguageHyphenator> hyphenator;
+};
+std::unique_ptr<LoadedPack> loadedPack;
+// Last language found to have no pack, so building its sections doesn't hit the SD card every time
+std::string missingPackTag;
+// Bumped whenever loadedPack changes, as a new pack can land at the address of the one it replaces
+uint32_t packGeneration = 0;
+
+void releasePack() {
+  if (loadedPack) {
+    loadedPack.reset();
+    packGeneration++;
+  }
+}
+
+const LanguageHyphenator* hyphenatorForPack(const std::string& primary) {
+  if (loadedPack && loadedPack->primaryTag == primary) {
+    return loadedPack->hyphenator.get();
+  }
+  // Drop the previous language's pages before reading the next one
+  releasePack();
+  if (!packOpener || primary == missingPackTag) {
+    return nullptr;
+  }
 
+  std::unique_ptr<LoadedPack> candidate(new LoadedPack());
+  if (!packOpener(primary, candidate->pack)) {
+    missingPackTag = primary;
+    return nullptr;
+  }
+  HyphenationPack& pack = candidate->pack;
+  const bool cyrillic = pack.script() == HyphenationPack::Script::CYRILLIC;
+  candidate->primaryTag = primary;
+  candidate->hyphenator.reset(new LanguageHyphenator(pack, cyrillic ? isCyrillicLetter : isLatinLetter,
+                                                     cyrillic ? toLowerCyrillic : toLowerLatin, pack.minPrefix(),
+                                                     pack.minSuffix()));
+  loadedPack = std::move(candidate);
+  packGeneration++;
+  return loadedPack->hyphenator.get();
+}
+
+// Maps a BCP-47 language tag to a language-specific hyphenator, from the built-in patterns or else a pattern pack.
+const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   // Extract primary subtag and normalize to lowercase (e.g., "en-US" -> "en").
   std::string primary;
   primary.reserve(langTag.size());
@@ -21,22 +68,30 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
     if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
     primary.push_back(c);
   }
-  if (primary.empty()) return nullptr;
 
-  return getLanguageHyphenatorForPrimaryTag(primary);
+  const LanguageHyphenator* builtIn = primary.empty() ? nullptr : getLanguageHyphenatorForPrimaryTag(primary);
+  if (builtIn || primary.empty()) {
+    releasePack();
+    return builtIn;
+  }
+  return hyphenatorForPack(primary);
 }
 
+// Per-word working buffers, reused so hyphenating a word doesn't allocate. Like the preferred language, they assume one
+// caller at a time.
+CodepointInfo scratchCodepoints[MAX_HYPHENATION_WORD_BYTES];
+uint8_t scratchIndexes[MAX_HYPHENATION_WORD_BYTES];
+
 // Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
+size_t byteOffsetForIndex(const CodepointInfo* cps, const size_t count, const size_t index) {
+  return (index < count) ? cps[index].byteOffset : (count == 0 ? 0 : cps[count - 1].byteOffset);
 }
 
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
-
+// Appends break information for explicit hyphen markers in the given codepoints.
+void appendExplicitBreakInfos(const CodepointInfo* cps, const size_t count,
+                              std::vector<Hyphenator::BreakInfo>& breaks) {
   // Scan every codepoint looking for explicit/soft hyphen markers that are surrounded by letters.
-  for (size_t i = 1; i + 1 < cps.size(); ++i) {
+  for (size_t i = 1; i + 1 < count; ++i) {
     const uint32_t cp = cps[i].value;
     if (!isExplicitHyphen(cp) || !isAlphabetic(cps[i - 1].value) || !isAlphabetic(cps[i + 1].value)) {
       continue;
@@ -44,54 +99,63 @@ std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<Cod
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
     breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
   }
-
-  return breaks;
 }
 
 }  // namespace
 
 std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
+  std::vector<BreakInfo> breaks;
+  breakOffsets(word, includeFallback, breaks);
+  return breaks;
+}
+
+void Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, std::vector<BreakInfo>& breaks) {
+  breaks.clear();
   if (word.empty()) {
-    return {};
+    return;
   }
 
   // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
-  trimSurroundingPunctuationAndFootnote(cps);
+  const CodepointInfo* cps = scratchCodepoints;
+  size_t count = collectCodepoints(word, scratchCodepoints);
+  trimSurroundingPunctuationAndFootnote(cps, count);
   const auto* hyphenator = cachedHyphenator_;
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
-    return explicitBreakInfos;
+  appendExplicitBreakInfos(cps, count, breaks);
+  if (!breaks.empty()) {
+    return;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
+  size_t indexCount = 0;
   if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+    indexCount = hyphenator->breakIndexes(cps, count, scratchIndexes);
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && indexCount == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
-    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+    for (size_t idx = minPrefix; idx + minSuffix <= count; ++idx) {
+      scratchIndexes[indexCount++] = static_cast<uint8_t>(idx);
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  for (size_t i = 0; i < indexCount; ++i) {
+    breaks.push_back({byteOffsetForIndex(cps, count, scratchIndexes[i]), true});
   }
+}
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
-  }
+void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
 
-  return breaks;
+void Hyphenator::setPackOpener(const PackOpener opener) {
+  packOpener = opener;
+  missingPackTag.clear();
+  if (loadedPack && cachedHyphenator_ == loadedPack->hyphenator.get()) {
+    cachedHyphenator_ = nullptr;
+  }
+  releasePack();
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+uint32_t Hyphenator::packPageReads() { return loadedPack ? loadedPack->pack.stats().pageMisses : 0; }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+class HyphenationPack;
 class LanguageHyphenator;
 
 class Hyphenator {
@@ -15,10 +17,23 @@ class Hyphenator {
   // Returns byte offsets where the word may be hyphenated. When includeFallback is true, all positions obeying the
   // minimum prefix/suffix constraints are returned even if no language-specific rule matches.
   static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+  // Same, but fills `breaks` (cleared first) so a caller going through many words can reuse one buffer and hyphenate
+  // without allocating.
+  static void breakOffsets(const std::string& word, bool includeFallback, std::vector<BreakInfo>& breaks);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
   static void setPreferredLanguage(const std::string& lang);
 
+  // Opens the pattern pack for a primary language tag (e.g. "nl") into `pack`. Languages without built-in patterns are
+  // looked up through this, so the firmware can load them from the SD card. Only the preferred language's pack is kept
+  // open, and a language found without a pack isn't looked up again until the opener is set anew. nullptr, the
+  // default, disables packs.
+  using PackOpener = bool (*)(const std::string& primaryTag, HyphenationPack& pack);
+  static void setPackOpener(PackOpener opener);
+
+  // Trie pages the current pattern pack has read from the SD card so far, 0 without a pack
+  static uint32_t packPageReads();
+
  private:
   static const LanguageHyphenator* cachedHyphenator_;
 };
\ No newline at end of file
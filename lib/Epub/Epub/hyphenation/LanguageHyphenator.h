@@ -10,14 +10,33 @@ class LanguageHyphenator {
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
       : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
+  // Patterns read from a pack on the SD card. The pack must outlive the hyphenator.
+  LanguageHyphenator(HyphenationPack& pack, bool (*isLetterFn)(uint32_t), uint32_t (*toLowerFn)(uint32_t),
+                     size_t minPrefix, size_t minSuffix)
+      : patterns_{nullptr, 0}, pack_(&pack), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
+
   std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
+    if (pack_) {
+      std::vector<uint8_t> indexes(cps.size());
+      indexes.resize(breakIndexes(cps.data(), cps.size(), indexes.data()));
+      return std::vector<size_t>(indexes.begin(), indexes.end());
+    }
     return liangBreakIndexes(cps, patterns_, config_);
   }
 
+  // Allocation-free variant, `out` must hold `count` entries
+  size_t breakIndexes(const CodepointInfo* cps, const size_t count, uint8_t* out) const {
+    return pack_ ? liangBreakIndexes(cps, count, *pack_, config_, out)
+                 : liangBreakIndexes(cps, count, patterns_, config_, out);
+  }
+
+  // Built-in patterns, empty for a pack-backed hyphenator
+  const SerializedHyphenationPatterns& patterns() const { return patterns_; }
   size_t minPrefix() const { return config_.minPrefix; }
   size_t minSuffix() const { return config_.minSuffix; }
 
  protected:
-  const SerializedHyphenationPatterns& patterns_;
+  const SerializedHyphenationPatterns patterns_;
+  HyphenationPack* pack_ = nullptr;
   LiangWordConfig config_;
 };
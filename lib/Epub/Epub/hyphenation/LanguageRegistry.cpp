@@ -6,30 +6,44 @@
 #include "HyphenationCommon.h"
 #include "generated/hyph-de.trie.h"
 #include "generated/hyph-en.trie.h"
+// OMIT_HYPHENATION_TRIES keeps only English and German in flash (~55 KB less), the other languages then need pattern
+// packs on the SD card (see docs/hyphenation-trie-format.md). German's trie is too large to be read from a pack
+// without going to the card for most words.
+#ifndef OMIT_HYPHENATION_TRIES
 #include "generated/hyph-es.trie.h"
 #include "generated/hyph-fr.trie.h"
 #include "generated/hyph-it.trie.h"
 #include "generated/hyph-ru.trie.h"
+#endif  // OMIT_HYPHENATION_TRIES
 
 namespace {
 
 // English hyphenation patterns (3/3 minimum prefix/suffix length)
 LanguageHyphenator englishHyphenator(en_us_patterns, isLatinLetter, toLowerLatin, 3, 3);
-LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator germanHyphenator(de_patterns, isLatinLetter, toLowerLatin);
+#ifndef OMIT_HYPHENATION_TRIES
+LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator russianHyphenator(ru_ru_patterns, isCyrillicLetter, toLowerCyrillic);
 LanguageHyphenator spanishHyphenator(es_patterns, isLatinLetter, toLowerLatin);
 LanguageHyphenator italianHyphenator(it_patterns, isLatinLetter, toLowerLatin);
 
 using EntryArray = std::array<LanguageEntry, 6>;
+#else
+using EntryArray = std::array<LanguageEntry, 2>;
+#endif  // OMIT_HYPHENATION_TRIES
 
 const EntryArray& entries() {
   static const EntryArray kEntries = {{{"english", "en", &englishHyphenator},
+#ifndef OMIT_HYPHENATION_TRIES
                                        {"french", "fr", &frenchHyphenator},
+#endif  // OMIT_HYPHENATION_TRIES
                                        {"german", "de", &germanHyphenator},
+#ifndef OMIT_HYPHENATION_TRIES
                                        {"russian", "ru", &russianHyphenator},
                                        {"spanish", "es", &spanishHyphenator},
-                                       {"italian", "it", &italianHyphenator}}};
+                                       {"italian", "it", &italianHyphenator}
+#endif  // OMIT_HYPHENATION_TRIES
+  }};
   return kEntries;
 }
 
@@ -3,11 +3,13 @@
 #include <algorithm>
 #include <vector>
 
+#include "HyphenationPack.h"
+
 /*
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
  * 1.  Input normalization (buildAugmentedWord)
- *     - Accepts a vector of CodepointInfo structs emitted by the EPUB text
+ *     - Accepts a range of CodepointInfo structs emitted by the EPUB text
  *       parser. Each codepoint is validated with LiangWordConfig::isLetter so
  *       we abort early on digits, punctuation, etc. If the word is valid we
  *       build an "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
@@ -24,8 +26,8 @@
  *       nodes, and an optional pointer into a shared "levels" list. We parse
  *       that layout lazily via decodeState/transition, keeping everything in
  *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       structs. A HyphenationPack holds the same blob on the SD card and
+ *       pages it in as the walk touches it, through the same templated code.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -45,163 +47,151 @@
  *       etc.
  *
  * Keeping the entire algorithm small and deterministic is critical on the
- * ESP32-C3: we avoid recursion, dynamic allocations per node, or copying the
- * trie. All lookups stay within the generated blob, which lives in flash, and
- * the working buffers (augmented bytes/scores) scale with the word length rather
- * than the pattern corpus.
+ * ESP32-C3: we avoid recursion, dynamic allocations, or copying the trie. All
+ * lookups stay within the generated blob, which lives in flash, and the working
+ * buffers (augmented bytes/scores) are fixed arrays sized for the longest word
+ * the parser emits, reused for every word. Hyphenation runs once per word during
+ * a section build, so allocating them per word was pure heap churn.
  */
 
 namespace {
 
-struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
+// Room for the longest word plus the two '.' sentinels. Letters the patterns cover never grow when lowercased, so
+// the byte count stays within the source word's.
+constexpr size_t MAX_AUGMENTED_BYTES = MAX_HYPHENATION_WORD_BYTES + 2;
+static_assert(MAX_AUGMENTED_BYTES < UINT8_MAX, "offsets and indexes are stored as uint8_t");
+constexpr uint8_t NO_CHAR = UINT8_MAX;
 
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
+struct AugmentedWord {
+  uint8_t bytes[MAX_AUGMENTED_BYTES];
+  uint8_t charByteOffsets[MAX_AUGMENTED_BYTES];
+  // Codepoint index starting at each byte, NO_CHAR for continuation bytes
+  uint8_t byteToCharIndex[MAX_AUGMENTED_BYTES];
+  // Liang scores: one entry per augmented char (leading/trailing dots included)
+  uint8_t scores[MAX_AUGMENTED_BYTES];
+  size_t byteCount = 0;
+  size_t charCount = 0;
 };
 
-// Encode a single Unicode codepoint into UTF-8 and append to the provided buffer.
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+// Shared by every call, which is fine as words are hyphenated one at a time. Kept out of the stack because the
+// section build runs deep inside the XML parser callbacks on a small task stack.
+AugmentedWord scratch;
+
+// Encode a single Unicode codepoint into UTF-8 at `out`, which has room for `capacity` bytes. Returns the number of
+// bytes written, or 0 if it doesn't fit.
+size_t encodeUtf8(uint32_t cp, uint8_t* out, const size_t capacity) {
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
+    if (capacity < 1) return 0;
+    out[0] = static_cast<uint8_t>(cp);
     return 1;
   }
   if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    if (capacity < 2) return 0;
+    out[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    out[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 2;
   }
   if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    if (capacity < 3) return 0;
+    out[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    out[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 3;
   }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+  if (capacity < 4) return 0;
+  out[0] = static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u));
+  out[1] = static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu));
+  out[2] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+  out[3] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
   return 4;
 }
 
-// Build the dotted, lowercase UTF-8 representation plus lookup tables.
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
-  if (cps.empty()) {
-    return word;
+// Build the dotted, lowercase UTF-8 representation plus lookup tables. Returns false if the word contains anything
+// but letters or doesn't fit the buffers.
+bool buildAugmentedWord(const CodepointInfo* cps, const size_t count, const LiangWordConfig& config,
+                        AugmentedWord& word) {
+  if (count == 0 || count > MAX_HYPHENATION_WORD_BYTES) {
+    return false;
   }
 
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
-
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
+  word.charCount = 0;
+  word.byteCount = 0;
+  word.charByteOffsets[word.charCount++] = 0;
+  word.bytes[word.byteCount++] = '.';
 
-  for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
+  for (size_t i = 0; i < count; ++i) {
+    if (!config.isLetter(cps[i].value)) {
+      return false;
+    }
+    // Leave room for the trailing '.'
+    const size_t written = encodeUtf8(config.toLower(cps[i].value), word.bytes + word.byteCount,
+                                      MAX_AUGMENTED_BYTES - 1 - word.byteCount);
+    if (written == 0) {
+      return false;
     }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
+    word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+    word.byteCount += written;
   }
 
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
+  word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+  word.bytes[word.byteCount++] = '.';
 
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
+  std::fill(word.byteToCharIndex, word.byteToCharIndex + word.byteCount, NO_CHAR);
+  for (size_t i = 0; i < word.charCount; ++i) {
+    word.byteToCharIndex[word.charByteOffsets[i]] = static_cast<uint8_t>(i);
   }
-  return word;
+  std::fill(word.scores, word.scores + word.charCount, 0);
+  return true;
 }
 
-// Decoded view of a single trie node pulled straight out of the serialized blob.
+// Byte access to a trie kept in flash. The walk below is templated on the source so the same code also reads
+// HyphenationPack tries from the SD card, without an indirect call per byte for the built-in ones.
+struct FlashSource {
+  const uint8_t* data;
+  size_t length;
+
+  size_t size() const { return length; }
+  uint8_t at(const size_t addr) const { return data[addr]; }
+};
+
+// Decoded view of a single trie node. Holds blob addresses rather than pointers, as a paged source may have dropped
+// the node's bytes by the time its transitions are followed.
 // - transitions: contiguous list of next-byte values
 // - targets: packed relative offsets (1/2/3 bytes) for each transition
-// - levels: optional pointer into the global levels list with packed dist/level pairs
+// - levels: optional address in the global levels list with packed dist/level pairs
 struct AutomatonState {
-  const uint8_t* data = nullptr;
-  size_t size = 0;
+  bool valid = false;
   size_t addr = 0;
   uint8_t stride = 1;
   size_t childCount = 0;
-  const uint8_t* transitions = nullptr;
-  const uint8_t* targets = nullptr;
-  const uint8_t* levels = nullptr;
+  size_t transitions = 0;
+  size_t targets = 0;
+  size_t levels = 0;
   size_t levelsLen = 0;
-
-  bool valid() const { return data != nullptr; }
-};
-
-// Lightweight descriptor for the entire embedded automaton.
-// The blob format is:
-//   [0..3]  - big-endian root offset
-//   [4....] - node heap containing variable-sized headers + transition data
-struct EmbeddedAutomaton {
-  const uint8_t* data = nullptr;
-  size_t size = 0;
-  uint32_t rootOffset = 0;
-
-  bool valid() const { return data != nullptr && size >= 4 && rootOffset < size; }
 };
 
-// Decode the serialized automaton header and root offset.
-EmbeddedAutomaton parseAutomaton(const SerializedHyphenationPatterns& patterns) {
-  EmbeddedAutomaton automaton;
-  if (!patterns.data || patterns.size < 4) {
-    return automaton;
-  }
-
-  automaton.data = patterns.data;
-  automaton.size = patterns.size;
-  automaton.rootOffset = (static_cast<uint32_t>(patterns.data[0]) << 24) |
-                         (static_cast<uint32_t>(patterns.data[1]) << 16) |
-                         (static_cast<uint32_t>(patterns.data[2]) << 8) | static_cast<uint32_t>(patterns.data[3]);
-  if (automaton.rootOffset >= automaton.size) {
-    automaton.data = nullptr;
-    automaton.size = 0;
-  }
-  return automaton;
-}
-
-// Cache parsed automata per blob pointer to avoid reparsing.
-const EmbeddedAutomaton& getAutomaton(const SerializedHyphenationPatterns& patterns) {
-  struct CacheEntry {
-    const SerializedHyphenationPatterns* key;
-    EmbeddedAutomaton automaton;
-  };
-  static std::vector<CacheEntry> cache;
-
-  for (const auto& entry : cache) {
-    if (entry.key == &patterns) {
-      return entry.automaton;
-    }
+// Decode the big-endian root offset at the start of the blob. Returns false if it can't be valid.
+template <typename Source>
+bool readRootOffset(Source& source, size_t& rootOffset) {
+  if (source.size() < 4) {
+    return false;
   }
-
-  cache.push_back({&patterns, parseAutomaton(patterns)});
-  return cache.back().automaton;
+  rootOffset = (static_cast<size_t>(source.at(0)) << 24) | (static_cast<size_t>(source.at(1)) << 16) |
+               (static_cast<size_t>(source.at(2)) << 8) | static_cast<size_t>(source.at(3));
+  return rootOffset < source.size();
 }
 
 // Interpret the node located at `addr`, returning transition metadata.
-AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
+template <typename Source>
+AutomatonState decodeState(Source& source, const size_t addr) {
   AutomatonState state;
-  if (!automaton.valid() || addr >= automaton.size) {
+  const size_t size = source.size();
+  if (addr >= size) {
     return state;
   }
 
-  const uint8_t* base = automaton.data + addr;
-  size_t remaining = automaton.size - addr;
-  size_t pos = 0;
-
-  const uint8_t header = base[pos++];
+  size_t pos = addr;
+  const uint8_t header = source.at(pos++);
   // Header layout (bits):
   //   7        - hasLevels flag
   //   6..5     - stride selector (0 -> 1 byte, otherwise 1|2|3)
@@ -213,102 +203,97 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   }
   size_t childCount = static_cast<size_t>(header & 0x1Fu);
   if (childCount == 31u) {
-    if (pos >= remaining) {
-      return AutomatonState{};
+    if (pos >= size) {
+      return state;
     }
-    childCount = base[pos++];
+    childCount = source.at(pos++);
   }
 
-  const uint8_t* levelsPtr = nullptr;
+  size_t levels = 0;
   size_t levelsLen = 0;
   if (hasLevels) {
-    if (pos + 1 >= remaining) {
-      return AutomatonState{};
+    if (pos + 1 >= size) {
+      return state;
     }
-    const uint8_t offsetHi = base[pos++];
-    const uint8_t offsetLoLen = base[pos++];
+    const uint8_t offsetHi = source.at(pos++);
+    const uint8_t offsetLoLen = source.at(pos++);
     // The 12-bit offset (hi<<4 | top nibble) points into the blob-level levels list.
     // The bottom nibble stores how many packed entries belong to this node.
-    const size_t offset = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
+    levels = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
     levelsLen = offsetLoLen & 0x0Fu;
-    if (offset + levelsLen > automaton.size) {
-      return AutomatonState{};
+    if (levels + levelsLen > size) {
+      return state;
     }
-    levelsPtr = automaton.data + offset;
   }
 
-  if (pos + childCount > remaining) {
-    return AutomatonState{};
-  }
-  const uint8_t* transitions = base + pos;
+  const size_t transitions = pos;
   pos += childCount;
-
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
-    return AutomatonState{};
+  const size_t targets = pos;
+  pos += childCount * stride;
+  if (pos > size) {
+    return state;
   }
-  const uint8_t* targets = base + pos;
 
-  state.data = automaton.data;
-  state.size = automaton.size;
+  state.valid = true;
   state.addr = addr;
   state.stride = stride;
   state.childCount = childCount;
   state.transitions = transitions;
   state.targets = targets;
-  state.levels = levelsPtr;
+  state.levels = levels;
   state.levelsLen = levelsLen;
   return state;
 }
 
 // Convert the packed stride-sized delta back into a signed offset.
-int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
+template <typename Source>
+int32_t decodeDelta(Source& source, const size_t addr, const uint8_t stride) {
   if (stride == 1) {
-    return static_cast<int8_t>(buf[0]);
+    return static_cast<int8_t>(source.at(addr));
   }
   if (stride == 2) {
-    return static_cast<int16_t>((static_cast<uint16_t>(buf[0]) << 8) | static_cast<uint16_t>(buf[1]));
+    return static_cast<int16_t>((static_cast<uint16_t>(source.at(addr)) << 8) |
+                                static_cast<uint16_t>(source.at(addr + 1)));
   }
-  const int32_t unsignedVal =
-      (static_cast<int32_t>(buf[0]) << 16) | (static_cast<int32_t>(buf[1]) << 8) | static_cast<int32_t>(buf[2]);
+  const int32_t unsignedVal = (static_cast<int32_t>(source.at(addr)) << 16) |
+                              (static_cast<int32_t>(source.at(addr + 1)) << 8) |
+                              static_cast<int32_t>(source.at(addr + 2));
   return unsignedVal - (1 << 23);
 }
 
 // Follow a single byte transition from `state`, decoding the child node on success.
-bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
-  if (!state.valid()) {
+template <typename Source>
+bool transition(Source& source, const AutomatonState& state, const uint8_t letter, AutomatonState& out) {
+  if (!state.valid) {
     return false;
   }
 
   // Children remain sorted by letter in the serialized blob, but the lists are
   // short enough that a linear scan keeps code size down compared to binary search.
   for (size_t idx = 0; idx < state.childCount; ++idx) {
-    if (state.transitions[idx] != letter) {
+    if (source.at(state.transitions + idx) != letter) {
       continue;
     }
-    const uint8_t* deltaPtr = state.targets + idx * state.stride;
-    const int32_t delta = decodeDelta(deltaPtr, state.stride);
+    const int32_t delta = decodeDelta(source, state.targets + idx * state.stride, state.stride);
     // Deltas are relative to the current node's address, allowing us to keep all
     // targets within 24 bits while still referencing further nodes in the blob.
     const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
+    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= source.size()) {
       return false;
     }
-    out = decodeState(automaton, static_cast<size_t>(nextAddr));
-    return out.valid();
+    out = decodeState(source, static_cast<size_t>(nextAddr));
+    return out.valid;
   }
   return false;
 }
 
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+size_t collectBreakIndexes(const size_t cpCount, const AugmentedWord& word, const size_t minPrefix,
+                           const size_t minSuffix, uint8_t* out) {
+  size_t indexCount = 0;
   if (cpCount < 2) {
-    return indexes;
+    return indexCount;
   }
 
   for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
@@ -322,84 +307,98 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     }
 
     const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
+    if (scoreIdx >= word.charCount) {
       break;
     }
-    if ((scores[scoreIdx] & 1u) == 0) {
+    if ((word.scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    out[indexCount++] = static_cast<uint8_t>(breakIndex);
   }
 
-  return indexes;
+  return indexCount;
 }
 
-}  // namespace
-
-// Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
-  if (augmented.empty()) {
-    return {};
+// Runs the full Liang pipeline for a single word.
+template <typename Source>
+size_t runLiang(const CodepointInfo* cps, const size_t count, Source& source, const LiangWordConfig& config,
+                uint8_t* out) {
+  AugmentedWord& augmented = scratch;
+  if (!buildAugmentedWord(cps, count, config, augmented)) {
+    return 0;
   }
 
-  const EmbeddedAutomaton& automaton = getAutomaton(patterns);
-  if (!automaton.valid()) {
-    return {};
+  size_t rootOffset;
+  if (!readRootOffset(source, rootOffset)) {
+    return 0;
   }
-
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
-  if (!root.valid()) {
-    return {};
+  const AutomatonState root = decodeState(source, rootOffset);
+  if (!root.valid) {
+    return 0;
   }
 
-  // Liang scores: one entry per augmented char (leading/trailing dots included).
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
-
   // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
+  for (size_t charStart = 0; charStart < augmented.charCount; ++charStart) {
     const size_t byteStart = augmented.charByteOffsets[charStart];
     AutomatonState state = root;
 
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
+    for (size_t cursor = byteStart; cursor < augmented.byteCount; ++cursor) {
       AutomatonState next;
-      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
+      if (!transition(source, state, augmented.bytes[cursor], next)) {
         break;  // No more matches for this prefix.
       }
       state = next;
 
-      if (state.levels && state.levelsLen > 0) {
+      if (state.levelsLen > 0) {
         size_t offset = 0;
         // Each packed byte stores the byte-distance delta and the Liang level digit.
         for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
+          const uint8_t packed = source.at(state.levels + i);
           const size_t dist = static_cast<size_t>(packed / 10);
           const uint8_t level = static_cast<uint8_t>(packed % 10);
 
           offset += dist;
           const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
+          if (splitByte >= augmented.byteCount) {
             continue;
           }
 
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
+          const uint8_t boundary = augmented.byteToCharIndex[splitByte];
+          if (boundary == NO_CHAR) {
             continue;  // Mid-codepoint byte, wait for the next one.
           }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
+          if (boundary < 2 || boundary + 2u > augmented.charCount) {
             continue;  // Skip splits that land in the leading/trailing sentinels.
           }
 
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
+          augmented.scores[boundary] = std::max(augmented.scores[boundary], level);
         }
       }
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(count, augmented, config.minPrefix, config.minSuffix, out);
+}
+
+}  // namespace
+
+size_t liangBreakIndexes(const CodepointInfo* cps, const size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, uint8_t* out) {
+  if (!patterns.data) {
+    return 0;
+  }
+  FlashSource source{patterns.data, patterns.size};
+  return runLiang(cps, count, source, config, out);
+}
+
+size_t liangBreakIndexes(const CodepointInfo* cps, const size_t count, HyphenationPack& pack,
+                         const LiangWordConfig& config, uint8_t* out) {
+  return runLiang(cps, count, pack, config, out);
+}
+
+std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
+                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
+  std::vector<uint8_t> indexes(cps.size());
+  const size_t indexCount = liangBreakIndexes(cps.data(), cps.size(), patterns, config, indexes.data());
+  return std::vector<size_t>(indexes.begin(), indexes.begin() + indexCount);
 }
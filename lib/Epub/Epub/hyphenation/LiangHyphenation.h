@@ -7,6 +7,8 @@
 #include "HyphenationCommon.h"
 #include "SerializedHyphenationTrie.h"
 
+class HyphenationPack;
+
 // Encapsulates every language-specific dial the Liang algorithm needs at runtime.  The helpers are
 // intentionally represented as bare function pointers because we invoke them inside tight loops and
 // want to avoid the overhead of std::function or functors.  The minima default to the TeX-recommended
@@ -33,6 +35,16 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
+// Shared Liang pattern evaluator used by every language-specific hyphenator. Writes break positions (codepoint
+// indexes) to `out`, which must hold `count` entries, and returns how many there are. Works on fixed scratch buffers,
+// so it allocates nothing but is not reentrant; words over MAX_HYPHENATION_WORD_BYTES codepoints get no breaks.
+size_t liangBreakIndexes(const CodepointInfo* cps, size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, uint8_t* out);
+
+// Same, for patterns read from a pattern pack on the SD card
+size_t liangBreakIndexes(const CodepointInfo* cps, size_t count, HyphenationPack& pack, const LiangWordConfig& config,
+                         uint8_t* out);
+
+// Vector convenience wrapper, used by the evaluation harness
 std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
                                       const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
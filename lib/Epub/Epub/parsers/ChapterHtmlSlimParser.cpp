@@ -7,6 +7,10 @@
 
 #include "../Page.h"
 #include "../htmlEntities.h"
+#include "../hyphenation/HyphenationCommon.h"
+
+// Words are hyphenated on fixed buffers, with room for a paragraph indent in front
+static_assert(MAX_WORD_SIZE + 3 <= MAX_HYPHENATION_WORD_BYTES, "hyphenation buffers too small for MAX_WORD_SIZE");
 
 const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
 constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
@@ -112,6 +116,7 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
     makePages();
   }
   currentTextBlock.reset(new ParsedText(extraParagraphSpacing, hyphenationEnabled, blockStyle));
+  textBlockStarted = false;
 }
 
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
@@ -123,15 +128,18 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  // Extract class and style attributes for CSS processing
+  // Extract class and style attributes for CSS processing, and the id links may point at
   std::string classAttr;
   std::string styleAttr;
+  const char* idAttr = nullptr;
   if (atts != nullptr) {
     for (int i = 0; atts[i]; i += 2) {
       if (strcmp(atts[i], "class") == 0) {
         classAttr = atts[i + 1];
       } else if (strcmp(atts[i], "style") == 0) {
         styleAttr = atts[i + 1];
+      } else if (strcmp(atts[i], "id") == 0) {
+        idAttr = atts[i + 1];
       }
     }
   }
@@ -144,6 +152,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   if (strcmp(name, "table") == 0) {
     // Add placeholder text
     self->startNewTextBlock(centeredBlockStyle);
+    self->addAnchor(idAttr);
 
     self->italicUntilDepth = min(self->italicUntilDepth, self->depth);
     // Advance depth before processing character data (like you would for an element with text)
@@ -156,22 +165,39 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   }
 
   if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
-    // TODO: Start processing image tags
     std::string alt = "[Image]";
+    const char* src = nullptr;
     if (atts != nullptr) {
       for (int i = 0; atts[i]; i += 2) {
         if (strcmp(atts[i], "alt") == 0) {
           if (strlen(atts[i + 1]) > 0) {
             alt = "[Image: " + std::string(atts[i + 1]) + "]";
           }
-          break;
+        } else if (strcmp(atts[i], "src") == 0) {
+          src = atts[i + 1];
         }
       }
     }
 
+    // Decoding an image can take seconds, so a cancelled build skips it. The alt text stands in until the parse loop
+    // sees the abort on the next chunk.
+    if (src != nullptr && self->imageFn && !(self->shouldAbort && self->shouldAbort())) {
+      // Text around the image keeps its paragraph's style
+      if (self->partWordBufferIndex > 0) {
+        self->flushPartWordBuffer();
+      }
+      self->startNewTextBlock(self->currentTextBlock->getBlockStyle());
+      if (self->addImage(src, idAttr)) {
+        self->skipUntilDepth = self->depth;
+        self->depth += 1;
+        return;
+      }
+    }
+
     LOG_DBG("EHP", "Image alt: %s", alt.c_str());
 
     self->startNewTextBlock(centeredBlockStyle);
+    self->addAnchor(idAttr);
     self->italicUntilDepth = min(self->italicUntilDepth, self->depth);
     // Advance depth before processing character data (like you would for an element with text)
     self->depth += 1;
@@ -194,6 +220,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     for (int i = 0; atts[i]; i += 2) {
       if (strcmp(atts[i], "role") == 0 && strcmp(atts[i + 1], "doc-pagebreak") == 0 ||
           strcmp(atts[i], "epub:type") == 0 && strcmp(atts[i + 1], "pagebreak") == 0) {
+        // Page list entries link to these
+        self->addAnchor(idAttr);
         self->skipUntilDepth = self->depth;
         self->depth += 1;
         return;
@@ -336,6 +364,9 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
   }
 
+  // After any new text block was started, so the id goes with the element's own text
+  self->addAnchor(idAttr);
+
   // Unprocessed tag, just increasing depth and continue forward
   self->depth += 1;
 }
@@ -404,15 +435,10 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     self->partWordBuffer[self->partWordBufferIndex++] = s[i];
   }
 
-  // If we have > 750 words buffered up, perform the layout and consume out all but the last line
-  // There should be enough here to build out 1-2 full pages and doing this will free up a lot of
-  // memory.
+  // Lay out the lines of a long paragraph that can't change anymore, so its words don't pile up in memory
   // Spotted when reading Intermezzo, there are some really long text blocks in there.
-  if (self->currentTextBlock->size() > 750) {
-    LOG_DBG("EHP", "Text block too long, splitting into multiple pages");
-    self->currentTextBlock->layoutAndExtractLines(
-        self->renderer, self->fontId, self->viewportWidth,
-        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
+  if (self->currentTextBlock->isLayoutWindowFull()) {
+    self->layoutTextBlock(false);
   }
 }
 
@@ -540,6 +566,16 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetCharacterDataHandler(parser, characterData);
 
   do {
+    if (shouldAbort && shouldAbort()) {
+      LOG_DBG("EHP", "Build aborted");
+      XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+      XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+      XML_SetCharacterDataHandler(parser, nullptr);
+      XML_ParserFree(parser);
+      file.close();
+      return false;
+    }
+
     void* const buf = XML_GetBuffer(parser, 1024);
     if (!buf) {
       LOG_ERR("EHP", "Couldn't allocate memory for buffer");
@@ -586,7 +622,12 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   // Process last page if there is still text
   if (currentTextBlock) {
     makePages();
-    completePageFn(std::move(currentPage));
+    // Ids after the last line of text
+    for (const auto& id : pendingAnchors) {
+      anchorFn(id, completedPageCount);
+    }
+    pendingAnchors.clear();
+    completePage();
     currentPage.reset();
     currentTextBlock.reset();
   }
@@ -594,41 +635,90 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   return true;
 }
 
-void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
+void ChapterHtmlSlimParser::addAnchor(const char* id) {
+  if (anchorFn && id != nullptr && *id != '\0') {
+    pendingAnchors.emplace_back(id);
+  }
+}
+
+bool ChapterHtmlSlimParser::addImage(const char* src, const char* id) {
+  // Fit within the margins and padding of the block the image sits in, like its text
+  const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
+  const bool insetFits = blockStyle.totalHorizontalInset() < viewportWidth;
+  const int contentLeft = insetFits ? blockStyle.leftInset() : 0;
+  const int contentWidth = insetFits ? viewportWidth - blockStyle.totalHorizontalInset() : viewportWidth;
+  PageImage image{0, 0, 0};
+  if (!imageFn(src, contentWidth, viewportHeight, &image)) {
+    return false;
+  }
+
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+  if (currentPageNextY > 0 && currentPageNextY + image.height > viewportHeight) {
+    completePage();
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  addAnchor(id);
+  for (const auto& pending : pendingAnchors) {
+    anchorFn(pending, completedPageCount);
+  }
+  pendingAnchors.clear();
+
+  // Centered, with the spacing of a paragraph below
+  currentPage->addImage(image, static_cast<int16_t>(contentLeft + (contentWidth - image.width) / 2),
+                        currentPageNextY);
+  currentPageNextY += image.height;
+  if (extraParagraphSpacing) {
+    currentPageNextY += static_cast<int>(renderer.getLineHeight(fontId) * lineCompression) / 2;
+  }
+  return true;
+}
+
+void ChapterHtmlSlimParser::completePage() {
+  completePageFn(std::move(currentPage));
+  completedPageCount++;
+}
+
+void ChapterHtmlSlimParser::addLineToPage(const TextBlock& line) {
   const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
 
   if (currentPageNextY + lineHeight > viewportHeight) {
-    completePageFn(std::move(currentPage));
+    completePage();
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
 
+  for (const auto& id : pendingAnchors) {
+    anchorFn(id, completedPageCount);
+  }
+  pendingAnchors.clear();
+
   // Apply horizontal left inset (margin + padding) as x position offset
-  const int16_t xOffset = line->getBlockStyle().leftInset();
-  currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
+  const int16_t xOffset = line.getBlockStyle().leftInset();
+  currentPage->addLine(line, xOffset, currentPageNextY);
   currentPageNextY += lineHeight;
 }
 
-void ChapterHtmlSlimParser::makePages() {
-  if (!currentTextBlock) {
-    LOG_ERR("EHP", "!! No text block to make pages for !!");
-    return;
-  }
-
+void ChapterHtmlSlimParser::layoutTextBlock(const bool paragraphEnds) {
   if (!currentPage) {
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
 
-  const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
-
   // Apply top spacing before the paragraph (stored in pixels)
   const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
-  if (blockStyle.marginTop > 0) {
-    currentPageNextY += blockStyle.marginTop;
-  }
-  if (blockStyle.paddingTop > 0) {
-    currentPageNextY += blockStyle.paddingTop;
+  if (!textBlockStarted) {
+    if (blockStyle.marginTop > 0) {
+      currentPageNextY += blockStyle.marginTop;
+    }
+    if (blockStyle.paddingTop > 0) {
+      currentPageNextY += blockStyle.paddingTop;
+    }
+    textBlockStarted = true;
   }
 
   // Calculate effective width accounting for horizontal margins/padding
@@ -637,10 +727,19 @@ void ChapterHtmlSlimParser::makePages() {
       (horizontalInset < viewportWidth) ? static_cast<uint16_t>(viewportWidth - horizontalInset) : viewportWidth;
 
   currentTextBlock->layoutAndExtractLines(
-      renderer, fontId, effectiveWidth,
-      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+      renderer, fontId, effectiveWidth, [this](const TextBlock& line) { addLineToPage(line); }, paragraphEnds);
+}
+
+void ChapterHtmlSlimParser::makePages() {
+  if (!currentTextBlock) {
+    LOG_ERR("EHP", "!! No text block to make pages for !!");
+    return;
+  }
+
+  layoutTextBlock(true);
 
   // Apply bottom spacing after the paragraph (stored in pixels)
+  const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
   if (blockStyle.marginBottom > 0) {
     currentPageNextY += blockStyle.marginBottom;
   }
@@ -650,6 +749,7 @@ void ChapterHtmlSlimParser::makePages() {
 
   // Extra paragraph spacing if enabled (default behavior)
   if (extraParagraphSpacing) {
+    const int lineHeight = renderer.getLineHeight(fontId) * lineCompression;
     currentPageNextY += lineHeight / 2;
   }
 }
@@ -5,6 +5,7 @@
 #include <climits>
 #include <functional>
 #include <memory>
+#include <string_view>
 
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
@@ -12,6 +13,7 @@
 #include "../css/CssStyle.h"
 
 class Page;
+struct PageImage;
 class GfxRenderer;
 
 #define MAX_WORD_SIZE 200
@@ -20,7 +22,13 @@ class ChapterHtmlSlimParser {
   const std::string& filepath;
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>)> completePageFn;
-  std::function<void()> popupFn;  // Popup callback
+  std::function<void()> popupFn;      // Popup callback
+  std::function<bool()> shouldAbort;  // Polled between chunks, returning true cancels the build
+  // Called with each element id and the index of the page it lands on
+  std::function<void(std::string_view id, uint16_t page)> anchorFn;
+  // Decodes the image an <img> src points at, scaled to fit the box, and stores it. False leaves the alt text in its
+  // place.
+  std::function<bool(const std::string& src, uint16_t maxWidth, uint16_t maxHeight, PageImage* image)> imageFn;
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -32,8 +40,12 @@ class ChapterHtmlSlimParser {
   int partWordBufferIndex = 0;
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  bool textBlockStarted = false;  // top spacing of currentTextBlock applied, its first lines may be on a page already
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
+  uint16_t completedPageCount = 0;
+  // Ids seen since the last line was laid out, they land on the page of the next one
+  std::vector<std::string> pendingAnchors;
   int fontId;
   float lineCompression;
   bool extraParagraphSpacing;
@@ -60,7 +72,14 @@ class ChapterHtmlSlimParser {
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
   void flushPartWordBuffer();
+  // Lays out the current text block onto pages. With paragraphEnds false the paragraph is still being read and only
+  // its final lines are laid out.
+  void layoutTextBlock(bool paragraphEnds);
   void makePages();
+  void addAnchor(const char* id);
+  // Lays the image out on its own lines, on the page its id then points at. False if it couldn't be decoded.
+  bool addImage(const char* src, const char* id);
+  void completePage();
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
@@ -74,7 +93,11 @@ class ChapterHtmlSlimParser {
                                  const uint16_t viewportHeight, const bool hyphenationEnabled,
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const bool embeddedStyle, const std::function<void()>& popupFn = nullptr,
-                                 const CssParser* cssParser = nullptr)
+                                 const CssParser* cssParser = nullptr,
+                                 const std::function<bool()>& shouldAbort = nullptr,
+                                 const std::function<void(std::string_view id, uint16_t page)>& anchorFn = nullptr,
+                                 const std::function<bool(const std::string& src, uint16_t maxWidth,
+                                                          uint16_t maxHeight, PageImage* image)>& imageFn = nullptr)
 
       : filepath(filepath),
         renderer(renderer),
@@ -87,10 +110,13 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        shouldAbort(shouldAbort),
+        anchorFn(anchorFn),
+        imageFn(imageFn),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle) {}
 
   ~ChapterHtmlSlimParser() = default;
   bool parseAndBuildPages();
-  void addLineToPage(std::shared_ptr<TextBlock> line);
+  void addLineToPage(const TextBlock& line);
 };
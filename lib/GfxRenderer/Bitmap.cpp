@@ -82,14 +82,14 @@ const char* Bitmap::errorToString(BmpReaderError err) {
 
 BmpReaderError Bitmap::parseHeaders() {
   if (!file) return BmpReaderError::FileInvalid;
-  if (!file.seek(0)) return BmpReaderError::SeekStartFailed;
+  if (!file.seek(start)) return BmpReaderError::SeekStartFailed;
 
   // --- BMP FILE HEADER ---
   const uint16_t bfType = readLE16(file);
   if (bfType != 0x4D42) return BmpReaderError::NotBMP;
 
   file.seekCur(8);
-  bfOffBits = readLE32(file);
+  bfOffBits = start + readLE32(file);
 
   // --- DIB HEADER ---
   const uint32_t biSize = readLE32(file);
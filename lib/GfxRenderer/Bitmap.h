@@ -32,7 +32,9 @@ class Bitmap {
  public:
   static const char* errorToString(BmpReaderError err);
 
-  explicit Bitmap(FsFile& file, bool dithering = false) : file(file), dithering(dithering) {}
+  // A bitmap stored inside a larger file, such as a section file, begins `start` bytes in
+  explicit Bitmap(FsFile& file, bool dithering = false, uint32_t start = 0)
+      : file(file), dithering(dithering), start(start) {}
   ~Bitmap();
   BmpReaderError parseHeaders();
   BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
@@ -51,6 +53,7 @@ class Bitmap {
 
   FsFile& file;
   bool dithering = false;
+  uint32_t start = 0;
   int width = 0;
   int height = 0;
   bool topDown = false;
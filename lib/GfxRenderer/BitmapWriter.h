@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+#include "BitmapHelpers.h"
+
+class Print;
+
+// Writes a top-down 1- or 2-bit BMP from 8-bit gray source rows handed over one at a time, top to bottom. Rows are
+// scaled down by area averaging, then dithered, so an image decoder only ever holds the rows it is working on and
+// every format ends up looking the same on screen.
+class BitmapWriter {
+ public:
+  // Scales a srcWidth x srcHeight image down to the target box, to cover it when cropping and to fit inside it
+  // otherwise. Images that already fit, or a zero target, keep their size.
+  BitmapWriter(Print& out, int srcWidth, int srcHeight, int targetWidth, int targetHeight, bool oneBit, bool crop);
+  ~BitmapWriter();
+
+  BitmapWriter(const BitmapWriter&) = delete;
+  BitmapWriter& operator=(const BitmapWriter&) = delete;
+
+  // Writes the BMP header and allocates the row buffers. False if out of memory.
+  bool begin();
+  // Takes the next source row, srcWidth gray values
+  void writeRow(const uint8_t* gray);
+
+  int getWidth() const { return outWidth; }
+  int getHeight() const { return outHeight; }
+
+ private:
+  template <typename T>
+  void writeOutputRow(const T* gray, int y);
+
+  Print& out;
+  int srcWidth;
+  int outWidth;
+  int outHeight;
+  bool oneBit;
+  bool needsScaling = false;
+  int bytesPerRow = 0;
+  // Source pixels per output pixel, 16.16 fixed point
+  uint32_t scaleX_fp = 65536;
+  uint32_t scaleY_fp = 65536;
+
+  uint8_t* rowBuffer = nullptr;
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+  Atkinson1BitDitherer* atkinson1BitDitherer = nullptr;
+
+  // Source rows accumulated into the current output row, when scaling
+  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
+  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
+  int srcY = 0;                    // Next source row
+  int currentOutY = 0;             // Current output row being accumulated
+  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
+};
@@ -0,0 +1,66 @@
+#include "FrameImage.h"
+
+#include <Logging.h>
+
+#include <cstdlib>
+#include <cstring>
+
+bool FrameImage::capture(const uint8_t* frameBuffer, const packbits::Order order) {
+  clear();
+  this->order = order;
+  for (size_t i = 0; i < NUM_CHUNKS; i++) {
+    const uint8_t* chunk = frameBuffer + i * CHUNK_SIZE;
+    const size_t encodedSize = packbits::encodedSize(chunk, HalDisplay::DISPLAY_WIDTH_BYTES, CHUNK_ROWS, order);
+    const bool encode = encodedSize < CHUNK_SIZE;
+    const size_t size = encode ? encodedSize : CHUNK_SIZE;
+    chunks[i] = static_cast<uint8_t*>(malloc(size));
+
+    if (!chunks[i]) {
+      LOG_ERR("GFX", "!! Failed to allocate frame image chunk %zu (%zu bytes)", i, size);
+      clear();
+      return false;
+    }
+
+    if (encode) {
+      packbits::encode(chunk, HalDisplay::DISPLAY_WIDTH_BYTES, CHUNK_ROWS, order, chunks[i]);
+    } else {
+      memcpy(chunks[i], chunk, CHUNK_SIZE);
+    }
+    chunkSizes[i] = static_cast<uint16_t>(size);
+  }
+  return true;
+}
+
+bool FrameImage::restore(uint8_t* frameBuffer) const {
+  if (empty()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < NUM_CHUNKS; i++) {
+    uint8_t* chunk = frameBuffer + i * CHUNK_SIZE;
+    if (chunkSizes[i] == CHUNK_SIZE) {
+      memcpy(chunk, chunks[i], CHUNK_SIZE);
+    } else if (!packbits::decode(chunks[i], chunkSizes[i], chunk, HalDisplay::DISPLAY_WIDTH_BYTES, CHUNK_ROWS,
+                                 order)) {
+      LOG_ERR("GFX", "!! Frame image chunk %zu does not decode - this is likely a bug", i);
+      return false;
+    }
+  }
+  return true;
+}
+
+void FrameImage::clear() {
+  for (size_t i = 0; i < NUM_CHUNKS; i++) {
+    free(chunks[i]);
+    chunks[i] = nullptr;
+    chunkSizes[i] = 0;
+  }
+}
+
+size_t FrameImage::size() const {
+  size_t total = 0;
+  for (const uint16_t chunkSize : chunkSizes) {
+    total += chunkSize;
+  }
+  return total;
+}
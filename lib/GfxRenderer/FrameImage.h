@@ -0,0 +1,42 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "PackBits.h"
+
+// A copy of the BW frame buffer kept off screen, for putting a frame back or showing one drawn ahead of time. Stored
+// in 8KB chunks so it never needs 48KB of contiguous memory. Each chunk is run-length encoded when that makes it
+// smaller, which brings a page of text down to about 20KB, and copied raw otherwise.
+class FrameImage {
+ public:
+  static constexpr size_t CHUNK_SIZE = 8000;
+  static constexpr size_t NUM_CHUNKS = HalDisplay::BUFFER_SIZE / CHUNK_SIZE;
+  static constexpr size_t CHUNK_ROWS = CHUNK_SIZE / HalDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(CHUNK_SIZE * NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
+                "Frame image chunking does not line up with display buffer size");
+  static_assert(CHUNK_ROWS * HalDisplay::DISPLAY_WIDTH_BYTES == CHUNK_SIZE, "Frame image chunks must hold whole rows");
+
+  FrameImage() = default;
+  ~FrameImage() { clear(); }
+  FrameImage(const FrameImage&) = delete;
+  FrameImage& operator=(const FrameImage&) = delete;
+
+  // Replaces the stored frame. Chunks are encoded in `order` (see PackBits.h). Returns false, leaving the image
+  // empty, if a chunk could not be allocated.
+  bool capture(const uint8_t* frameBuffer, packbits::Order order);
+  // Writes the stored frame over the frame buffer. False if the image is empty or does not decode.
+  bool restore(uint8_t* frameBuffer) const;
+  void clear();
+  bool empty() const { return chunks[0] == nullptr; }
+  // Bytes held, 0 when empty
+  size_t size() const;
+
+ private:
+  uint8_t* chunks[NUM_CHUNKS] = {nullptr};
+  // Stored size of each chunk, CHUNK_SIZE when it is kept raw
+  uint16_t chunkSizes[NUM_CHUNKS] = {};
+  packbits::Order order = packbits::Order::Rows;
+};
@@ -1,6 +1,7 @@
 #include "GfxRenderer.h"
 
 #include <Logging.h>
+#include <RenderTimings.h>
 #include <Utf8.h>
 
 void GfxRenderer::begin() {
@@ -11,7 +12,35 @@ void GfxRenderer::begin() {
   }
 }
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  if (findFont(fontId)) {
+    return;
+  }
+  if (fontCount == MAX_FONTS) {
+    // Text in this font would silently not draw, raise MAX_FONTS instead
+    LOG_ERR("GFX", "!! No room for font %d, %d fonts already registered", fontId, MAX_FONTS);
+    assert(false);
+    return;
+  }
+  fonts[fontCount++] = {fontId, font};
+}
+
+// Text calls come in long runs with the same font, so the last hit is checked before scanning the table. Text is
+// measured from several tasks (layout on the main loop, drawing on display tasks), so each task keeps its own.
+const EpdFontFamily* GfxRenderer::findFont(const int fontId) const {
+  thread_local const FontEntry* lastFont = nullptr;
+  // The memo may point into another renderer's table
+  if (lastFont >= fonts && lastFont < fonts + fontCount && lastFont->id == fontId) {
+    return &lastFont->family;
+  }
+  for (int i = 0; i < fontCount; i++) {
+    if (fonts[i].id == fontId) {
+      lastFont = &fonts[i];
+      return &fonts[i].family;
+    }
+  }
+  return nullptr;
+}
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
@@ -74,13 +103,27 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
+    LOG_ERR("GFX", "Font %d not found", fontId);
+    return 0;
+  }
+
+  int w = 0, h = 0;
+  font->getTextDimensions(text, &w, &h, style);
+  return w;
+}
+
+int GfxRenderer::getTextWidth(const int fontId, const char* begin, const char* end, const EpdFontFamily::Style style,
+                              const CodepointFilter skip, const uint32_t trailingCodepoint) const {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
   int w = 0, h = 0;
-  fontMap.at(fontId).getTextDimensions(text, &w, &h, style);
+  font->getTextDimensions(begin, end, &w, &h, style, skip, trailingCodepoint);
   return w;
 }
 
@@ -92,28 +135,27 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  const int yPos = y + getFontAscenderSize(fontId);
-  int xpos = x;
-
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto font = fontMap.at(fontId);
+  const int yPos = y + font->getData(EpdFontFamily::REGULAR)->ascender;
+  int xpos = x;
 
   // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  if (!font->hasPrintableChars(text, style)) {
     return;
   }
 
   uint32_t cp;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    renderChar(*font, cp, &xpos, &yPos, black, style);
   }
 }
 
@@ -408,6 +450,30 @@ void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, con
   display.drawImage(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
+namespace {
+// One screen column of a scaled bitmap: the source pixel drawn there and where the column crosses the frame buffer
+struct BitmapColumn {
+  uint16_t srcX;
+  uint16_t byteIndex;  // of the pixel in screen row 0
+  uint8_t mask;        // its bit, or 0xFF when the bit depends on the row (see drawBitmapScaled)
+};
+
+// The largest scale at most 1 that fits width x height into maxWidth x maxHeight (either <= 0 for no limit), as an
+// exact fraction
+void fitScale(const int width, const int height, const int maxWidth, const int maxHeight, int* num, int* den) {
+  *num = 1;
+  *den = 1;
+  if (maxWidth > 0 && width > maxWidth) {
+    *num = maxWidth;
+    *den = width;
+  }
+  if (maxHeight > 0 && height > maxHeight && maxHeight * *den < *num * height) {
+    *num = maxHeight;
+    *den = height;
+  }
+}
+}  // namespace
+
 void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, const int maxWidth, const int maxHeight,
                              const float cropX, const float cropY) const {
   // For 1-bit bitmaps, use optimized 1-bit rendering path (no crop support for 1-bit)
@@ -416,160 +482,154 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
     return;
   }
 
-  float scale = 1.0f;
-  bool isScaled = false;
-  int cropPixX = std::floor(bitmap.getWidth() * cropX / 2.0f);
-  int cropPixY = std::floor(bitmap.getHeight() * cropY / 2.0f);
+  const int cropPixX = static_cast<int>(bitmap.getWidth() * cropX / 2.0f);
+  const int cropPixY = static_cast<int>(bitmap.getHeight() * cropY / 2.0f);
   LOG_DBG("GFX", "Cropping %dx%d by %dx%d pix, is %s", bitmap.getWidth(), bitmap.getHeight(), cropPixX, cropPixY,
           bitmap.isTopDown() ? "top-down" : "bottom-up");
 
-  if (maxWidth > 0 && (1.0f - cropX) * bitmap.getWidth() > maxWidth) {
-    scale = static_cast<float>(maxWidth) / static_cast<float>((1.0f - cropX) * bitmap.getWidth());
-    isScaled = true;
+  int scaleNum, scaleDen;
+  fitScale(bitmap.getWidth() - 2 * cropPixX, bitmap.getHeight() - 2 * cropPixY, maxWidth, maxHeight, &scaleNum,
+           &scaleDen);
+  LOG_DBG("GFX", "Scaling by %d/%d", scaleNum, scaleDen);
+
+  // Values of the 2-bit output drawn in each mode: BW draws everything but white as black, the grayscale planes set
+  // the bits of the grays they carry
+  uint8_t drawnValues = 0;
+  switch (renderMode) {
+    case BW:
+      drawnValues = 0b0111;
+      break;
+    case GRAYSCALE_MSB:
+      drawnValues = 0b0110;
+      break;
+    case GRAYSCALE_LSB:
+      drawnValues = 0b0010;
+      break;
   }
-  if (maxHeight > 0 && (1.0f - cropY) * bitmap.getHeight() > maxHeight) {
-    scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>((1.0f - cropY) * bitmap.getHeight()));
-    isScaled = true;
+  drawBitmapScaled(bitmap, x, y, cropPixX, cropPixY, scaleNum, scaleDen, drawnValues, renderMode == BW);
+}
+
+void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y, const int maxWidth,
+                                 const int maxHeight) const {
+  int scaleNum, scaleDen;
+  fitScale(bitmap.getWidth(), bitmap.getHeight(), maxWidth, maxHeight, &scaleNum, &scaleDen);
+  // readNextRow still outputs 2 bits per pixel: black (0, 1, 2) is drawn in every mode, white (3) left alone
+  drawBitmapScaled(bitmap, x, y, 0, 0, scaleNum, scaleDen, 0b0111, true);
+}
+
+// IMPORTANT: Like drawPixel, this runs for every pixel of full-screen covers and sleep images. Everything that does
+// not change along a row is worked out up front: each screen column gets its source column and frame buffer position
+// once per bitmap, each screen row its offset once per row. Screen pixel (sx, sy) lands in byte
+// column.byteIndex + rowOffset(sy), bit column.mask & rowMask(sy): in landscape the bit follows the column, in
+// portrait the row.
+void GfxRenderer::drawBitmapScaled(const Bitmap& bitmap, const int x, const int y, const int cropPixX,
+                                   const int cropPixY, const int scaleNum, const int scaleDen,
+                                   const uint8_t drawnValues, const bool black) const {
+  const int visibleWidth = bitmap.getWidth() - 2 * cropPixX;
+  const int visibleHeight = bitmap.getHeight() - 2 * cropPixY;
+  if (visibleWidth <= 0 || visibleHeight <= 0) {
+    return;
+  }
+  // Source pixel i lands on screen pixel i * scaleNum / scaleDen, so screen pixel d shows the first source pixel
+  // landing on it, (d * scaleDen + scaleNum - 1) / scaleNum
+  const int scaledWidth = (visibleWidth - 1) * scaleNum / scaleDen + 1;
+  const int firstColumn = std::max(0, -x);
+  const int lastColumn = std::min(scaledWidth, getScreenWidth() - x);
+  const int columnCount = lastColumn - firstColumn;
+  if (columnCount <= 0) {
+    return;
   }
-  LOG_DBG("GFX", "Scaling by %f - %s", scale, isScaled ? "scaled" : "not scaled");
 
-  // Calculate output row size (2 bits per pixel, packed into bytes)
-  // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  auto* columns = static_cast<BitmapColumn*>(malloc(columnCount * sizeof(BitmapColumn)));
 
-  if (!outputRow || !rowBytes) {
+  if (!outputRow || !rowBytes || !columns) {
     LOG_ERR("GFX", "!! Failed to allocate BMP row buffers");
     free(outputRow);
     free(rowBytes);
+    free(columns);
     return;
   }
 
-  for (int bmpY = 0; bmpY < (bitmap.getHeight() - cropPixY); bmpY++) {
+  const bool bitFollowsColumn = orientation == LandscapeClockwise || orientation == LandscapeCounterClockwise;
+  int phyX = 0;
+  int phyY = 0;
+  rotateCoordinates(orientation, 0, 0, &phyX, &phyY);
+  const int originIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8;
+  for (int i = 0; i < columnCount; i++) {
+    const int d = firstColumn + i;
+    rotateCoordinates(orientation, x + d, 0, &phyX, &phyY);
+    columns[i].srcX = cropPixX + (d * scaleDen + scaleNum - 1) / scaleNum;
+    columns[i].byteIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8;
+    columns[i].mask = bitFollowsColumn ? 1 << (7 - phyX % 8) : 0xFF;
+  }
+
+  for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
     // The BMP's (0, 0) is the bottom-left corner (if the height is positive, top-left if negative).
     // Screen's (0, 0) is the top-left corner.
-    int screenY = -cropPixY + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
-    if (isScaled) {
-      screenY = std::floor(screenY * scale);
-    }
-    screenY += y;  // the offset should not be scaled
-    if (screenY >= getScreenHeight()) {
+    const int srcY = (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY) - cropPixY;
+    // Stop once the remaining rows are all cropped
+    if (bitmap.isTopDown() ? srcY >= visibleHeight : srcY < 0) {
       break;
     }
 
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
       LOG_ERR("GFX", "Failed to read row %d from bitmap", bmpY);
-      free(outputRow);
-      free(rowBytes);
-      return;
+      break;
     }
 
-    if (screenY < 0) {
+    if (srcY < 0 || srcY >= visibleHeight) {
       continue;
     }
-
-    if (bmpY < cropPixY) {
-      // Skip the row if it's outside the crop area
+    const int d = srcY * scaleNum / scaleDen;
+    if ((d * scaleDen + scaleNum - 1) / scaleNum != srcY) {
+      // Another source row is drawn on this screen row
       continue;
     }
-
-    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
-      }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
+    const int screenY = y + d;
+    if (screenY < 0 || screenY >= getScreenHeight()) {
+      // Rows further down only land further down
+      if (bitmap.isTopDown() && screenY >= getScreenHeight()) {
         break;
       }
-      if (screenX < 0) {
-        continue;
-      }
-
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
-      }
-    }
-  }
-
-  free(outputRow);
-  free(rowBytes);
-}
-
-void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y, const int maxWidth,
-                                 const int maxHeight) const {
-  float scale = 1.0f;
-  bool isScaled = false;
-  if (maxWidth > 0 && bitmap.getWidth() > maxWidth) {
-    scale = static_cast<float>(maxWidth) / static_cast<float>(bitmap.getWidth());
-    isScaled = true;
-  }
-  if (maxHeight > 0 && bitmap.getHeight() > maxHeight) {
-    scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>(bitmap.getHeight()));
-    isScaled = true;
-  }
-
-  // For 1-bit BMP, output is still 2-bit packed (for consistency with readNextRow)
-  const int outputRowSize = (bitmap.getWidth() + 3) / 4;
-  auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
-  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
-
-  if (!outputRow || !rowBytes) {
-    LOG_ERR("GFX", "!! Failed to allocate 1-bit BMP row buffers");
-    free(outputRow);
-    free(rowBytes);
-    return;
-  }
-
-  for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
-    // Read rows sequentially using readNextRow
-    if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
-      LOG_ERR("GFX", "Failed to read row %d from 1-bit bitmap", bmpY);
-      free(outputRow);
-      free(rowBytes);
-      return;
-    }
-
-    // Calculate screen Y based on whether BMP is top-down or bottom-up
-    const int bmpYOffset = bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY;
-    int screenY = y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
-    if (screenY >= getScreenHeight()) {
-      continue;  // Continue reading to keep row counter in sync
-    }
-    if (screenY < 0) {
       continue;
     }
 
-    for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
-        break;
-      }
-      if (screenX < 0) {
+    rotateCoordinates(orientation, 0, screenY, &phyX, &phyY);
+    const int rowOffset = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8 - originIndex;
+    const uint8_t rowMask = bitFollowsColumn ? 0xFF : 1 << (7 - phyX % 8);
+
+    // Bits for the same byte are collected and written together, which happens along rows in landscape
+    int pendingIndex = -1;
+    uint8_t pendingBits = 0;
+    for (int i = 0; i < columnCount; i++) {
+      const BitmapColumn& column = columns[i];
+      const uint8_t val = outputRow[column.srcX >> 2] >> (6 - (column.srcX & 3) * 2) & 0x3;
+      if (!(drawnValues >> val & 1)) {
         continue;
       }
-
-      // Get 2-bit value (result of readNextRow quantization)
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
-      // val < 3 means black pixel (draw it)
-      if (val < 3) {
-        drawPixel(screenX, screenY, true);
+      const int index = column.byteIndex + rowOffset;
+      if (index != pendingIndex) {
+        if (pendingIndex >= 0) {
+          frameBuffer[pendingIndex] = black ? frameBuffer[pendingIndex] & ~pendingBits
+                                            : frameBuffer[pendingIndex] | pendingBits;
+        }
+        pendingIndex = index;
+        pendingBits = 0;
       }
-      // White pixels (val == 3) are not drawn (leave background)
+      pendingBits |= column.mask & rowMask;
+    }
+    if (pendingIndex >= 0) {
+      frameBuffer[pendingIndex] =
+          black ? frameBuffer[pendingIndex] & ~pendingBits : frameBuffer[pendingIndex] | pendingBits;
     }
   }
 
   free(outputRow);
   free(rowBytes);
+  free(columns);
 }
 
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
@@ -649,15 +709,54 @@ void GfxRenderer::clearScreen(const uint8_t color) const {
 }
 
 void GfxRenderer::invertScreen() const {
-  for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
+  for (uint32_t i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
 }
 
+void GfxRenderer::displayBuffer() const {
+  const int changedTiles = refreshPolicy.diff(frameBuffer);
+  // The panel already shows this frame, pushing it would send the whole buffer and refresh for nothing
+  if (refreshPolicy.isShown(changedTiles)) {
+    LOG_DBG("GFX", "Frame unchanged, push skipped");
+    return;
+  }
+  pushBuffer(HalDisplay::FAST_REFRESH, changedTiles, false);
+}
+
 void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
+  pushBuffer(refreshMode, refreshPolicy.diff(frameBuffer), false);
+}
+
+void GfxRenderer::displayPageTurn(const int pagesPerRefresh) const {
+  const int changedTiles = refreshPolicy.diff(frameBuffer);
+  pushBuffer(refreshPolicy.choosePageTurn(changedTiles, pagesPerRefresh), changedTiles, true);
+}
+
+void GfxRenderer::pushBuffer(const HalDisplay::RefreshMode refreshMode, const int changedTiles,
+                             const bool pageTurn) const {
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+
+  const unsigned long refreshStart = millis();
   display.displayBuffer(refreshMode, fadingFix);
+  RENDER_TIMINGS.record(RenderTimings::REFRESH, millis() - refreshStart);
+  const int ghostingBefore = refreshPolicy.getGhostingTiles();
+  refreshPolicy.onRefresh(refreshMode, changedTiles, pageTurn);
+  // Ghosting and budget in percent of a screen, so a budget of 1400% allows 14 fully changed screens
+  LOG_DBG("GFX", "%s refresh (%s): %d%% changed, ghosting %d%% of %d%%, %lu ms",
+          refreshMode == HalDisplay::FULL_REFRESH   ? "Full"
+          : refreshMode == HalDisplay::HALF_REFRESH ? "Half"
+                                                    : "Fast",
+          pageTurn ? "page turn" : "caller", changedTiles * 100 / RefreshPolicy::TILE_COUNT,
+          ghostingBefore * 100 / RefreshPolicy::TILE_COUNT,
+          refreshPolicy.getBudgetTiles() * 100 / RefreshPolicy::TILE_COUNT, millis() - refreshStart);
+
+  int xBytes, y, widthBytes, height;
+  if (refreshPolicy.getChangedWindow(&xBytes, &y, &widthBytes, &height)) {
+    LOG_DBG("GFX", "Sent %zu bytes, %d of them in the changed window x %d-%d, rows %d-%d", getBufferSize(),
+            widthBytes * height, xBytes * 8, (xBytes + widthBytes) * 8 - 1, y, y + height - 1);
+  }
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -680,8 +779,8 @@ std::string GfxRenderer::truncatedText(const int fontId, const char* text, const
 }
 
 // Note: Internal driver treats screen in command orientation; this library exposes a logical orientation
-int GfxRenderer::getScreenWidth() const {
-  switch (orientation) {
+int GfxRenderer::getScreenWidth(const Orientation o) {
+  switch (o) {
     case Portrait:
     case PortraitInverted:
       // 480px wide in portrait logical coordinates
@@ -694,8 +793,8 @@ int GfxRenderer::getScreenWidth() const {
   return HalDisplay::DISPLAY_HEIGHT;
 }
 
-int GfxRenderer::getScreenHeight() const {
-  switch (orientation) {
+int GfxRenderer::getScreenHeight(const Orientation o) {
+  switch (o) {
     case Portrait:
     case PortraitInverted:
       // 800px tall in portrait logical coordinates
@@ -709,16 +808,18 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  return font->getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
@@ -726,35 +827,38 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text) const {
   uint32_t cp;
   int width = 0;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    width += fontMap.at(fontId).getGlyph(cp, EpdFontFamily::REGULAR)->advanceX;
+    width += font->getGlyph(cp, EpdFontFamily::REGULAR)->advanceX;
   }
   return width;
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->advanceY;
+  return font->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* font = findFont(fontId);
+  if (!font) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return 0;
   }
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return font->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -764,11 +868,12 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
+  const EpdFontFamily* found = findFont(fontId);
+  if (!found) {
     LOG_ERR("GFX", "Font %d not found", fontId);
     return;
   }
-  const auto font = fontMap.at(fontId);
+  const EpdFontFamily& font = *found;
 
   // No printable characters
   if (!font.hasPrintableChars(text, style)) {
@@ -814,7 +919,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
           if (is2Bit) {
             const uint8_t byte = bitmap[pixelPosition / 4];
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-            const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+            const uint8_t bmpVal = (3 - (byte >> bit_index)) & 0x3;
 
             if (renderMode == BW && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
@@ -851,88 +956,62 @@ void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuff
 
 void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
-
-void GfxRenderer::freeBwBufferChunks() {
-  for (auto& bwBufferChunk : bwBufferChunks) {
-    if (bwBufferChunk) {
-      free(bwBufferChunk);
-      bwBufferChunk = nullptr;
-    }
+void GfxRenderer::displayGrayBuffer() const {
+  {
+    RenderTimings::Scope timer(RenderTimings::GRAY_REFRESH);
+    display.displayGrayBuffer(fadingFix);
   }
+  // The panel now shows more than the last BW frame, so the next push must not be skipped as unchanged
+  refreshPolicy.onOverdrawn();
+}
+
+packbits::Order GfxRenderer::frameImageOrder() const {
+  return orientation == Portrait || orientation == PortraitInverted ? packbits::Order::Columns : packbits::Order::Rows;
 }
 
 /**
  * This should be called before grayscale buffers are populated.
  * A `restoreBwBuffer` call should always follow the grayscale render if this method was called.
- * Uses chunked allocation to avoid needing 48KB of contiguous memory.
+ * The buffer is kept as a FrameImage, so it needs no contiguous 48KB and a text page takes a fraction of that.
  * Returns true if buffer was stored successfully, false if allocation failed.
  */
 bool GfxRenderer::storeBwBuffer() {
-  // Allocate and copy each chunk
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if any chunks are already allocated
-    if (bwBufferChunks[i]) {
-      LOG_ERR("GFX", "!! BW buffer chunk %zu already stored - this is likely a bug, freeing chunk", i);
-      free(bwBufferChunks[i]);
-      bwBufferChunks[i] = nullptr;
-    }
-
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    bwBufferChunks[i] = static_cast<uint8_t*>(malloc(BW_BUFFER_CHUNK_SIZE));
-
-    if (!bwBufferChunks[i]) {
-      LOG_ERR("GFX", "!! Failed to allocate BW buffer chunk %zu (%zu bytes)", i, BW_BUFFER_CHUNK_SIZE);
-      // Free previously allocated chunks
-      freeBwBufferChunks();
-      return false;
-    }
+  if (!bwBuffer.empty()) {
+    LOG_ERR("GFX", "!! BW buffer already stored - this is likely a bug, replacing it");
+  }
 
-    memcpy(bwBufferChunks[i], frameBuffer + offset, BW_BUFFER_CHUNK_SIZE);
+  const unsigned long start = millis();
+  if (!bwBuffer.capture(frameBuffer, frameImageOrder())) {
+    return false;
   }
 
-  LOG_DBG("GFX", "Stored BW buffer in %zu chunks (%zu bytes each)", BW_BUFFER_NUM_CHUNKS, BW_BUFFER_CHUNK_SIZE);
+  LOG_DBG("GFX", "Stored BW buffer in %zu bytes in %lu ms", bwBuffer.size(), millis() - start);
   return true;
 }
 
 /**
  * This can only be called if `storeBwBuffer` was called prior to the grayscale render.
  * It should be called to restore the BW buffer state after grayscale rendering is complete.
- * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
-  // Check if any all chunks are allocated
-  bool missingChunks = false;
-  for (const auto& bwBufferChunk : bwBufferChunks) {
-    if (!bwBufferChunk) {
-      missingChunks = true;
-      break;
-    }
-  }
-
-  if (missingChunks) {
-    freeBwBufferChunks();
+  if (bwBuffer.empty()) {
     return;
   }
 
-  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
-    // Check if chunk is missing
-    if (!bwBufferChunks[i]) {
-      LOG_ERR("GFX", "!! BW buffer chunks not stored - this is likely a bug");
-      freeBwBufferChunks();
-      return;
-    }
-
-    const size_t offset = i * BW_BUFFER_CHUNK_SIZE;
-    memcpy(frameBuffer + offset, bwBufferChunks[i], BW_BUFFER_CHUNK_SIZE);
+  if (!bwBuffer.restore(frameBuffer)) {
+    LOG_ERR("GFX", "!! BW buffer not restored - this is likely a bug");
   }
 
   display.cleanupGrayscaleBuffers(frameBuffer);
 
-  freeBwBufferChunks();
-  LOG_DBG("GFX", "Restored and freed BW buffer chunks");
+  bwBuffer.clear();
+  LOG_DBG("GFX", "Restored and freed BW buffer");
 }
 
+bool GfxRenderer::captureFrame(FrameImage& image) const { return image.capture(frameBuffer, frameImageOrder()); }
+
+bool GfxRenderer::drawFrame(const FrameImage& image) const { return image.restore(frameBuffer); }
+
 /**
  * Cleanup grayscale buffers using the current frame buffer.
  * Use this when BW buffer was re-rendered instead of stored/restored.
@@ -978,7 +1057,7 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
           // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
           // we swap this to better match the way images and screen think about colors:
           // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+          const uint8_t bmpVal = (3 - (byte >> bit_index)) & 0x3;
 
           if (renderMode == BW && bmpVal < 3) {
             // Black (also paints over the grays in BW mode)
@@ -1006,8 +1085,9 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
   *x += glyph->advanceX;
 }
 
-void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
-  switch (orientation) {
+void GfxRenderer::getOrientedViewableTRBL(const Orientation o, int* outTop, int* outRight, int* outBottom,
+                                          int* outLeft) {
+  switch (o) {
     case Portrait:
       *outTop = VIEWABLE_MARGIN_TOP;
       *outRight = VIEWABLE_MARGIN_RIGHT;
@@ -3,9 +3,9 @@
 #include <EpdFontFamily.h>
 #include <HalDisplay.h>
 
-#include <map>
-
 #include "Bitmap.h"
+#include "FrameImage.h"
+#include "RefreshPolicy.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -24,30 +24,40 @@ class GfxRenderer {
   };
 
  private:
-  static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
-  static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
-  static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
-                "BW buffer chunking does not line up with display buffer size");
-
   HalDisplay& display;
   RenderMode renderMode;
   Orientation orientation;
   bool fadingFix;
   uint8_t* frameBuffer = nullptr;
-  uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
-  std::map<int, EpdFontFamily> fontMap;
+  FrameImage bwBuffer;
+  // Registered fonts in a flat table, searched by id. Entries never move, so the last one found can be remembered.
+  static constexpr int MAX_FONTS = 16;
+  struct FontEntry {
+    int id = 0;
+    EpdFontFamily family{nullptr};
+  };
+  FontEntry fonts[MAX_FONTS];
+  int fontCount = 0;
+  const EpdFontFamily* findFont(int fontId) const;
+  // Updated by every push, including from const drawing code
+  mutable RefreshPolicy refreshPolicy;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
-  void freeBwBufferChunks();
+  // Encode along the lines of text, which run down the panel in portrait
+  packbits::Order frameImageOrder() const;
+  void pushBuffer(HalDisplay::RefreshMode refreshMode, int changedTiles, bool pageTurn) const;
   template <Color color>
   void drawPixelDither(int x, int y) const;
   template <Color color>
   void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  // Draws the uncropped part of a bitmap scaled by scaleNum / scaleDen (at most 1). Pixels whose 2-bit value is set
+  // in drawnValues clear their bit when black, set it otherwise.
+  void drawBitmapScaled(const Bitmap& bitmap, int x, int y, int cropPixX, int cropPixY, int scaleNum, int scaleDen,
+                        uint8_t drawnValues, bool black) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
       : display(halDisplay), renderMode(BW), orientation(Portrait), fadingFix(false) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -66,14 +76,25 @@ class GfxRenderer {
   void setFadingFix(const bool enabled) { fadingFix = enabled; }
 
   // Screen ops
-  int getScreenWidth() const;
-  int getScreenHeight() const;
-  void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
+  int getScreenWidth() const { return getScreenWidth(orientation); }
+  int getScreenHeight() const { return getScreenHeight(orientation); }
+  // Orientation-explicit variants, for layout math done without touching the live renderer state
+  static int getScreenWidth(Orientation o);
+  static int getScreenHeight(Orientation o);
+  // Fast refresh, skipped if the panel already shows this frame
+  void displayBuffer() const;
+  void displayBuffer(HalDisplay::RefreshMode refreshMode) const;
+  // For reader page turns: fast refresh, with a half refresh every `pagesPerRefresh` pages or sooner once the ghosting
+  // left by fast refreshes builds up (see RefreshPolicy)
+  void displayPageTurn(int pagesPerRefresh) const;
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   // void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
-  void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
+  void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
+    getOrientedViewableTRBL(orientation, outTop, outRight, outBottom, outLeft);
+  }
+  static void getOrientedViewableTRBL(Orientation o, int* outTop, int* outRight, int* outBottom, int* outLeft);
 
   // Drawing
   void drawPixel(int x, int y, bool state = true) const;
@@ -99,6 +120,10 @@ class GfxRenderer {
 
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  // Width of the bytes [begin, end) of a longer string, measured in place. Codepoints skip() returns true for are left
+  // out, a non-zero trailingCodepoint is measured as if appended.
+  int getTextWidth(int fontId, const char* begin, const char* end, EpdFontFamily::Style style,
+                   CodepointFilter skip = nullptr, uint32_t trailingCodepoint = 0) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
@@ -117,13 +142,18 @@ class GfxRenderer {
 
   // Grayscale functions
   void setRenderMode(const RenderMode mode) { this->renderMode = mode; }
+  RenderMode getRenderMode() const { return renderMode; }
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
-  bool storeBwBuffer();    // Returns true if buffer was stored successfully
+  bool storeBwBuffer();    // Returns true if buffer was stored successfully, run-length encoded where that helps
   void restoreBwBuffer();  // Restore and free the stored buffer
   void cleanupGrayscaleWithFrameBuffer() const;
 
+  // Off-screen frames
+  bool captureFrame(FrameImage& image) const;  // Copy the frame buffer into image, false if it could not be stored
+  bool drawFrame(const FrameImage& image) const;  // Replace the frame buffer with image, false if it is empty
+
   // Low level functions
   uint8_t* getFrameBuffer() const;
   static size_t getBufferSize();
@@ -0,0 +1,147 @@
+#include "PackBits.h"
+
+namespace {
+constexpr size_t MAX_COUNT = 128;
+// Shorter repeats stay in literals: splitting them out costs as much as it saves
+constexpr size_t MIN_RUN = 3;
+
+// Walks a block in encoding order, without dividing per byte
+class Cursor {
+  const size_t rowBytes;
+  const size_t rows;
+  const bool byColumn;
+  size_t row = 0;
+  size_t column = 0;
+
+ public:
+  size_t offset = 0;
+
+  Cursor(const size_t rowBytes, const size_t rows, const packbits::Order order)
+      : rowBytes(rowBytes), rows(rows), byColumn(order == packbits::Order::Columns) {}
+
+  void next() {
+    if (!byColumn) {
+      offset++;
+    } else if (++row == rows) {
+      row = 0;
+      offset = ++column;
+    } else {
+      offset += rowBytes;
+    }
+  }
+};
+
+// Builds the output one byte at a time. The current literal keeps its control byte slot at out[written] until a
+// run or the end closes it. Only counts when out is null.
+class Packer {
+  uint8_t* out;
+  size_t literalCount = 0;
+  uint8_t runValue = 0;
+  size_t runLength = 0;
+
+  void addLiteral(const uint8_t value) {
+    if (literalCount == MAX_COUNT) {
+      closeLiteral();
+    }
+    if (out) {
+      out[written + 1 + literalCount] = value;
+    }
+    literalCount++;
+  }
+
+  void closeLiteral() {
+    if (literalCount == 0) {
+      return;
+    }
+    if (out) {
+      out[written] = static_cast<uint8_t>(literalCount - 1);
+    }
+    written += 1 + literalCount;
+    literalCount = 0;
+  }
+
+  void closeRun() {
+    if (runLength >= MIN_RUN) {
+      closeLiteral();
+      if (out) {
+        out[written] = static_cast<uint8_t>(257 - runLength);
+        out[written + 1] = runValue;
+      }
+      written += 2;
+    } else {
+      for (size_t i = 0; i < runLength; i++) {
+        addLiteral(runValue);
+      }
+    }
+    runLength = 0;
+  }
+
+ public:
+  size_t written = 0;
+
+  explicit Packer(uint8_t* out) : out(out) {}
+
+  void add(const uint8_t value) {
+    if (runLength > 0 && value == runValue && runLength < MAX_COUNT) {
+      runLength++;
+      return;
+    }
+    closeRun();
+    runValue = value;
+    runLength = 1;
+  }
+
+  size_t finish() {
+    closeRun();
+    closeLiteral();
+    return written;
+  }
+};
+}  // namespace
+
+namespace packbits {
+size_t encodedSize(const uint8_t* block, const size_t rowBytes, const size_t rows, const Order order) {
+  return encode(block, rowBytes, rows, order, nullptr);
+}
+
+size_t encode(const uint8_t* block, const size_t rowBytes, const size_t rows, const Order order, uint8_t* out) {
+  Packer packer(out);
+  Cursor cursor(rowBytes, rows, order);
+  for (size_t i = rowBytes * rows; i > 0; i--, cursor.next()) {
+    packer.add(block[cursor.offset]);
+  }
+  return packer.finish();
+}
+
+bool decode(const uint8_t* in, const size_t inSize, uint8_t* block, const size_t rowBytes, const size_t rows,
+            const Order order) {
+  const size_t size = rowBytes * rows;
+  Cursor cursor(rowBytes, rows, order);
+  size_t read = 0;
+  size_t written = 0;
+  while (read < inSize) {
+    const uint8_t control = in[read++];
+    if (control < 128) {
+      const size_t count = control + 1;
+      if (read + count > inSize || written + count > size) {
+        return false;
+      }
+      for (size_t i = 0; i < count; i++, cursor.next()) {
+        block[cursor.offset] = in[read++];
+      }
+      written += count;
+    } else if (control > 128) {
+      const size_t count = 257 - control;
+      if (read >= inSize || written + count > size) {
+        return false;
+      }
+      const uint8_t value = in[read++];
+      for (size_t i = 0; i < count; i++, cursor.next()) {
+        block[cursor.offset] = value;
+      }
+      written += count;
+    }
+  }
+  return written == size;
+}
+}  // namespace packbits
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Run-length encoding for frame buffer snapshots, in the PackBits layout: a control byte n below 128 is followed by
+// n + 1 literal bytes, one above 128 by a single byte repeated 257 - n times.
+//
+// A block of `rows` rows of `rowBytes` bytes is encoded row by row or column by column. Text compresses well along
+// its lines, where the gaps between words and lines give long runs of white, and poorly across them, so the order
+// should follow the lines: rows in landscape, columns in portrait, where a line of text runs down the panel. Dithered
+// images barely shrink either way, so callers should compare encodedSize() with the raw size first.
+namespace packbits {
+enum class Order : uint8_t { Rows, Columns };
+
+// Bytes encode() writes for this block
+size_t encodedSize(const uint8_t* block, size_t rowBytes, size_t rows, Order order);
+// Writes encodedSize() bytes to out and returns that count
+size_t encode(const uint8_t* block, size_t rowBytes, size_t rows, Order order, uint8_t* out);
+// False if the input is malformed or does not decode to exactly the block
+bool decode(const uint8_t* in, size_t inSize, uint8_t* block, size_t rowBytes, size_t rows, Order order);
+}  // namespace packbits
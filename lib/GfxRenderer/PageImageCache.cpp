@@ -0,0 +1,94 @@
+#include "PageImageCache.h"
+
+#include <Logging.h>
+
+#include "GfxRenderer.h"
+
+const FrameImage* PageImageCache::find(const int page) {
+  lookups++;
+  const int slot = page >= 0 ? slotOf(page) : -1;
+  if (slot < 0) {
+    return nullptr;
+  }
+  hits++;
+  slots[slot].lastUse = ++useCounter;
+  return &slots[slot].image;
+}
+
+bool PageImageCache::store(const GfxRenderer& renderer, const int page) {
+  int slot = slotOf(page);
+  if (slot < 0) {
+    slot = slotOf(-1);
+  }
+  if (slot < 0) {
+    slot = leastRecentlyUsed(page);
+  }
+
+  Slot& target = slots[slot];
+  target.page = -1;
+  if (!renderer.captureFrame(target.image)) {
+    // Out of memory, make room for whatever needed it
+    clear();
+    return false;
+  }
+  target.page = page;
+  target.lastUse = ++useCounter;
+
+  while (size() > BUDGET_BYTES) {
+    const int victim = leastRecentlyUsed(page);
+    if (victim < 0) {
+      break;
+    }
+    LOG_DBG("GFX", "Page image cache over budget, dropping page %d", slots[victim].page);
+    drop(slots[victim]);
+  }
+  return true;
+}
+
+void PageImageCache::clear() {
+  for (auto& slot : slots) {
+    drop(slot);
+  }
+}
+
+bool PageImageCache::empty() const {
+  for (const auto& slot : slots) {
+    if (slot.page >= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t PageImageCache::size() const {
+  size_t total = 0;
+  for (const auto& slot : slots) {
+    total += slot.image.size();
+  }
+  return total;
+}
+
+int PageImageCache::slotOf(const int page) const {
+  for (int i = 0; i < SLOTS; i++) {
+    if (slots[i].page == page) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int PageImageCache::leastRecentlyUsed(const int keep) const {
+  int candidate = -1;
+  for (int i = 0; i < SLOTS; i++) {
+    if (slots[i].page >= 0 && slots[i].page != keep &&
+        (candidate < 0 || slots[i].lastUse < slots[candidate].lastUse)) {
+      candidate = i;
+    }
+  }
+  return candidate;
+}
+
+void PageImageCache::drop(Slot& slot) {
+  slot.image.clear();
+  slot.page = -1;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "FrameImage.h"
+
+class GfxRenderer;
+
+// Frame images of the last few pages shown or rendered ahead, so turning to one of them only has to put it back.
+// Pages are plain indices, the owner clears the cache whenever they stop meaning the same layout. The least recently
+// used page goes first, when all slots are taken or the images together go over the byte budget.
+class PageImageCache {
+ public:
+  static constexpr int SLOTS = 4;
+  static constexpr size_t BUDGET_BYTES = 64 * 1024;
+
+  // The page's image, nullptr if it is not cached. Counts towards the hit rate and makes the page the most recent.
+  const FrameImage* find(int page);
+  bool contains(int page) const { return page >= 0 && slotOf(page) >= 0; }
+  // Captures the frame buffer as the given page. Returns false, leaving the page uncached, if it could not be stored.
+  bool store(const GfxRenderer& renderer, int page);
+  void clear();
+  bool empty() const;
+  // Bytes held by all images
+  size_t size() const;
+  int getHits() const { return hits; }
+  int getLookups() const { return lookups; }
+
+ private:
+  struct Slot {
+    int page = -1;
+    uint32_t lastUse = 0;
+    FrameImage image;
+  };
+  Slot slots[SLOTS];
+  uint32_t useCounter = 0;
+  int hits = 0;
+  int lookups = 0;
+
+  // Slot holding the page, -1 for none. Page -1 finds a free slot.
+  int slotOf(int page) const;
+  // Least recently used slot holding a page other than `keep`, -1 if there is none
+  int leastRecentlyUsed(int keep) const;
+  void drop(Slot& slot);
+};
@@ -0,0 +1,65 @@
+#include "RefreshPolicy.h"
+
+int RefreshPolicy::diff(const uint8_t* frameBuffer) {
+  int changedTiles = 0;
+  changedColumns = 0;
+  changedRows = 0;
+  for (int tileY = 0; tileY < TILES_DOWN; tileY++) {
+    for (int tileX = 0; tileX < TILES_ACROSS; tileX++) {
+      // FNV-1a over the tile's rows
+      uint32_t hash = 2166136261u;
+      const uint8_t* row = frameBuffer + tileY * TILE_ROWS * HalDisplay::DISPLAY_WIDTH_BYTES + tileX * TILE_ROW_BYTES;
+      for (int y = 0; y < TILE_ROWS; y++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+        for (int x = 0; x < TILE_ROW_BYTES; x++) {
+          hash = (hash ^ row[x]) * 16777619u;
+        }
+      }
+
+      uint32_t& tileHash = tileHashes[tileY * TILES_ACROSS + tileX];
+      if (!hasFrame || tileHash != hash) {
+        changedTiles++;
+        changedColumns |= 1u << tileX;
+        changedRows |= 1u << tileY;
+      }
+      tileHash = hash;
+    }
+  }
+  hasFrame = true;
+  return changedTiles;
+}
+
+bool RefreshPolicy::getChangedWindow(int* xBytes, int* y, int* widthBytes, int* height) const {
+  if (changedRows == 0) {
+    return false;
+  }
+  const int firstColumn = __builtin_ctz(changedColumns);
+  const int firstRow = __builtin_ctz(changedRows);
+  *xBytes = firstColumn * TILE_ROW_BYTES;
+  *y = firstRow * TILE_ROWS;
+  *widthBytes = (32 - __builtin_clz(changedColumns) - firstColumn) * TILE_ROW_BYTES;
+  *height = (32 - __builtin_clz(changedRows) - firstRow) * TILE_ROWS;
+  return true;
+}
+
+HalDisplay::RefreshMode RefreshPolicy::choosePageTurn(const int changedTiles, const int pagesPerRefresh) {
+  // The half refreshed page is one of the pages counted
+  budgetTiles = (pagesPerRefresh - 1) * TILE_COUNT;
+  if (pageTurns + 1 >= pagesPerRefresh) {
+    return HalDisplay::HALF_REFRESH;
+  }
+  // Menus and popups opened over the page leave ghosting too, so enough of them bring the half refresh forward
+  return ghostingTiles + changedTiles > budgetTiles ? HalDisplay::HALF_REFRESH : HalDisplay::FAST_REFRESH;
+}
+
+void RefreshPolicy::onRefresh(const HalDisplay::RefreshMode mode, const int changedTiles, const bool pageTurn) {
+  lastFrameShown = true;
+  if (mode == HalDisplay::FAST_REFRESH) {
+    ghostingTiles += changedTiles;
+    if (pageTurn) {
+      pageTurns++;
+    }
+  } else {
+    ghostingTiles = 0;
+    pageTurns = 0;
+  }
+}
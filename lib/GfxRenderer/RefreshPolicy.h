@@ -0,0 +1,55 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstdint>
+
+// Tracks what each push changed and picks the refresh mode for reader page turns. Frames are compared as tiles of 80x16
+// native pixels, each remembered as a hash of its bytes in the last frame pushed, so no second frame buffer is kept.
+// The changed tiles tell which panel rows a push actually changes and how much ghosting fast refreshes have built up
+// since the last half or full refresh. Page turns get a half refresh every few pages, or sooner once that ghosting
+// goes over budget.
+class RefreshPolicy {
+ public:
+  static constexpr int TILE_ROW_BYTES = 10;
+  static constexpr int TILE_ROWS = 16;
+  static constexpr int TILES_ACROSS = HalDisplay::DISPLAY_WIDTH_BYTES / TILE_ROW_BYTES;
+  static constexpr int TILES_DOWN = HalDisplay::DISPLAY_HEIGHT / TILE_ROWS;
+  static constexpr int TILE_COUNT = TILES_ACROSS * TILES_DOWN;
+  static_assert(TILES_ACROSS * TILE_ROW_BYTES == HalDisplay::DISPLAY_WIDTH_BYTES &&
+                    TILES_DOWN * TILE_ROWS == HalDisplay::DISPLAY_HEIGHT,
+                "Tiles must cover the display exactly");
+  static_assert(TILES_ACROSS <= 32 && TILES_DOWN <= 32, "Changed tile rows and columns must fit 32-bit masks");
+
+  // Hashes the frame and returns how many tiles differ from the last one. Every tile counts as changed before the
+  // first frame.
+  int diff(const uint8_t* frameBuffer);
+  // Smallest window of the panel, in bytes across and rows down, that holds every tile changed in the last diff. False
+  // if none changed.
+  bool getChangedWindow(int* xBytes, int* y, int* widthBytes, int* height) const;
+  // True when the panel still shows the last frame pushed and the one just diffed matches it, so pushing it is a no-op
+  bool isShown(int changedTiles) const { return changedTiles == 0 && lastFrameShown; }
+  // The panel was drawn over some other way, such as a grayscale pass, so the next frame has to be pushed
+  void onOverdrawn() { lastFrameShown = false; }
+  // Mode for a page turn: half refresh on every `pagesPerRefresh`th page turn, or once the ghosting a fast refresh
+  // would add goes over that many screens less one, otherwise fast refresh
+  HalDisplay::RefreshMode choosePageTurn(int changedTiles, int pagesPerRefresh);
+  // Call once the frame went out: fast refreshes add the changed tiles to the ghosting, half and full ones clear it
+  // along with the page turn count
+  void onRefresh(HalDisplay::RefreshMode mode, int changedTiles, bool pageTurn);
+  int getGhostingTiles() const { return ghostingTiles; }
+  int getBudgetTiles() const { return budgetTiles; }
+
+ private:
+  uint32_t tileHashes[TILE_COUNT] = {};
+  bool hasFrame = false;
+  bool lastFrameShown = false;
+  // Tile columns and rows with a change in the last diff, bit n for column or row n
+  uint32_t changedColumns = 0;
+  uint32_t changedRows = 0;
+  int ghostingTiles = 0;
+  // Fast refreshed page turns since the last half or full refresh
+  int pageTurns = 0;
+  // Set by the last page turn, for the log
+  int budgetTiles = 0;
+};
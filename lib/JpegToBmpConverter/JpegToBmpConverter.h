@@ -8,7 +8,8 @@ class JpegToBmpConverter {
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
                                         unsigned char* pBytes_actually_read, void* pCallback_data);
   static bool jpegFileToBmpStreamInternal(class FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
-                                          bool oneBit, bool crop = true);
+                                          bool oneBit, bool crop = true, int* outWidth = nullptr,
+                                          int* outHeight = nullptr);
 
  public:
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, bool crop = true);
@@ -16,4 +17,8 @@ class JpegToBmpConverter {
   static bool jpegFileToBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
   // Convert to 1-bit BMP (black and white only, no grays) for fast home screen rendering
   static bool jpegFileTo1BitBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Convert to 1-bit BMP scaled down to fit within the box, uncropped (for images inside a chapter). The size of the
+  // BMP written is returned in outWidth and outHeight.
+  static bool jpegFileTo1BitBmpStreamToFit(FsFile& jpegFile, Print& bmpOut, int maxWidth, int maxHeight, int* outWidth,
+                                           int* outHeight);
 };
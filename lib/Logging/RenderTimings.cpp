@@ -0,0 +1,111 @@
+#include "RenderTimings.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Logging.h"
+
+RenderTimings RenderTimings::instance;
+
+#ifdef ENABLE_RENDER_TIMINGS
+namespace {
+const char* const PHASE_NAMES[] = {"section_load", "section_build", "page_load",   "rasterise",
+                                   "grayscale",    "refresh",       "gray_refresh", "image_build"};
+static_assert(sizeof(PHASE_NAMES) / sizeof(PHASE_NAMES[0]) == RenderTimings::PHASE_COUNT,
+              "Every phase needs a report name");
+}  // namespace
+
+void RenderTimings::setActivity(const char* name) {
+  portENTER_CRITICAL(&lock);
+  int slot = -1;
+  for (int i = 0; i < MAX_ACTIVITIES; i++) {
+    if (strncmp(activities[i].name, name, NAME_LENGTH - 1) == 0) {
+      slot = i;
+      break;
+    }
+  }
+
+  if (slot < 0) {
+    // Take a free slot, or the one of the activity seen longest ago
+    slot = 0;
+    for (int i = 0; i < MAX_ACTIVITIES; i++) {
+      if (activities[i].name[0] == '\0') {
+        slot = i;
+        break;
+      }
+      if (activities[i].lastUse < activities[slot].lastUse) {
+        slot = i;
+      }
+    }
+    activities[slot] = ActivityStats{};
+    strncpy(activities[slot].name, name, NAME_LENGTH - 1);
+  }
+
+  activities[slot].lastUse = ++useCounter;
+  current = slot;
+  portEXIT_CRITICAL(&lock);
+}
+
+void RenderTimings::record(const Phase phase, const unsigned long ms) {
+  if (phase >= PHASE_COUNT) {
+    return;
+  }
+
+  portENTER_CRITICAL(&lock);
+  if (current < 0) {
+    portEXIT_CRITICAL(&lock);
+    return;
+  }
+  Stats& stats = activities[current].phases[phase];
+  const auto duration = static_cast<uint32_t>(ms);
+  stats.min = stats.count == 0 ? duration : std::min(stats.min, duration);
+  stats.max = std::max(stats.max, duration);
+  stats.total += duration;
+  stats.recent[stats.count % SAMPLES] = static_cast<uint16_t>(std::min<uint32_t>(duration, UINT16_MAX));
+  stats.count++;
+  portEXIT_CRITICAL(&lock);
+}
+
+uint32_t RenderTimings::percentile95(const Stats& stats) {
+  uint16_t sorted[SAMPLES];
+  const int samples = static_cast<int>(std::min<uint32_t>(stats.count, SAMPLES));
+  std::copy(stats.recent, stats.recent + samples, sorted);
+  std::sort(sorted, sorted + samples);
+  // Nearest rank
+  return sorted[(samples * 95 + 99) / 100 - 1];
+}
+
+void RenderTimings::report() const {
+  logSerial.printf("TIMINGS_START\n");
+  for (int slot = 0; slot < MAX_ACTIVITIES; slot++) {
+    // Printing is slow, so only the copy is made with the lock held
+    portENTER_CRITICAL(&lock);
+    const ActivityStats activity = activities[slot];
+    portEXIT_CRITICAL(&lock);
+    if (activity.name[0] == '\0') {
+      continue;
+    }
+    for (int phase = 0; phase < PHASE_COUNT; phase++) {
+      const Stats& stats = activity.phases[phase];
+      if (stats.count == 0) {
+        continue;
+      }
+      logSerial.printf("TIMING:%s:%s:%lu:%lu:%lu:%lu:%lu\n", activity.name, PHASE_NAMES[phase],
+                       static_cast<unsigned long>(stats.count), static_cast<unsigned long>(stats.min),
+                       static_cast<unsigned long>(stats.total / stats.count),
+                       static_cast<unsigned long>(percentile95(stats)), static_cast<unsigned long>(stats.max));
+    }
+  }
+  logSerial.printf("TIMINGS_END\n");
+}
+
+void RenderTimings::reset() {
+  portENTER_CRITICAL(&lock);
+  for (auto& activity : activities) {
+    for (auto& stats : activity.phases) {
+      stats = Stats{};
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+}
+#endif
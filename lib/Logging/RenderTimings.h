@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+Define ENABLE_RENDER_TIMINGS to keep the timings (about 4 KB of RAM). Without it every call is an empty inline, so
+builds that don't need them pay nothing.
+
+Durations of the steps of getting a screen out, kept per activity so a slow page turn can be broken down. Each phase
+keeps a count, min, max and total, and its last SAMPLES durations for the 95th percentile. `CMD:TIMINGS` over serial
+prints the table, `CMD:TIMINGS_RESET` clears it (see scripts/debugging_monitor.py).
+*/
+class RenderTimings {
+ public:
+  enum Phase : uint8_t {
+    SECTION_LOAD,   // Opening a cached section
+    SECTION_BUILD,  // Laying out a section that has no cache yet
+    PAGE_LOAD,      // Reading a page back from the section cache
+    RASTERISE,      // Drawing a page into the BW frame buffer
+    GRAYSCALE,      // Drawing and copying the grayscale planes
+    REFRESH,        // Sending the BW frame and waiting for the panel
+    GRAY_REFRESH,   // Showing the grayscale planes
+    IMAGE_BUILD,    // Decoding and storing one image of a section being built
+    PHASE_COUNT
+  };
+
+#ifdef ENABLE_RENDER_TIMINGS
+  // Times a block: records the phase when it goes out of scope
+  class Scope {
+   public:
+    explicit Scope(const Phase phase) : phase(phase), start(millis()) {}
+    ~Scope() { getInstance().record(phase, millis() - start); }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    Phase phase;
+    unsigned long start;
+  };
+
+  static RenderTimings& getInstance() { return instance; }
+
+  // Phases recorded from now on count for this activity
+  void setActivity(const char* name);
+  void record(Phase phase, unsigned long ms);
+  // One `TIMING:<activity>:<phase>:<count>:<min>:<avg>:<p95>:<max>` line per recorded phase, in ms, between
+  // TIMINGS_START and TIMINGS_END
+  void report() const;
+  void reset();
+
+ private:
+  static constexpr int MAX_ACTIVITIES = 6;
+  static constexpr int SAMPLES = 32;
+  static constexpr size_t NAME_LENGTH = 24;
+
+  struct Stats {
+    uint32_t count = 0;
+    uint32_t min = 0;
+    uint32_t max = 0;
+    uint32_t total = 0;
+    // Ring of the last SAMPLES durations, clamped to 16 bits
+    uint16_t recent[SAMPLES] = {};
+  };
+  struct ActivityStats {
+    char name[NAME_LENGTH] = {};
+    uint32_t lastUse = 0;
+    Stats phases[PHASE_COUNT];
+  };
+
+  static RenderTimings instance;
+  // Phases are recorded from display tasks and the loading code while the main loop reports and resets
+  mutable portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+  ActivityStats activities[MAX_ACTIVITIES];
+  int current = -1;
+  uint32_t useCounter = 0;
+
+  static uint32_t percentile95(const Stats& stats);
+#else
+  class Scope {
+   public:
+    explicit Scope(Phase) {}
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  };
+
+  static RenderTimings& getInstance() { return instance; }
+
+  void setActivity(const char*) {}
+  void record(Phase, unsigned long) {}
+  void report() const {}
+  void reset() {}
+
+ private:
+  static RenderTimings instance;
+#endif
+};
+
+#define RENDER_TIMINGS RenderTimings::getInstance()
@@ -0,0 +1,504 @@
+#include "PngToBmpConverter.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <miniz.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "BitmapWriter.h"
+
+namespace {
+constexpr int TARGET_MAX_WIDTH = 480;   // Max width for cover images (portrait display width)
+constexpr int TARGET_MAX_HEIGHT = 800;  // Max height for cover images (portrait display height)
+
+// Memory grows with the width only, the height just takes longer
+constexpr uint32_t MAX_IMAGE_WIDTH = 2048;
+constexpr uint32_t MAX_IMAGE_HEIGHT = 8192;
+constexpr size_t READ_BUFFER_SIZE = 1024;
+
+constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+enum ColorType : uint8_t { GRAY = 0, RGB = 2, PALETTE = 3, GRAY_ALPHA = 4, RGB_ALPHA = 6 };
+
+struct PngImage {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint8_t bitDepth = 0;
+  uint8_t colorType = 0;
+  // Bytes of one scanline, without its filter type byte
+  size_t rowBytes = 0;
+  // Distance to the byte of the pixel to the left that filters compare against, at least 1
+  int filterStride = 1;
+  bool hasPalette = false;
+  // Palette entries in gray, already composited over white with their alpha
+  uint8_t paletteGray[256] = {};
+  // Samples that mark a transparent pixel in gray and RGB images
+  bool hasColorKey = false;
+  uint16_t keyRed = 0;
+  uint16_t keyGreen = 0;
+  uint16_t keyBlue = 0;
+};
+
+uint32_t readBE32(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 |
+         static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+}
+
+uint16_t readBE16(const uint8_t* bytes) { return static_cast<uint16_t>(bytes[0] << 8 | bytes[1]); }
+
+// Same weights as the JPEG path, so covers look alike whatever their format
+uint8_t toGray(const uint8_t r, const uint8_t g, const uint8_t b) { return (r * 25 + g * 50 + b * 25) / 100; }
+
+// Transparent pixels show the page
+uint8_t onWhite(const uint8_t gray, const uint8_t alpha) { return (gray * alpha + 255 * (255 - alpha)) / 255; }
+
+// 8- or 16-bit sample, compared whole against the color key
+uint16_t sampleAt(const uint8_t* bytes, const int sampleBytes) { return sampleBytes == 2 ? readBE16(bytes) : bytes[0]; }
+
+uint8_t paeth(const uint8_t a, const uint8_t b, const uint8_t c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  if (pb <= pc) return b;
+  return c;
+}
+
+bool parseHeader(const uint8_t* data, PngImage& png) {
+  png.width = readBE32(data);
+  png.height = readBE32(data + 4);
+  png.bitDepth = data[8];
+  png.colorType = data[9];
+  const uint8_t compression = data[10];
+  const uint8_t filter = data[11];
+  const uint8_t interlace = data[12];
+
+  LOG_DBG("PNG", "PNG dimensions: %ux%u, bit depth: %d, color type: %d, interlaced: %d", png.width, png.height,
+          png.bitDepth, png.colorType, interlace);
+
+  if (png.width == 0 || png.height == 0 || png.width > MAX_IMAGE_WIDTH || png.height > MAX_IMAGE_HEIGHT) {
+    LOG_DBG("PNG", "Image too large (%ux%u), max supported: %ux%u", png.width, png.height, MAX_IMAGE_WIDTH,
+            MAX_IMAGE_HEIGHT);
+    return false;
+  }
+  if (compression != 0 || filter != 0) {
+    LOG_ERR("PNG", "Unknown compression or filter method");
+    return false;
+  }
+  if (interlace != 0) {
+    // Adam7 passes each cover the whole image, so rows can't be handed on as they come
+    LOG_ERR("PNG", "Interlaced PNG not supported");
+    return false;
+  }
+
+  int channels;
+  bool validDepth;
+  const uint8_t depth = png.bitDepth;
+  switch (png.colorType) {
+    case GRAY:
+      channels = 1;
+      validDepth = depth == 1 || depth == 2 || depth == 4 || depth == 8 || depth == 16;
+      break;
+    case PALETTE:
+      channels = 1;
+      validDepth = depth == 1 || depth == 2 || depth == 4 || depth == 8;
+      break;
+    case RGB:
+      channels = 3;
+      validDepth = depth == 8 || depth == 16;
+      break;
+    case GRAY_ALPHA:
+      channels = 2;
+      validDepth = depth == 8 || depth == 16;
+      break;
+    case RGB_ALPHA:
+      channels = 4;
+      validDepth = depth == 8 || depth == 16;
+      break;
+    default:
+      channels = 0;
+      validDepth = false;
+      break;
+  }
+  if (!validDepth) {
+    LOG_ERR("PNG", "Invalid color type %d with bit depth %d", png.colorType, depth);
+    return false;
+  }
+
+  const int bitsPerPixel = channels * depth;
+  png.rowBytes = (static_cast<size_t>(png.width) * bitsPerPixel + 7) / 8;
+  png.filterStride = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+  return true;
+}
+
+void parsePalette(const uint8_t* data, const uint32_t length, PngImage& png) {
+  const uint32_t entries = length / 3 > 256 ? 256 : length / 3;
+  for (uint32_t i = 0; i < entries; i++) {
+    png.paletteGray[i] = toGray(data[i * 3], data[i * 3 + 1], data[i * 3 + 2]);
+  }
+  png.hasPalette = true;
+}
+
+void parseTransparency(const uint8_t* data, const uint32_t length, PngImage& png) {
+  if (png.colorType == PALETTE) {
+    // Alpha of the first entries, the rest stay opaque
+    for (uint32_t i = 0; i < length && i < 256; i++) {
+      png.paletteGray[i] = onWhite(png.paletteGray[i], data[i]);
+    }
+  } else if (png.colorType == GRAY && length >= 2) {
+    png.hasColorKey = true;
+    png.keyRed = png.keyGreen = png.keyBlue = readBE16(data);
+  } else if (png.colorType == RGB && length >= 6) {
+    png.hasColorKey = true;
+    png.keyRed = readBE16(data);
+    png.keyGreen = readBE16(data + 2);
+    png.keyBlue = readBE16(data + 4);
+  }
+}
+
+// Turns an unfiltered scanline into one gray byte per pixel
+void scanlineToGray(const PngImage& png, const uint8_t* row, uint8_t* gray) {
+  const int depth = png.bitDepth;
+  const int sampleBytes = depth == 16 ? 2 : 1;
+
+  if (depth < 8) {
+    // Packed gray or palette indices, leftmost pixel in the high bits
+    const int mask = (1 << depth) - 1;
+    for (uint32_t x = 0; x < png.width; x++) {
+      const uint32_t bit = x * depth;
+      const int sample = (row[bit >> 3] >> (8 - depth - (bit & 7))) & mask;
+      if (png.colorType == PALETTE) {
+        gray[x] = png.paletteGray[sample];
+      } else {
+        gray[x] = png.hasColorKey && sample == png.keyRed ? 255 : sample * 255 / mask;
+      }
+    }
+    return;
+  }
+
+  switch (png.colorType) {
+    case PALETTE:
+      for (uint32_t x = 0; x < png.width; x++) {
+        gray[x] = png.paletteGray[row[x]];
+      }
+      break;
+    case GRAY:
+      for (uint32_t x = 0; x < png.width; x++, row += sampleBytes) {
+        gray[x] = png.hasColorKey && sampleAt(row, sampleBytes) == png.keyRed ? 255 : row[0];
+      }
+      break;
+    case GRAY_ALPHA:
+      for (uint32_t x = 0; x < png.width; x++, row += 2 * sampleBytes) {
+        gray[x] = onWhite(row[0], row[sampleBytes]);
+      }
+      break;
+    case RGB:
+      for (uint32_t x = 0; x < png.width; x++, row += 3 * sampleBytes) {
+        if (png.hasColorKey && sampleAt(row, sampleBytes) == png.keyRed &&
+            sampleAt(row + sampleBytes, sampleBytes) == png.keyGreen &&
+            sampleAt(row + 2 * sampleBytes, sampleBytes) == png.keyBlue) {
+          gray[x] = 255;
+        } else {
+          gray[x] = toGray(row[0], row[sampleBytes], row[2 * sampleBytes]);
+        }
+      }
+      break;
+    case RGB_ALPHA:
+      for (uint32_t x = 0; x < png.width; x++, row += 4 * sampleBytes) {
+        gray[x] = onWhite(toGray(row[0], row[sampleBytes], row[2 * sampleBytes]), row[3 * sampleBytes]);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// Inflates the image data as it's read and hands each scanline, unfiltered and in gray, to the writer. Only the
+// scanline being filled and the one above it are kept, besides the inflate window.
+class ScanlineDecoder {
+ public:
+  ScanlineDecoder(const PngImage& png, BitmapWriter& writer) : png(png), writer(writer) {}
+
+  ~ScanlineDecoder() {
+    free(inflator);
+    free(window);
+    free(current);
+    free(previous);
+    free(gray);
+  }
+
+  ScanlineDecoder(const ScanlineDecoder&) = delete;
+  ScanlineDecoder& operator=(const ScanlineDecoder&) = delete;
+
+  bool begin() {
+    const size_t scanlineBytes = png.rowBytes + 1;
+    inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+    window = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+    current = static_cast<uint8_t*>(malloc(scanlineBytes));
+    // The row above the first one counts as zeros
+    previous = static_cast<uint8_t*>(calloc(scanlineBytes, 1));
+    gray = static_cast<uint8_t*>(malloc(png.width));
+    if (!inflator || !window || !current || !previous || !gray) {
+      LOG_ERR("PNG", "Failed to allocate decode buffers (%u-byte scanlines)", static_cast<uint32_t>(scanlineBytes));
+      return false;
+    }
+    memset(inflator, 0, sizeof(tinfl_decompressor));
+    tinfl_init(inflator);
+    return true;
+  }
+
+  // Feeds the next bytes of the zlib stream. False if it's corrupt.
+  bool feed(const uint8_t* data, size_t size) {
+    while (!isDone()) {
+      size_t inBytes = size;
+      size_t outBytes = TINFL_LZ_DICT_SIZE - windowCursor;
+      const tinfl_status status =
+          tinfl_decompress(inflator, data, &inBytes, window, window + windowCursor, &outBytes,
+                           TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+      data += inBytes;
+      size -= inBytes;
+
+      if (!takeBytes(window + windowCursor, outBytes)) {
+        return false;
+      }
+      // Update output position in buffer (with wraparound)
+      windowCursor = (windowCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+      if (status < 0) {
+        LOG_ERR("PNG", "Inflate failed with status %d", status);
+        return false;
+      }
+      if (status == TINFL_STATUS_DONE) {
+        if (!isDone()) {
+          LOG_ERR("PNG", "Image data ended after %u of %u rows", rowsDone, png.height);
+          return false;
+        }
+        break;
+      }
+      if (status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+        break;
+      }
+    }
+    return true;
+  }
+
+  // Every row went to the writer. The stream's checksum isn't waited for.
+  bool isDone() const { return rowsDone == png.height; }
+
+ private:
+  bool takeBytes(const uint8_t* bytes, size_t count) {
+    const size_t scanlineBytes = png.rowBytes + 1;
+    while (count > 0 && !isDone()) {
+      const size_t take = count < scanlineBytes - filled ? count : scanlineBytes - filled;
+      memcpy(current + filled, bytes, take);
+      filled += take;
+      bytes += take;
+      count -= take;
+      if (filled < scanlineBytes) {
+        break;
+      }
+
+      if (!unfilter()) {
+        LOG_ERR("PNG", "Unknown filter type %d at row %u", current[0], rowsDone);
+        return false;
+      }
+      scanlineToGray(png, current + 1, gray);
+      writer.writeRow(gray);
+      rowsDone++;
+
+      uint8_t* done = current;
+      current = previous;
+      previous = done;
+      filled = 0;
+    }
+    return true;
+  }
+
+  bool unfilter() {
+    uint8_t* row = current + 1;
+    const uint8_t* above = previous + 1;
+    const size_t length = png.rowBytes;
+    const size_t stride = png.filterStride;
+    switch (current[0]) {
+      case 0:  // None
+        break;
+      case 1:  // Sub
+        for (size_t i = stride; i < length; i++) {
+          row[i] += row[i - stride];
+        }
+        break;
+      case 2:  // Up
+        for (size_t i = 0; i < length; i++) {
+          row[i] += above[i];
+        }
+        break;
+      case 3:  // Average
+        for (size_t i = 0; i < stride && i < length; i++) {
+          row[i] += above[i] / 2;
+        }
+        for (size_t i = stride; i < length; i++) {
+          row[i] += (row[i - stride] + above[i]) / 2;
+        }
+        break;
+      case 4:  // Paeth
+        for (size_t i = 0; i < stride && i < length; i++) {
+          row[i] += above[i];
+        }
+        for (size_t i = stride; i < length; i++) {
+          row[i] += paeth(row[i - stride], above[i], above[i - stride]);
+        }
+        break;
+      default:
+        return false;
+    }
+    return true;
+  }
+
+  const PngImage& png;
+  BitmapWriter& writer;
+  tinfl_decompressor* inflator = nullptr;
+  uint8_t* window = nullptr;  // Inflate output, the last 32KB are what back-references reach
+  size_t windowCursor = 0;
+  uint8_t* current = nullptr;  // Scanline being filled, filter type byte first
+  uint8_t* previous = nullptr;
+  size_t filled = 0;
+  uint8_t* gray = nullptr;
+  uint32_t rowsDone = 0;
+};
+
+bool readChunkHeader(FsFile& file, uint32_t* length, char type[4]) {
+  uint8_t header[8];
+  if (file.read(header, sizeof(header)) != static_cast<int>(sizeof(header))) {
+    return false;
+  }
+  *length = readBE32(header);
+  memcpy(type, header + 4, 4);
+  return true;
+}
+}  // namespace
+
+// Internal implementation with configurable target size and bit depth
+bool PngToBmpConverter::pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetWidth, int targetHeight,
+                                                   bool oneBit, bool crop, int* outWidthResult,
+                                                   int* outHeightResult) {
+  LOG_DBG("PNG", "Converting PNG to %s BMP (target: %dx%d)", oneBit ? "1-bit" : "2-bit", targetWidth, targetHeight);
+
+  uint8_t signature[sizeof(PNG_SIGNATURE)];
+  if (pngFile.read(signature, sizeof(signature)) != static_cast<int>(sizeof(signature)) ||
+      memcmp(signature, PNG_SIGNATURE, sizeof(signature)) != 0) {
+    LOG_ERR("PNG", "Not a PNG file");
+    return false;
+  }
+
+  // Also holds the palette, at most 768 bytes
+  uint8_t buffer[READ_BUFFER_SIZE];
+  PngImage png;
+  bool hasHeader = false;
+  uint32_t length;
+  char type[4];
+
+  // Everything the pixels need comes ahead of the first IDAT
+  while (true) {
+    if (!readChunkHeader(pngFile, &length, type) || memcmp(type, "IEND", 4) == 0) {
+      LOG_ERR("PNG", "No image data");
+      return false;
+    }
+    if (memcmp(type, "IDAT", 4) == 0) {
+      break;
+    }
+
+    const bool isHeader = memcmp(type, "IHDR", 4) == 0;
+    const bool isPalette = memcmp(type, "PLTE", 4) == 0;
+    const bool isTransparency = memcmp(type, "tRNS", 4) == 0;
+    if ((isHeader || isPalette || isTransparency) && length <= sizeof(buffer)) {
+      if (pngFile.read(buffer, length) != static_cast<int>(length)) {
+        LOG_ERR("PNG", "Chunk %.4s truncated", type);
+        return false;
+      }
+      if (isHeader) {
+        if (length < 13 || !parseHeader(buffer, png)) {
+          return false;
+        }
+        hasHeader = true;
+      } else if (isPalette) {
+        parsePalette(buffer, length, png);
+      } else if (hasHeader) {
+        parseTransparency(buffer, length, png);
+      }
+    } else {
+      pngFile.seekCur(length);
+    }
+    // CRCs aren't checked, a corrupt stream still fails to inflate
+    pngFile.seekCur(4);
+  }
+
+  if (!hasHeader || (png.colorType == PALETTE && !png.hasPalette)) {
+    LOG_ERR("PNG", "Missing %s chunk", hasHeader ? "PLTE" : "IHDR");
+    return false;
+  }
+
+  // Pre-scale to fit the display exactly, then dither, as the rows come out
+  BitmapWriter writer(bmpOut, png.width, png.height, targetWidth, targetHeight, oneBit, crop);
+  if (!writer.begin()) {
+    return false;
+  }
+  ScanlineDecoder decoder(png, writer);
+  if (!decoder.begin()) {
+    return false;
+  }
+
+  // IDAT chunks follow each other, the zlib stream runs on from one into the next
+  while (true) {
+    for (uint32_t remaining = length; remaining > 0 && !decoder.isDone();) {
+      const size_t toRead = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+      const int bytesRead = pngFile.read(buffer, toRead);
+      if (bytesRead <= 0) {
+        LOG_ERR("PNG", "Image data truncated");
+        return false;
+      }
+      if (!decoder.feed(buffer, bytesRead)) {
+        return false;
+      }
+      remaining -= bytesRead;
+    }
+    if (decoder.isDone()) {
+      break;
+    }
+    pngFile.seekCur(4);
+    if (!readChunkHeader(pngFile, &length, type) || memcmp(type, "IDAT", 4) != 0) {
+      LOG_ERR("PNG", "Image data truncated");
+      return false;
+    }
+  }
+
+  if (outWidthResult) *outWidthResult = writer.getWidth();
+  if (outHeightResult) *outHeightResult = writer.getHeight();
+  LOG_DBG("PNG", "Successfully converted PNG to BMP");
+  return true;
+}
+
+// Core function: Convert PNG file to 2-bit BMP (uses default target size)
+bool PngToBmpConverter::pngFileToBmpStream(FsFile& pngFile, Print& bmpOut, bool crop) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, false, crop);
+}
+
+// Convert with custom target size (for thumbnails, 2-bit)
+bool PngToBmpConverter::pngFileToBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth,
+                                                   int targetMaxHeight) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, targetMaxWidth, targetMaxHeight, false);
+}
+
+// Convert to 1-bit BMP (black and white only, no grays) for fast home screen rendering
+bool PngToBmpConverter::pngFileTo1BitBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth,
+                                                       int targetMaxHeight) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, targetMaxWidth, targetMaxHeight, true, true);
+}
+
+// Convert to 1-bit BMP that fits the box without cropping, for images laid out inside a chapter
+bool PngToBmpConverter::pngFileTo1BitBmpStreamToFit(FsFile& pngFile, Print& bmpOut, int maxWidth, int maxHeight,
+                                                    int* outWidth, int* outHeight) {
+  return pngFileToBmpStreamInternal(pngFile, bmpOut, maxWidth, maxHeight, true, false, outWidth, outHeight);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+class FsFile;
+class Print;
+
+// Converts PNG images to the same BMPs JpegToBmpConverter makes. Scanlines are inflated, unfiltered and turned to gray
+// one at a time, so memory stays at two scanlines and the inflate window whatever the image height. Transparency is
+// composited over white, the color of the page. Interlaced images aren't supported.
+class PngToBmpConverter {
+  static bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetWidth, int targetHeight,
+                                         bool oneBit, bool crop = true, int* outWidth = nullptr,
+                                         int* outHeight = nullptr);
+
+ public:
+  static bool pngFileToBmpStream(FsFile& pngFile, Print& bmpOut, bool crop = true);
+  // Convert with custom target size (for thumbnails)
+  static bool pngFileToBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Convert to 1-bit BMP (black and white only, no grays) for fast home screen rendering
+  static bool pngFileTo1BitBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Convert to 1-bit BMP scaled down to fit within the box, uncropped (for images inside a chapter). The size of the
+  // BMP written is returned in outWidth and outHeight.
+  static bool pngFileTo1BitBmpStreamToFit(FsFile& pngFile, Print& bmpOut, int maxWidth, int maxHeight, int* outWidth,
+                                          int* outHeight);
+};
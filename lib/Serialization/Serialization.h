@@ -2,6 +2,10 @@
 #include <HalStorage.h>
 
 #include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace serialization {
 template <typename T>
@@ -49,4 +53,118 @@ static void readString(FsFile& file, std::string& s) {
   s.resize(len);
   file.read(&s[0], len);
 }
+
+// Compact records are built in memory and written with a single call, so readers can fetch them the same way.
+// Integers are LEB128 varints, signed ones zigzag encoded first.
+
+static void writeVarUint(std::vector<uint8_t>& out, uint32_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+static void writeVarInt(std::vector<uint8_t>& out, const int32_t value) {
+  writeVarUint(out, (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+}
+
+static void writeBytes(std::vector<uint8_t>& out, const void* data, const size_t length) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  out.insert(out.end(), bytes, bytes + length);
+}
+
+// Cursor over a record read into memory. Reads past the end leave the value zeroed and set `failed`, so decoders
+// can check once at the end instead of after every field.
+struct BufferReader {
+  const uint8_t* pos;
+  const uint8_t* end;
+  bool failed = false;
+
+  BufferReader(const uint8_t* data, const size_t length) : pos(data), end(data + length) {}
+
+  size_t remaining() const { return end - pos; }
+
+  uint8_t readByte() {
+    if (pos == end) {
+      failed = true;
+      return 0;
+    }
+    return *pos++;
+  }
+
+  uint32_t readVarUint() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+      const uint8_t byte = readByte();
+      value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+    failed = true;
+    return 0;
+  }
+
+  int32_t readVarInt() {
+    const uint32_t value = readVarUint();
+    return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+  }
+
+  // Points into the record, valid as long as its buffer is
+  const char* readBytes(const size_t length) {
+    if (remaining() < length) {
+      failed = true;
+      pos = end;
+      return nullptr;
+    }
+    const auto* bytes = reinterpret_cast<const char*>(pos);
+    pos += length;
+    return bytes;
+  }
+};
+
+// Interns the strings of a record so repeats are stored once and referenced by index. Holds views, the interned
+// strings must outlive the table.
+class StringTable {
+  std::vector<std::string_view> strings;
+  std::unordered_map<std::string_view, uint32_t> indexes;
+
+ public:
+  uint32_t intern(const std::string_view s) {
+    const auto inserted = indexes.emplace(s, static_cast<uint32_t>(strings.size()));
+    if (inserted.second) {
+      strings.emplace_back(s);
+    }
+    return inserted.first->second;
+  }
+
+  void write(std::vector<uint8_t>& out) const {
+    writeVarUint(out, strings.size());
+    for (const auto& s : strings) {
+      writeVarUint(out, s.size());
+      writeBytes(out, s.data(), s.size());
+    }
+  }
+};
+
+// Reads a table written by StringTable::write, the views point into the reader's buffer
+static bool readStringTable(BufferReader& in, std::vector<std::string_view>& strings) {
+  const uint32_t count = in.readVarUint();
+  // Every entry takes at least its length byte
+  if (in.failed || count > in.remaining()) {
+    return false;
+  }
+  strings.clear();
+  strings.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    const uint32_t length = in.readVarUint();
+    const char* data = in.readBytes(length);
+    if (in.failed) {
+      return false;
+    }
+    strings.emplace_back(data, length);
+  }
+  return true;
+}
 }  // namespace serialization
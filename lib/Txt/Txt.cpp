@@ -3,6 +3,7 @@
 #include <FsHelpers.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
+#include <PngToBmpConverter.h>
 
 Txt::Txt(std::string path, std::string cacheBasePath)
     : filepath(std::move(path)), cacheBasePath(std::move(cacheBasePath)) {
@@ -117,6 +118,7 @@ bool Txt::generateCoverBmp() const {
   const bool isJpg =
       (len >= 4 && (coverImagePath.substr(len - 4) == ".jpg" || coverImagePath.substr(len - 4) == ".JPG")) ||
       (len >= 5 && (coverImagePath.substr(len - 5) == ".jpeg" || coverImagePath.substr(len - 5) == ".JPEG"));
+  const bool isPng = len >= 4 && (coverImagePath.substr(len - 4) == ".png" || coverImagePath.substr(len - 4) == ".PNG");
   const bool isBmp = len >= 4 && (coverImagePath.substr(len - 4) == ".bmp" || coverImagePath.substr(len - 4) == ".BMP");
 
   if (isBmp) {
@@ -141,32 +143,32 @@ bool Txt::generateCoverBmp() const {
     return true;
   }
 
-  if (isJpg) {
-    // Convert JPG/JPEG to BMP (same approach as Epub)
-    LOG_DBG("TXT", "Generating BMP from JPG cover image");
-    FsFile coverJpg, coverBmp;
-    if (!Storage.openFileForRead("TXT", coverImagePath, coverJpg)) {
+  if (isJpg || isPng) {
+    // Convert JPG/JPEG/PNG to BMP (same approach as Epub)
+    LOG_DBG("TXT", "Generating BMP from %s cover image", isPng ? "PNG" : "JPG");
+    FsFile coverImage, coverBmp;
+    if (!Storage.openFileForRead("TXT", coverImagePath, coverImage)) {
       return false;
     }
     if (!Storage.openFileForWrite("TXT", getCoverBmpPath(), coverBmp)) {
-      coverJpg.close();
+      coverImage.close();
       return false;
     }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp);
-    coverJpg.close();
+    const bool success = isPng ? PngToBmpConverter::pngFileToBmpStream(coverImage, coverBmp)
+                               : JpegToBmpConverter::jpegFileToBmpStream(coverImage, coverBmp);
+    coverImage.close();
     coverBmp.close();
 
     if (!success) {
-      LOG_ERR("TXT", "Failed to generate BMP from JPG cover image");
+      LOG_ERR("TXT", "Failed to generate BMP from cover image");
       Storage.remove(getCoverBmpPath().c_str());
     } else {
-      LOG_DBG("TXT", "Generated BMP from JPG cover image");
+      LOG_DBG("TXT", "Generated BMP from cover image");
     }
     return success;
   }
 
-  // PNG files are not supported (would need a PNG decoder)
-  LOG_ERR("TXT", "Cover image format not supported (only BMP/JPG/JPEG)");
+  LOG_ERR("TXT", "Cover image format not supported (only BMP/JPG/JPEG/PNG)");
   return false;
 }
 
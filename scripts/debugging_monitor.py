@@ -9,6 +9,7 @@ information, and displays it in both console and graphical form.
 Features:
 - Real-time serial output monitoring with color-coded log levels
 - Interactive memory usage graphing with matplotlib
+- Render timing report (TIMINGS command) plotted next to the memory graph
 - Command input interface for sending commands to the ESP32 device
 - Screenshot capture and processing (1-bit black/white format)
 - Graceful shutdown handling with Ctrl-C signal processing
@@ -18,8 +19,9 @@ Features:
 Usage:
     python debugging_monitor.py [port] [options]
 
-The script will open a matplotlib window showing memory usage over time and provide
-an interactive command prompt for sending commands to the device. Press Ctrl-C or
+The script will open a matplotlib window showing memory usage over time and the latest
+render timings, and provide an interactive command prompt for sending commands to the
+device (e.g. SCREENSHOT, TIMINGS, TIMINGS_RESET). Press Ctrl-C or
 close the graph window to exit gracefully.
 """
 
@@ -78,6 +80,8 @@ MAX_POINTS = 50
 time_data: deque[str] = deque(maxlen=MAX_POINTS)
 free_mem_data: deque[float] = deque(maxlen=MAX_POINTS)
 total_mem_data: deque[float] = deque(maxlen=MAX_POINTS)
+# Latest render timing report: (activity, phase) -> (count, min, avg, p95, max) in ms
+timing_data: dict[tuple[str, str], tuple[int, int, int, int, int]] = {}
 data_lock: threading.Lock = threading.Lock()  # Prevent reading while writing
 
 # Global shutdown flag
@@ -189,6 +193,32 @@ def parse_memory_line(line: str) -> tuple[int | None, int | None]:
     return None, None
 
 
+def parse_timing_line(line: str) -> tuple[tuple[str, str], tuple[int, ...]] | None:
+    """
+    Extracts one phase of a render timing report.
+    Format: TIMING:<activity>:<phase>:<count>:<min>:<avg>:<p95>:<max>
+    """
+    parts = line.split(":")
+    if len(parts) != 8:
+        return None
+    try:
+        return (parts[1], parts[2]), tuple(int(value) for value in parts[3:])
+    except ValueError:
+        return None
+
+
+def print_timings(timings: dict[tuple[str, str], tuple[int, ...]]) -> None:
+    """Prints a render timing report as a table."""
+    print(
+        f"{Fore.BLUE}{'activity':<24}{'phase':<16}{'count':>7}{'min':>8}{'avg':>8}{'p95':>8}{'max':>8}"
+    )
+    for (activity, phase), values in timings.items():
+        count, min_ms, avg_ms, p95_ms, max_ms = values
+        print(
+            f"{Fore.BLUE}{activity:<24}{phase:<16}{count:>7}{min_ms:>8}{avg_ms:>8}{p95_ms:>8}{max_ms:>8}"
+        )
+
+
 def serial_worker(ser, kwargs: dict[str, str]) -> None:
     """
     Runs in a background thread. Handles reading serial data, printing to console,
@@ -216,6 +246,8 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
     expecting_screenshot = False
     screenshot_size = 0
     screenshot_data = b""
+    # Report being received, None outside TIMINGS_START / TIMINGS_END
+    pending_timings: dict[tuple[str, str], tuple[int, ...]] | None = None
 
     try:
         while not shutdown_event.is_set():
@@ -258,6 +290,25 @@ def serial_worker(ser, kwargs: dict[str, str]) -> None:
                         continue
                     elif clean_line == "SCREENSHOT_END":
                         continue  # ignore
+                    elif clean_line == "TIMINGS_START":
+                        pending_timings = {}
+                        continue
+                    elif clean_line == "TIMINGS_END":
+                        if pending_timings is not None:
+                            with data_lock:
+                                timing_data.clear()
+                                timing_data.update(pending_timings)
+                            if pending_timings:
+                                print_timings(pending_timings)
+                            else:
+                                print(f"{Fore.BLUE}No render timings recorded yet")
+                        pending_timings = None
+                        continue
+                    elif clean_line.startswith("TIMING:"):
+                        timing = parse_timing_line(clean_line)
+                        if timing is not None and pending_timings is not None:
+                            pending_timings[timing[0]] = timing[1]
+                        continue
 
                     # Add PC timestamp
                     pc_time = datetime.now().strftime("%H:%M:%S")
@@ -305,43 +356,85 @@ def input_worker(ser) -> None:
             break
 
 
-def update_graph(frame) -> list:  # pylint: disable=unused-argument
+def timings_worker(ser, interval: float) -> None:
     """
-    Called by Matplotlib animation to redraw the memory usage chart.
-    Monitors the global shutdown event and closes the plot when shutdown is requested.
+    Runs in a background thread. Asks the device for a render timing report every
+    `interval` seconds until shutdown.
     """
-    if shutdown_event.is_set():
-        plt.close("all")
-        return []
+    while not shutdown_event.wait(interval):
+        try:
+            ser.write(b"CMD:TIMINGS\n")
+        except OSError:
+            break
 
-    with data_lock:
-        if not time_data:
-            return []
 
+def draw_memory(ax) -> None:
+    """Draws the memory usage chart on the given axes."""
+    with data_lock:
         # Convert deques to lists for plotting
         x = list(time_data)
         y_free = list(free_mem_data)
         y_total = list(total_mem_data)
 
-    plt.cla()  # Clear axis
+    ax.cla()  # Clear axis
+    ax.set_title("ESP32 Memory Monitor")
+    if not x:
+        return
 
     # Plot Total RAM
-    plt.plot(x, y_total, label="Total RAM (KB)", color="red", linestyle="--")
+    ax.plot(x, y_total, label="Total RAM (KB)", color="red", linestyle="--")
 
     # Plot Free RAM
-    plt.plot(x, y_free, label="Free RAM (KB)", color="green", marker="o")
+    ax.plot(x, y_free, label="Free RAM (KB)", color="green", marker="o")
 
     # Fill area under Free RAM
-    plt.fill_between(x, y_free, color="green", alpha=0.1)
+    ax.fill_between(x, y_free, color="green", alpha=0.1)
 
-    plt.title("ESP32 Memory Monitor")
-    plt.ylabel("Memory (KB)")
-    plt.xlabel("Time")
-    plt.legend(loc="upper left")
-    plt.grid(True, linestyle=":", alpha=0.6)
+    ax.set_ylabel("Memory (KB)")
+    ax.set_xlabel("Time")
+    ax.legend(loc="upper left")
+    ax.grid(True, linestyle=":", alpha=0.6)
 
     # Rotate date labels
-    plt.xticks(rotation=45, ha="right")
+    ax.tick_params(axis="x", labelrotation=45)
+
+
+def draw_timings(ax) -> None:
+    """Draws the latest render timing report on the given axes, average bars with p95 marks."""
+    with data_lock:
+        timings = dict(timing_data)
+
+    ax.cla()  # Clear axis
+    ax.set_title("Render Timings (send TIMINGS)")
+    if not timings:
+        return
+
+    labels = [f"{activity} / {phase}" for activity, phase in timings]
+    averages = [values[2] for values in timings.values()]
+    p95s = [values[3] for values in timings.values()]
+    rows = list(range(len(labels)))
+
+    ax.barh(rows, averages, color="steelblue", alpha=0.7, label="avg")
+    ax.scatter(p95s, rows, color="darkorange", marker="|", s=200, label="p95")
+    ax.set_yticks(rows)
+    ax.set_yticklabels(labels, fontsize=8)
+    ax.invert_yaxis()
+    ax.set_xlabel("Time (ms)")
+    ax.legend(loc="lower right")
+    ax.grid(True, axis="x", linestyle=":", alpha=0.6)
+
+
+def update_graph(frame, memory_ax, timings_ax) -> list:  # pylint: disable=unused-argument
+    """
+    Called by Matplotlib animation to redraw the memory usage and render timing charts.
+    Monitors the global shutdown event and closes the plot when shutdown is requested.
+    """
+    if shutdown_event.is_set():
+        plt.close("all")
+        return []
+
+    draw_memory(memory_ax)
+    draw_timings(timings_ax)
     plt.tight_layout()
 
     return []
@@ -419,6 +512,12 @@ def main() -> None:
         default="",
         help="Only display lines containing this keyword (case-insensitive)",
     )
+    parser.add_argument(
+        "--timings",
+        type=float,
+        default=0,
+        help="Request a render timing report every this many seconds (default: only on TIMINGS command)",
+    )
     parser.add_argument(
         "--suppress",
         type=str,
@@ -464,6 +563,12 @@ def main() -> None:
     input_thread = threading.Thread(target=input_worker, args=(ser,), daemon=True)
     input_thread.start()
 
+    if args.timings > 0:
+        timings_thread = threading.Thread(
+            target=timings_worker, args=(ser, args.timings), daemon=True
+        )
+        timings_thread.start()
+
     # 2. Set up the Graph (Main Thread)
     try:
         import matplotlib.style as mplstyle  # pylint: disable=import-outside-toplevel
@@ -485,11 +590,15 @@ def main() -> None:
     except (AttributeError, ValueError):
         pass
 
-    fig = plt.figure(figsize=(10, 6))
+    fig, (memory_ax, timings_ax) = plt.subplots(1, 2, figsize=(16, 6))
 
     # Update graph every 1000ms
     _ = animation.FuncAnimation(
-        fig, update_graph, interval=1000, cache_frame_data=False
+        fig,
+        update_graph,
+        fargs=(memory_ax, timings_ax),
+        interval=1000,
+        cache_frame_data=False,
     )
 
     try:
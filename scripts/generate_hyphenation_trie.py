@@ -1,10 +1,18 @@
 #!/usr/bin/env python3
-"""Embed hypher-generated `.bin` tries into constexpr headers."""
+"""Embed hypher-generated `.bin` tries into constexpr headers, or wrap them into SD card pattern packs."""
 
 from __future__ import annotations
 
 import argparse
 import pathlib
+import re
+import struct
+
+# Pattern pack layout, see docs/hyphenation-trie-format.md
+PACK_MAGIC = b'HYPK'
+PACK_VERSION = 1
+PACK_DATA_OFFSET = 512
+PACK_SCRIPTS = {'latin': 0, 'cyrillic': 1}
 
 
 def _format_bytes(blob: bytes, per_line: int = 16) -> str:
@@ -57,12 +65,38 @@ constexpr SerializedHyphenationPatterns {patterns_symbol} = {{
     path.write_text(content)
 
 
+def write_pack(path: pathlib.Path, blob: bytes, script: str, min_prefix: int, min_suffix: int) -> None:
+    # Emit a pattern pack: fixed header padded to one SD sector, then the trie exactly as hypher wrote it.
+    path.parent.mkdir(parents=True, exist_ok=True)
+    header = PACK_MAGIC + struct.pack('<BBBBI', PACK_VERSION, PACK_SCRIPTS[script], min_prefix, min_suffix, len(blob))
+    path.write_bytes(header.ljust(PACK_DATA_OFFSET, b'\0') + blob)
+
+
+def read_trie(path: pathlib.Path) -> bytes:
+    # Accept either a hypher `.bin` or one of the generated headers, so packs can be made from the embedded tries.
+    if path.suffix != '.h':
+        return path.read_bytes()
+    text = path.read_text()
+    match = re.search(r'_trie_data\[\] = \{(.*?)\};', text, re.S)
+    if not match:
+        raise SystemExit(f'{path}: no trie data found')
+    return bytes(int(value, 16) for value in re.findall(r'0x([0-9A-Fa-f]{2})', match.group(1)))
+
+
 def main() -> None:
     parser = argparse.ArgumentParser()
     parser.add_argument('--input', dest='inputs', action='append', required=True,
                         help='Path to a hypher-generated .bin trie')
     parser.add_argument('--output', dest='outputs', action='append', required=True,
-                        help='Destination header path (hyph-*.trie.h)')
+                        help='Destination header path (hyph-*.trie.h), or pack path (<tag>.hyp) with --pack')
+    parser.add_argument('--pack', action='store_true',
+                        help='Write SD card pattern packs instead of headers')
+    parser.add_argument('--script', choices=sorted(PACK_SCRIPTS), default='latin',
+                        help='Letters the pack hyphenates (packs only)')
+    parser.add_argument('--min-prefix', type=int, default=2,
+                        help='Minimum letters before a break (packs only)')
+    parser.add_argument('--min-suffix', type=int, default=2,
+                        help='Minimum letters after a break (packs only)')
     args = parser.parse_args()
 
     if len(args.inputs) != len(args.outputs):
@@ -71,10 +105,13 @@ def main() -> None:
     for src, dst in zip(args.inputs, args.outputs):
         # Process each input/output pair independently so mixed-language refreshes work in one invocation.
         src_path = pathlib.Path(src)
-        blob = src_path.read_bytes()
+        blob = read_trie(src_path)
         out_path = pathlib.Path(dst)
-        symbol = _symbol_from_output(out_path)
-        write_header(out_path, blob, symbol)
+        if args.pack:
+            write_pack(out_path, blob, args.script, args.min_prefix, args.min_suffix)
+        else:
+            symbol = _symbol_from_output(out_path)
+            write_header(out_path, blob, symbol)
         print(f'wrote {dst} ({len(blob)} bytes payload)')
 
 
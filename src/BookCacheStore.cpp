@@ -0,0 +1,289 @@
+#include "BookCacheStore.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "RecentBooksStore.h"
+
+namespace {
+constexpr uint8_t BOOK_CACHE_FILE_VERSION = 2;
+constexpr char BOOK_CACHE_FILE[] = "/.crosspoint/cache_index.bin";
+constexpr char CACHE_ROOT[] = "/.crosspoint";
+
+bool isBookCacheDir(const std::string& name) {
+  return name.rfind("epub_", 0) == 0 || name.rfind("xtc_", 0) == 0 || name.rfind("txt_", 0) == 0;
+}
+
+std::string dirNameFromPath(const std::string& cachePath) {
+  const auto lastSlash = cachePath.find_last_of('/');
+  return lastSlash == std::string::npos ? cachePath : cachePath.substr(lastSlash + 1);
+}
+
+// Recursively sum file sizes below `path`
+uint64_t measureDir(const std::string& path) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return 0;
+  }
+
+  uint64_t total = 0;
+  char name[128];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    if (file.isDirectory()) {
+      file.getName(name, sizeof(name));
+      file.close();
+      total += measureDir(path + "/" + name);
+    } else {
+      total += file.size();
+      file.close();
+    }
+  }
+  dir.close();
+  return total;
+}
+
+// Sizes are kept as uint32 in the index; a single book cache never comes close to 4 GB
+uint32_t measureDirClamped(const std::string& path) {
+  return static_cast<uint32_t>(std::min<uint64_t>(measureDir(path), UINT32_MAX));
+}
+
+// Cache directories of the books on the recent list. The home screen draws their thumbnails from there.
+std::vector<std::string> recentBookCacheDirs() {
+  std::vector<std::string> dirs;
+  for (const auto& book : RECENT_BOOKS.getBooks()) {
+    const auto lastSlash = book.coverBmpPath.find_last_of('/');
+    if (lastSlash != std::string::npos) {
+      dirs.push_back(dirNameFromPath(book.coverBmpPath.substr(0, lastSlash)));
+    }
+  }
+  return dirs;
+}
+
+// Remove a book cache except its reading progress. With keepThumbs the home screen thumbnails (thumb_*.bmp) stay
+// behind too, as regenerating them means parsing the whole book again the next time the home screen is shown. The
+// directory itself goes once nothing is left in it.
+bool evictDir(const std::string& path, const bool keepThumbs) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return false;
+  }
+
+  std::vector<std::string> toRemove;
+  std::vector<std::string> dirsToRemove;
+  bool keptAny = false;
+  char name[128];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const std::string fileName = name;
+    if (file.isDirectory()) {
+      dirsToRemove.push_back(path + "/" + fileName);
+    } else if (fileName == "progress.bin" || (keepThumbs && fileName.rfind("thumb_", 0) == 0)) {
+      keptAny = true;
+    } else {
+      toRemove.push_back(path + "/" + fileName);
+    }
+    file.close();
+  }
+  dir.close();
+
+  if (!keptAny) {
+    return Storage.removeDir(path.c_str());
+  }
+  bool ok = true;
+  for (const auto& file : toRemove) {
+    ok = Storage.remove(file.c_str()) && ok;
+  }
+  for (const auto& sub : dirsToRemove) {
+    ok = Storage.removeDir(sub.c_str()) && ok;
+  }
+  return ok;
+}
+}  // namespace
+
+BookCacheStore BookCacheStore::instance;
+
+BookCacheEntry& BookCacheStore::findOrCreate(const std::string& dirName) {
+  auto it = std::find_if(entries.begin(), entries.end(),
+                         [&](const BookCacheEntry& entry) { return entry.dirName == dirName; });
+  if (it != entries.end()) {
+    return *it;
+  }
+  entries.push_back({dirName, 0, 0, false});
+  return entries.back();
+}
+
+// Drop entries whose directory was removed elsewhere (clear cache, re-upload) and pick up directories created before
+// this index existed. Untracked directories are treated as least recently used.
+void BookCacheStore::reconcileWithDisk() {
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](const BookCacheEntry& entry) {
+                                 return !Storage.exists((std::string(CACHE_ROOT) + "/" + entry.dirName).c_str());
+                               }),
+                entries.end());
+
+  auto root = Storage.open(CACHE_ROOT);
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return;
+  }
+
+  char name[128];
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDir = file.isDirectory();
+    file.close();
+    if (!isDir || !isBookCacheDir(name)) {
+      continue;
+    }
+    const auto it = std::find_if(entries.begin(), entries.end(),
+                                 [&](const BookCacheEntry& entry) { return entry.dirName == name; });
+    if (it == entries.end()) {
+      entries.push_back({name, 0, measureDirClamped(std::string(CACHE_ROOT) + "/" + name), false});
+    }
+  }
+  root.close();
+}
+
+void BookCacheStore::touch(const std::string& cachePath) {
+  auto& entry = findOrCreate(dirNameFromPath(cachePath));
+  entry.lastAccess = ++accessCounter;
+  entry.evicted = false;
+  saveToFile();
+}
+
+void BookCacheStore::updateSizeAndEnforceBudget(const std::string& cachePath) {
+  const uint32_t start = millis();
+  const auto keepDir = dirNameFromPath(cachePath);
+  auto& kept = findOrCreate(keepDir);
+  kept.sizeBytes = measureDirClamped(cachePath);
+  kept.evicted = false;
+  reconcileWithDisk();
+
+  const auto recentDirs = recentBookCacheDirs();
+  const uint64_t budget = SETTINGS.getCacheBudgetBytes();
+  uint64_t total = getTotalBytes();
+  int evicted = 0;
+
+  while (budget > 0 && total > budget) {
+    // Oldest entry other than the book that was just closed and those already evicted
+    auto victim = entries.end();
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+      if (it->dirName != keepDir && !it->evicted &&
+          (victim == entries.end() || it->lastAccess < victim->lastAccess)) {
+        victim = it;
+      }
+    }
+    if (victim == entries.end()) {
+      break;
+    }
+
+    const std::string victimPath = std::string(CACHE_ROOT) + "/" + victim->dirName;
+    const bool isRecent = std::find(recentDirs.begin(), recentDirs.end(), victim->dirName) != recentDirs.end();
+    if (!evictDir(victimPath, isRecent)) {
+      LOG_ERR("BCS", "Failed to evict %s", victimPath.c_str());
+      break;
+    }
+    // What was kept stays tracked at its own size, so the directory isn't picked up again as an unknown one
+    const uint32_t remaining = Storage.exists(victimPath.c_str()) ? measureDirClamped(victimPath) : 0;
+    const uint32_t freed = victim->sizeBytes > remaining ? victim->sizeBytes - remaining : 0;
+    LOG_INF("BCS", "Evicted %s (%u KB freed, last access #%u)", victim->dirName.c_str(), freed / 1024,
+            victim->lastAccess);
+    total -= std::min<uint64_t>(freed, total);
+    if (remaining > 0) {
+      victim->sizeBytes = remaining;
+      victim->evicted = true;
+    } else {
+      entries.erase(victim);
+    }
+    evicted++;
+  }
+
+  LOG_INF("BCS", "Book caches: %u entries, %u KB of %u KB budget, %d evicted in %lu ms",
+          static_cast<unsigned>(entries.size()), static_cast<unsigned>(total / 1024),
+          static_cast<unsigned>(budget / 1024), evicted, millis() - start);
+  saveToFile();
+}
+
+void BookCacheStore::recordSize(const std::string& cachePath) {
+  auto& entry = findOrCreate(dirNameFromPath(cachePath));
+  entry.lastAccess = ++accessCounter;
+  entry.sizeBytes = measureDirClamped(cachePath);
+  entry.evicted = false;
+  saveToFile();
+}
+
+uint64_t BookCacheStore::getTotalBytes() const {
+  uint64_t total = 0;
+  for (const auto& entry : entries) {
+    total += entry.sizeBytes;
+  }
+  return total;
+}
+
+bool BookCacheStore::saveToFile() const {
+  // Make sure the directory exists
+  Storage.mkdir(CACHE_ROOT);
+
+  FsFile outputFile;
+  if (!Storage.openFileForWrite("BCS", BOOK_CACHE_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, BOOK_CACHE_FILE_VERSION);
+  serialization::writePod(outputFile, accessCounter);
+  const uint16_t count = static_cast<uint16_t>(entries.size());
+  serialization::writePod(outputFile, count);
+
+  for (const auto& entry : entries) {
+    serialization::writeString(outputFile, entry.dirName);
+    serialization::writePod(outputFile, entry.lastAccess);
+    serialization::writePod(outputFile, entry.sizeBytes);
+    serialization::writePod(outputFile, static_cast<uint8_t>(entry.evicted));
+  }
+
+  outputFile.close();
+  return true;
+}
+
+bool BookCacheStore::loadFromFile() {
+  FsFile inputFile;
+  if (!Storage.openFileForRead("BCS", BOOK_CACHE_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != BOOK_CACHE_FILE_VERSION) {
+    LOG_ERR("BCS", "Deserialization failed: Unknown version %u", version);
+    inputFile.close();
+    return false;
+  }
+
+  serialization::readPod(inputFile, accessCounter);
+  uint16_t count;
+  serialization::readPod(inputFile, count);
+
+  entries.clear();
+  entries.reserve(count);
+  for (uint16_t i = 0; i < count; i++) {
+    BookCacheEntry entry;
+    serialization::readString(inputFile, entry.dirName);
+    serialization::readPod(inputFile, entry.lastAccess);
+    serialization::readPod(inputFile, entry.sizeBytes);
+    uint8_t evicted;
+    serialization::readPod(inputFile, evicted);
+    entry.evicted = evicted != 0;
+    entries.push_back(std::move(entry));
+  }
+
+  inputFile.close();
+  LOG_DBG("BCS", "Book cache index loaded (%d entries, %u KB)", count,
+          static_cast<unsigned>(getTotalBytes() / 1024));
+  return true;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct BookCacheEntry {
+  // Directory name inside /.crosspoint, e.g. "epub_12345"
+  std::string dirName;
+  // Monotonic access sequence number, higher is more recent
+  uint32_t lastAccess;
+  // On-disk size of the directory in bytes, as of the last time the book was closed
+  uint32_t sizeBytes;
+  // Evicted down to the files that are always kept (reading progress, recent thumbnails) and not rebuilt since
+  bool evicted;
+};
+
+// Tracks the per-book cache directories (epub_/xtc_/txt_) and evicts the least recently used ones
+// once their combined size goes over SETTINGS.getCacheBudgetBytes(). Eviction always keeps the book's reading
+// progress, and for a book on the recent list its home screen thumbnails too.
+class BookCacheStore {
+  // Static instance
+  static BookCacheStore instance;
+
+  std::vector<BookCacheEntry> entries;
+  uint32_t accessCounter = 0;
+
+  BookCacheEntry& findOrCreate(const std::string& dirName);
+  void reconcileWithDisk();
+
+ public:
+  ~BookCacheStore() = default;
+
+  // Get singleton instance
+  static BookCacheStore& getInstance() { return instance; }
+
+  // Mark a book cache as most recently used. Call when a book is opened.
+  void touch(const std::string& cachePath);
+
+  // Re-measure a book cache and evict other caches if the budget is exceeded. Call when a book is closed.
+  void updateSizeAndEnforceBudget(const std::string& cachePath);
+
+  // Re-measure a book cache and mark it as used without evicting anything, e.g. after background indexing. Without
+  // the stamp a pre-indexed book would be the first to go.
+  void recordSize(const std::string& cachePath);
+
+  // Summed in 64 bits: with an unlimited budget the caches on a large card can add up past 4 GB
+  uint64_t getTotalBytes() const;
+
+  bool saveToFile() const;
+
+  bool loadFromFile();
+};
+
+// Helper macro to access book cache store
+#define BOOK_CACHE BookCacheStore::getInstance()
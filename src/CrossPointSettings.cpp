@@ -22,7 +22,7 @@ void readAndValidate(FsFile& file, uint8_t& member, const uint8_t maxValue) {
 namespace {
 constexpr uint8_t SETTINGS_FILE_VERSION = 1;
 // Increment this when adding new persisted settings fields
-constexpr uint8_t SETTINGS_COUNT = 30;
+constexpr uint8_t SETTINGS_COUNT = 32;
 constexpr char SETTINGS_FILE[] = "/.crosspoint/settings.bin";
 
 // Validate front button mapping to ensure each hardware button is unique.
@@ -118,6 +118,8 @@ bool CrossPointSettings::saveToFile() const {
   serialization::writePod(outputFile, frontButtonRight);
   serialization::writePod(outputFile, fadingFix);
   serialization::writePod(outputFile, embeddedStyle);
+  serialization::writePod(outputFile, cacheBudget);
+  serialization::writePod(outputFile, libraryPreIndex);
   // New fields added at end for backward compatibility
   outputFile.close();
 
@@ -223,6 +225,10 @@ bool CrossPointSettings::loadFromFile() {
     if (++settingsRead >= fileSettingsCount) break;
     serialization::readPod(inputFile, embeddedStyle);
     if (++settingsRead >= fileSettingsCount) break;
+    readAndValidate(inputFile, cacheBudget, CACHE_BUDGET_COUNT);
+    if (++settingsRead >= fileSettingsCount) break;
+    serialization::readPod(inputFile, libraryPreIndex);
+    if (++settingsRead >= fileSettingsCount) break;
     // New fields added at end for backward compatibility
   } while (false);
 
@@ -305,6 +311,22 @@ int CrossPointSettings::getRefreshFrequency() const {
   }
 }
 
+uint32_t CrossPointSettings::getCacheBudgetBytes() const {
+  switch (cacheBudget) {
+    case CACHE_UNLIMITED:
+      return 0;
+    case CACHE_100_MB:
+      return 100UL * 1024 * 1024;
+    case CACHE_250_MB:
+      return 250UL * 1024 * 1024;
+    case CACHE_1_GB:
+      return 1024UL * 1024 * 1024;
+    case CACHE_500_MB:
+    default:
+      return 500UL * 1024 * 1024;
+  }
+}
+
 int CrossPointSettings::getReaderFontId() const {
   switch (fontFamily) {
     case BOOKERLY:
@@ -119,6 +119,16 @@ class CrossPointSettings {
   // UI Theme
   enum UI_THEME { CLASSIC = 0, LYRA = 1 };
 
+  // Total size budget for per-book cache directories
+  enum CACHE_BUDGET {
+    CACHE_UNLIMITED = 0,
+    CACHE_100_MB = 1,
+    CACHE_250_MB = 2,
+    CACHE_500_MB = 3,
+    CACHE_1_GB = 4,
+    CACHE_BUDGET_COUNT
+  };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -171,6 +181,10 @@ class CrossPointSettings {
   uint8_t fadingFix = 0;
   // Use book's embedded CSS styles for EPUB rendering (1 = enabled, 0 = disabled)
   uint8_t embeddedStyle = 1;
+  // Book cache size budget, least recently used books are evicted beyond it (default 500 MB)
+  uint8_t cacheBudget = CACHE_UNLIMITED;
+  // Build caches for the whole library in the background while idle (opt-in)
+  uint8_t libraryPreIndex = 0;
 
   ~CrossPointSettings() = default;
 
@@ -188,6 +202,8 @@ class CrossPointSettings {
   float getReaderLineCompression() const;
   unsigned long getSleepTimeoutMs() const;
   int getRefreshFrequency() const;
+  // 0 means unlimited
+  uint32_t getCacheBudgetBytes() const;
 };
 
 // Helper macro to access settings
@@ -0,0 +1,281 @@
+#include "LibraryIndexer.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "BookCacheStore.h"
+#include "CrossPointSettings.h"
+#include "activities/reader/EpubReaderActivity.h"
+#include "components/UITheme.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr uint8_t INDEXER_FILE_VERSION = 2;
+constexpr char INDEXER_FILE[] = "/.crosspoint/indexer.bin";
+constexpr int MAX_SCAN_DEPTH = 8;
+constexpr size_t MAX_BOOKS = 1000;
+
+// Indexing stops once the book caches fill this share of the limit
+bool cacheNearBudget() {
+  const uint64_t budget = SETTINGS.getCacheBudgetBytes();
+  return budget > 0 && BOOK_CACHE.getTotalBytes() > budget / 4 * 3;
+}
+}  // namespace
+
+LibraryIndexer LibraryIndexer::instance;
+
+void LibraryIndexer::scanLibrary(const std::string& path, const int depth) {
+  auto dir = Storage.open(path.c_str());
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return;
+  }
+
+  char name[256];
+  for (auto file = dir.openNextFile(); file && books.size() < MAX_BOOKS; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDir = file.isDirectory();
+    file.close();
+    // Skips /.crosspoint along with any other hidden entries
+    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
+      continue;
+    }
+
+    const std::string fullPath = (path == "/" ? "" : path) + "/" + name;
+    if (isDir) {
+      if (depth < MAX_SCAN_DEPTH) {
+        scanLibrary(fullPath, depth + 1);
+      }
+    } else if (StringUtils::checkFileExtension(fullPath, ".epub")) {
+      books.push_back(fullPath);
+    }
+  }
+  dir.close();
+}
+
+// The key the reader's section files are named after, so the job restarts exactly when they would be rebuilt
+uint32_t LibraryIndexer::computeLayoutSignature() {
+  uint16_t viewportWidth, viewportHeight;
+  EpubReaderActivity::getReaderViewport(&viewportWidth, &viewportHeight);
+  return Section::layoutKeyFor(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                               viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle);
+}
+
+// True if the last run stopped at the cache limit and nothing has made room since, so scanning again would only stop
+// at the same place
+bool LibraryIndexer::stoppedAtBudget() const {
+  return budgetStopTotal > 0 && budgetStopLimit == SETTINGS.getCacheBudgetBytes() &&
+         layoutSignature == computeLayoutSignature() && BOOK_CACHE.getTotalBytes() >= budgetStopTotal;
+}
+
+void LibraryIndexer::advanceBook() {
+  currentEpub.reset();
+  bookStage = BookStage::LOAD;
+  bookCursor++;
+  spineCursor = 0;
+  saveToFile();
+}
+
+void LibraryIndexer::logThroughput(const char* event) const {
+  const float minutes = static_cast<float>(activeMs) / 60000.0f;
+  LOG_INF("IDX", "%s at book %u/%u: %u books, %u chapters in %lu s (%.1f books/min, %.1f chapters/min)", event,
+          bookCursor, static_cast<unsigned>(books.size()), booksIndexed, chaptersIndexed, activeMs / 1000,
+          minutes > 0 ? booksIndexed / minutes : 0.0f, minutes > 0 ? chaptersIndexed / minutes : 0.0f);
+}
+
+bool LibraryIndexer::step(GfxRenderer& renderer, const std::function<bool()>& shouldAbort) {
+  if (finished) {
+    return false;
+  }
+
+  const uint32_t stepStart = millis();
+
+  if (!scanned) {
+    const bool resumed = loadFromFile();
+    if (resumed && stoppedAtBudget()) {
+      finished = true;
+      return false;
+    }
+    budgetStopTotal = 0;
+    budgetStopLimit = 0;
+    const uint32_t storedSignature = layoutSignature;
+    const uint16_t storedBookCount = bookCount;
+
+    books.clear();
+    scanLibrary("/", 0);
+    std::sort(books.begin(), books.end());
+    scanned = true;
+
+    layoutSignature = computeLayoutSignature();
+    bookCount = static_cast<uint16_t>(books.size());
+    if (!resumed || layoutSignature != storedSignature || bookCount != storedBookCount) {
+      // New layout settings or a changed library: start over, books that are already done are skipped quickly
+      bookCursor = 0;
+      spineCursor = 0;
+    }
+    activeMs = 0;
+    booksIndexed = 0;
+    chaptersIndexed = 0;
+    LOG_INF("IDX", "Library scan found %u books in %lu ms, resuming at %u/%u", static_cast<unsigned>(books.size()),
+            millis() - stepStart, bookCursor, static_cast<unsigned>(books.size()));
+    return true;
+  }
+
+  if (cacheNearBudget()) {
+    LOG_INF("IDX", "Book cache close to its limit, stopping");
+    finished = true;
+    budgetStopTotal = BOOK_CACHE.getTotalBytes();
+    budgetStopLimit = SETTINGS.getCacheBudgetBytes();
+    saveToFile();
+    logThroughput("Stopped");
+    return false;
+  }
+
+  if (bookCursor >= books.size()) {
+    finished = true;
+    saveToFile();
+    logThroughput("Finished");
+    return false;
+  }
+
+  const auto& path = books[bookCursor];
+
+  // First steps on a book: metadata, cover and thumbnail
+  if (bookStage == BookStage::LOAD) {
+    bool aborted = false;
+    const auto abortFn = [&aborted, &shouldAbort] {
+      aborted = aborted || (shouldAbort && shouldAbort());
+      return aborted;
+    };
+
+    currentEpub = std::shared_ptr<Epub>(new Epub(path, "/.crosspoint"));
+    if (currentEpub->load(true, SETTINGS.embeddedStyle == 0, abortFn)) {
+      bookStage = BookStage::COVER;
+    } else if (aborted) {
+      // book.bin is only written once complete, the next idle period starts this book over
+      currentEpub.reset();
+      logThroughput("Interrupted");
+    } else {
+      LOG_ERR("IDX", "Failed to load %s, skipping", path.c_str());
+      advanceBook();
+    }
+    activeMs += millis() - stepStart;
+    return true;
+  }
+
+  if (bookStage == BookStage::COVER) {
+    currentEpub->generateCoverBmp(SETTINGS.sleepScreenCoverMode ==
+                                  CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP);
+    bookStage = BookStage::THUMB;
+    activeMs += millis() - stepStart;
+    return true;
+  }
+
+  if (bookStage == BookStage::THUMB) {
+    currentEpub->generateThumbBmp(UITheme::getInstance().getMetrics().homeCoverHeight);
+    bookStage = BookStage::CHAPTERS;
+    activeMs += millis() - stepStart;
+    return true;
+  }
+
+  if (spineCursor >= currentEpub->getSpineItemsCount()) {
+    booksIndexed++;
+    BOOK_CACHE.recordSize(currentEpub->getCachePath());
+    activeMs += millis() - stepStart;
+    LOG_INF("IDX", "Indexed %s", path.c_str());
+    advanceBook();
+    logThroughput("Progress");
+    return true;
+  }
+
+  uint16_t viewportWidth, viewportHeight;
+  EpubReaderActivity::getReaderViewport(&viewportWidth, &viewportHeight);
+
+  Section section(currentEpub, spineCursor, renderer);
+  if (!section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                               viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
+    bool aborted = false;
+    const auto abortFn = [&aborted, &shouldAbort] {
+      aborted = aborted || (shouldAbort && shouldAbort());
+      return aborted;
+    };
+
+    if (section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                  SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
+                                  viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, nullptr,
+                                  abortFn)) {
+      chaptersIndexed++;
+    } else if (aborted) {
+      // Leave the cursor on this chapter so the next idle period picks it up again
+      activeMs += millis() - stepStart;
+      logThroughput("Interrupted");
+      return true;
+    } else {
+      LOG_ERR("IDX", "Failed to index %s chapter %u, skipping", path.c_str(), spineCursor);
+    }
+  }
+
+  spineCursor++;
+  saveToFile();
+  activeMs += millis() - stepStart;
+  return true;
+}
+
+void LibraryIndexer::pause() {
+  currentEpub.reset();
+  bookStage = BookStage::LOAD;
+  books.clear();
+  scanned = false;
+  // Re-check the library next time, settings or books may have changed in the meantime
+  finished = false;
+}
+
+bool LibraryIndexer::saveToFile() const {
+  FsFile outputFile;
+  if (!Storage.openFileForWrite("IDX", INDEXER_FILE, outputFile)) {
+    return false;
+  }
+
+  serialization::writePod(outputFile, INDEXER_FILE_VERSION);
+  serialization::writePod(outputFile, layoutSignature);
+  serialization::writePod(outputFile, bookCount);
+  serialization::writePod(outputFile, bookCursor);
+  serialization::writePod(outputFile, spineCursor);
+  serialization::writePod(outputFile, budgetStopTotal);
+  serialization::writePod(outputFile, budgetStopLimit);
+  outputFile.close();
+  return true;
+}
+
+bool LibraryIndexer::loadFromFile() {
+  FsFile inputFile;
+  if (!Storage.openFileForRead("IDX", INDEXER_FILE, inputFile)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(inputFile, version);
+  if (version != INDEXER_FILE_VERSION) {
+    LOG_ERR("IDX", "Deserialization failed: Unknown version %u", version);
+    inputFile.close();
+    return false;
+  }
+
+  serialization::readPod(inputFile, layoutSignature);
+  serialization::readPod(inputFile, bookCount);
+  serialization::readPod(inputFile, bookCursor);
+  serialization::readPod(inputFile, spineCursor);
+  serialization::readPod(inputFile, budgetStopTotal);
+  serialization::readPod(inputFile, budgetStopLimit);
+  inputFile.close();
+  return true;
+}
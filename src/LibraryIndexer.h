@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Epub;
+class GfxRenderer;
+
+// Opt-in background job that walks the library and builds book.bin, cover, thumbnail and section files for the
+// current layout settings, so opening a book doesn't have to stop for "Indexing...".
+//
+// Work is done one chapter per step() from the main loop while the device is idle. The cursor is persisted in
+// /.crosspoint/indexer.bin so the job resumes after sleep, and restarts from the top when layout settings change.
+// It stops short of the book cache limit, leaving room for the books that are actually opened, and doesn't look at
+// the library again until the cache has shrunk or the settings have changed.
+class LibraryIndexer {
+  // Static instance
+  static LibraryIndexer instance;
+
+  std::vector<std::string> books;
+  bool scanned = false;
+  bool finished = false;
+  uint32_t layoutSignature = 0;
+  // Books found by the last scan, a different count restarts the job
+  uint16_t bookCount = 0;
+  uint16_t bookCursor = 0;
+  uint16_t spineCursor = 0;
+  // Cache size and limit when the job last stopped at the limit, 0 if it didn't
+  uint64_t budgetStopTotal = 0;
+  uint32_t budgetStopLimit = 0;
+  std::shared_ptr<Epub> currentEpub;
+  // Metadata, cover and thumbnail of a book are separate steps, so a button press is noticed between them
+  enum class BookStage : uint8_t { LOAD, COVER, THUMB, CHAPTERS };
+  BookStage bookStage = BookStage::LOAD;
+
+  // Throughput for the current run
+  uint32_t activeMs = 0;
+  uint16_t booksIndexed = 0;
+  uint16_t chaptersIndexed = 0;
+
+  void scanLibrary(const std::string& path, int depth);
+  static uint32_t computeLayoutSignature();
+  bool stoppedAtBudget() const;
+  void advanceBook();
+  void logThroughput(const char* event) const;
+  bool saveToFile() const;
+  bool loadFromFile();
+
+ public:
+  ~LibraryIndexer() = default;
+
+  // Get singleton instance
+  static LibraryIndexer& getInstance() { return instance; }
+
+  // Index one chapter, or one book's metadata, cover or thumbnail. `shouldAbort` is polled during book.bin and
+  // section builds so a button press can interrupt work midway. Returns false once there is nothing left to do.
+  bool step(GfxRenderer& renderer, const std::function<bool()>& shouldAbort);
+
+  // Drop in-memory state, e.g. when leaving the idle screen. Progress on disk is kept.
+  void pause();
+
+  bool isFinished() const { return finished; }
+};
+
+// Helper macro to access library indexer
+#define LIBRARY_INDEXER LibraryIndexer::getInstance()
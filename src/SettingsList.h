@@ -58,6 +58,9 @@ inline std::vector<SettingInfo> getSettingsList() {
       // --- System ---
       SettingInfo::Enum("Time to Sleep", &CrossPointSettings::sleepTimeout,
                         {"1 min", "5 min", "10 min", "15 min", "30 min"}, "sleepTimeout", "System"),
+      SettingInfo::Enum("Book Cache Limit", &CrossPointSettings::cacheBudget,
+                        {"Unlimited", "100 MB", "250 MB", "500 MB", "1 GB"}, "cacheBudget", "System"),
+      SettingInfo::Toggle("Pre-index Library", &CrossPointSettings::libraryPreIndex, "libraryPreIndex", "System"),
 
       // --- KOReader Sync (web-only, uses KOReaderCredentialStore) ---
       SettingInfo::DynamicString(
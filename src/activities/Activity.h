@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Logging.h>
+#include <RenderTimings.h>
 
+#include <functional>
 #include <string>
 #include <utility>
 
@@ -18,10 +20,17 @@ class Activity {
   explicit Activity(std::string name, GfxRenderer& renderer, MappedInputManager& mappedInput)
       : name(std::move(name)), renderer(renderer), mappedInput(mappedInput) {}
   virtual ~Activity() = default;
-  virtual void onEnter() { LOG_DBG("ACT", "Entering activity: %s", name.c_str()); }
+  virtual void onEnter() {
+    LOG_DBG("ACT", "Entering activity: %s", name.c_str());
+    RENDER_TIMINGS.setActivity(name.c_str());
+  }
   virtual void onExit() { LOG_DBG("ACT", "Exiting activity: %s", name.c_str()); }
   virtual void loop() {}
   virtual bool skipLoopDelay() { return false; }
   virtual bool preventAutoSleep() { return false; }
   virtual bool isReaderActivity() const { return false; }
+  // Whether the library indexer may run while this activity sits idle
+  virtual bool allowsBackgroundIndexing() const { return false; }
+  // Runs `work` with the display task kept off the renderer, for background work that shares it
+  virtual bool runWithRenderingLock(const std::function<bool()>& work) { return work(); }
 };
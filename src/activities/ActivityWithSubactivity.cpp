@@ -4,6 +4,8 @@ void ActivityWithSubactivity::exitActivity() {
   if (subActivity) {
     subActivity->onExit();
     subActivity.reset();
+    // Screens drawn from here on are this activity's again
+    RENDER_TIMINGS.setActivity(name.c_str());
   }
 }
 
@@ -3,9 +3,13 @@
 #include <Epub.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
+#include <PngToBmpConverter.h>
 #include <Txt.h>
 #include <Xtc.h>
 
+#include <algorithm>
+#include <functional>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "components/UITheme.h"
@@ -13,6 +17,43 @@
 #include "images/Logo120.h"
 #include "util/StringUtils.h"
 
+namespace {
+// BMPs made from the PNG sleep images, named after the PNG's path and size
+constexpr char SLEEP_PNG_CACHE_DIR[] = "/.crosspoint/sleep";
+
+// Keyed on the size too, so a new image saved under the same name gets converted again
+std::string sleepPngBmpPath(const std::string& pngPath, const size_t pngSize) {
+  const auto key = pngPath + ":" + std::to_string(pngSize);
+  return std::string(SLEEP_PNG_CACHE_DIR) + "/" + std::to_string(std::hash<std::string>{}(key)) + ".bmp";
+}
+
+// Removes the converted images that none of the PNGs in /sleep map to any more, deleted or replaced ones
+void pruneSleepPngCache(const std::vector<std::string>& keep) {
+  auto dir = Storage.open(SLEEP_PNG_CACHE_DIR);
+  if (!dir || !dir.isDirectory()) {
+    if (dir) dir.close();
+    return;
+  }
+
+  std::vector<std::string> toRemove;
+  char name[64];
+  for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const auto path = std::string(SLEEP_PNG_CACHE_DIR) + "/" + name;
+    if (!file.isDirectory() && std::find(keep.begin(), keep.end(), path) == keep.end()) {
+      toRemove.push_back(path);
+    }
+    file.close();
+  }
+  dir.close();
+
+  for (const auto& path : toRemove) {
+    LOG_DBG("SLP", "Removing stale sleep image %s", path.c_str());
+    Storage.remove(path.c_str());
+  }
+}
+}  // namespace
+
 void SleepActivity::onEnter() {
   Activity::onEnter();
   GUI.drawPopup(renderer, "Entering Sleep...");
@@ -35,8 +76,9 @@ void SleepActivity::renderCustomSleepScreen() const {
   auto dir = Storage.open("/sleep");
   if (dir && dir.isDirectory()) {
     std::vector<std::string> files;
+    std::vector<std::string> pngBmpPaths;
     char name[500];
-    // collect all valid BMP files
+    // collect all valid BMP files, and PNG files, which are checked once converted
     for (auto file = dir.openNextFile(); file; file = dir.openNextFile()) {
       if (file.isDirectory()) {
         file.close();
@@ -49,6 +91,12 @@ void SleepActivity::renderCustomSleepScreen() const {
         continue;
       }
 
+      if (StringUtils::checkFileExtension(filename, ".png")) {
+        files.emplace_back(filename);
+        pngBmpPaths.push_back(sleepPngBmpPath("/sleep/" + filename, file.size()));
+        file.close();
+        continue;
+      }
       if (filename.substr(filename.length() - 4) != ".bmp") {
         LOG_DBG("SLP", "Skipping non-.bmp file name: %s", name);
         file.close();
@@ -63,6 +111,7 @@ void SleepActivity::renderCustomSleepScreen() const {
       files.emplace_back(filename);
       file.close();
     }
+    pruneSleepPngCache(pngBmpPaths);
     const auto numFiles = files.size();
     if (numFiles > 0) {
       // Generate a random number between 1 and numFiles
@@ -73,9 +122,12 @@ void SleepActivity::renderCustomSleepScreen() const {
       }
       APP_STATE.lastSleepImage = randomFileIndex;
       APP_STATE.saveToFile();
-      const auto filename = "/sleep/" + files[randomFileIndex];
+      auto filename = "/sleep/" + files[randomFileIndex];
+      if (StringUtils::checkFileExtension(filename, ".png")) {
+        filename = getSleepPngBmpPath(filename);
+      }
       FsFile file;
-      if (Storage.openFileForRead("SLP", filename, file)) {
+      if (!filename.empty() && Storage.openFileForRead("SLP", filename, file)) {
         LOG_DBG("SLP", "Randomly loading: /sleep/%s", files[randomFileIndex].c_str());
         delay(100);
         Bitmap bitmap(file, true);
@@ -104,6 +156,44 @@ void SleepActivity::renderCustomSleepScreen() const {
   renderDefaultSleepScreen();
 }
 
+std::string SleepActivity::getSleepPngBmpPath(const std::string& pngPath) {
+  FsFile png, bmp;
+  if (!Storage.openFileForRead("SLP", pngPath, png)) {
+    return "";
+  }
+  const auto bmpPath = sleepPngBmpPath(pngPath, png.size());
+  if (Storage.exists(bmpPath.c_str())) {
+    png.close();
+    // Left empty when the conversion failed, so a broken image isn't decoded again on every sleep
+    if (!Storage.openFileForRead("SLP", bmpPath, bmp)) {
+      return "";
+    }
+    const bool failed = bmp.size() == 0;
+    bmp.close();
+    return failed ? "" : bmpPath;
+  }
+  Storage.mkdir(SLEEP_PNG_CACHE_DIR);
+  if (!Storage.openFileForWrite("SLP", bmpPath, bmp)) {
+    png.close();
+    return "";
+  }
+  // Cropped to cover the screen, like a large BMP, so the cover mode setting still applies when it's drawn
+  const unsigned long start = millis();
+  const bool success = PngToBmpConverter::pngFileToBmpStream(png, bmp, true);
+  png.close();
+  bmp.close();
+  if (!success) {
+    LOG_ERR("SLP", "Failed to convert sleep image %s", pngPath.c_str());
+    // Truncated to mark the failure
+    if (Storage.openFileForWrite("SLP", bmpPath, bmp)) {
+      bmp.close();
+    }
+    return "";
+  }
+  LOG_DBG("SLP", "Converted sleep image %s in %lu ms", pngPath.c_str(), millis() - start);
+  return bmpPath;
+}
+
 void SleepActivity::renderDefaultSleepScreen() const {
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
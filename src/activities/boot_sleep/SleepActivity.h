@@ -1,4 +1,6 @@
 #pragma once
+#include <string>
+
 #include "../Activity.h"
 
 class Bitmap;
@@ -15,4 +17,7 @@ class SleepActivity final : public Activity {
   void renderCoverSleepScreen() const;
   void renderBitmapSleepScreen(const Bitmap& bitmap) const;
   void renderBlankSleepScreen() const;
+  // BMP made from a PNG sleep image, converted on first use. Empty if it can't be decoded, which is remembered until
+  // the image changes.
+  static std::string getSleepPngBmpPath(const std::string& pngPath);
 };
@@ -234,6 +234,13 @@ void HomeActivity::loop() {
   }
 }
 
+bool HomeActivity::runWithRenderingLock(const std::function<bool()>& work) {
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  const bool result = work();
+  xSemaphoreGive(renderingMutex);
+  return result;
+}
+
 void HomeActivity::displayTaskLoop() {
   while (true) {
     if (updateRequired) {
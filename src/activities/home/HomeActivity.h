@@ -60,4 +60,6 @@ class HomeActivity final : public Activity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool allowsBackgroundIndexing() const override { return true; }
+  bool runWithRenderingLock(const std::function<bool()>& work) override;
 };
@@ -6,6 +6,9 @@
 #include <HalStorage.h>
 #include <Logging.h>
 
+#include <algorithm>
+
+#include "BookCacheStore.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
@@ -18,11 +21,12 @@
 #include "fontIds.h"
 
 namespace {
-// pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 constexpr int statusBarMargin = 19;
 constexpr int progressBarMarginTop = 1;
+// Boot-to-first-page is only meaningful once per boot
+bool bootToFirstPageLogged = false;
 
 int clampPercent(int percent) {
   if (percent < 0) {
@@ -34,29 +38,60 @@ int clampPercent(int percent) {
   return percent;
 }
 
-// Apply the logical reader orientation to the renderer.
+// Map the reader orientation setting to a renderer orientation.
 // This centralizes orientation mapping so we don't duplicate switch logic elsewhere.
-void applyReaderOrientation(GfxRenderer& renderer, const uint8_t orientation) {
+GfxRenderer::Orientation toRendererOrientation(const uint8_t orientation) {
   switch (orientation) {
     case CrossPointSettings::ORIENTATION::PORTRAIT:
-      renderer.setOrientation(GfxRenderer::Orientation::Portrait);
-      break;
+    default:
+      return GfxRenderer::Orientation::Portrait;
     case CrossPointSettings::ORIENTATION::LANDSCAPE_CW:
-      renderer.setOrientation(GfxRenderer::Orientation::LandscapeClockwise);
-      break;
+      return GfxRenderer::Orientation::LandscapeClockwise;
     case CrossPointSettings::ORIENTATION::INVERTED:
-      renderer.setOrientation(GfxRenderer::Orientation::PortraitInverted);
-      break;
+      return GfxRenderer::Orientation::PortraitInverted;
     case CrossPointSettings::ORIENTATION::LANDSCAPE_CCW:
-      renderer.setOrientation(GfxRenderer::Orientation::LandscapeCounterClockwise);
-      break;
-    default:
-      break;
+      return GfxRenderer::Orientation::LandscapeCounterClockwise;
   }
 }
 
+// Apply the logical reader orientation to the renderer.
+void applyReaderOrientation(GfxRenderer& renderer, const uint8_t orientation) {
+  renderer.setOrientation(toRendererOrientation(orientation));
+}
+
 }  // namespace
 
+void EpubReaderActivity::getReaderMargins(const GfxRenderer::Orientation orientation, int* orientedMarginTop,
+                                          int* orientedMarginRight, int* orientedMarginBottom,
+                                          int* orientedMarginLeft) {
+  // Apply screen viewable areas and additional padding
+  GfxRenderer::getOrientedViewableTRBL(orientation, orientedMarginTop, orientedMarginRight, orientedMarginBottom,
+                                       orientedMarginLeft);
+  *orientedMarginTop += SETTINGS.screenMargin;
+  *orientedMarginLeft += SETTINGS.screenMargin;
+  *orientedMarginRight += SETTINGS.screenMargin;
+  *orientedMarginBottom += SETTINGS.screenMargin;
+
+  // Add status bar margin
+  if (SETTINGS.statusBar != CrossPointSettings::STATUS_BAR_MODE::NONE) {
+    const auto metrics = UITheme::getInstance().getMetrics();
+    // Add additional margin for status bar if progress bar is shown
+    const bool showProgressBar = SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::BOOK_PROGRESS_BAR ||
+                                 SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::ONLY_BOOK_PROGRESS_BAR ||
+                                 SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::CHAPTER_PROGRESS_BAR;
+    *orientedMarginBottom += statusBarMargin - SETTINGS.screenMargin +
+                             (showProgressBar ? (metrics.bookProgressBarHeight + progressBarMarginTop) : 0);
+  }
+}
+
+void EpubReaderActivity::getReaderViewport(uint16_t* viewportWidth, uint16_t* viewportHeight) {
+  const auto orientation = toRendererOrientation(SETTINGS.orientation);
+  int marginTop, marginRight, marginBottom, marginLeft;
+  getReaderMargins(orientation, &marginTop, &marginRight, &marginBottom, &marginLeft);
+  *viewportWidth = GfxRenderer::getScreenWidth(orientation) - marginLeft - marginRight;
+  *viewportHeight = GfxRenderer::getScreenHeight(orientation) - marginTop - marginBottom;
+}
+
 void EpubReaderActivity::taskTrampoline(void* param) {
   auto* self = static_cast<EpubReaderActivity*>(param);
   self->displayTaskLoop();
@@ -106,6 +141,7 @@ void EpubReaderActivity::onEnter() {
   APP_STATE.openEpubPath = epub->getPath();
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(epub->getPath(), epub->getTitle(), epub->getAuthor(), epub->getThumbBmpPath());
+  BOOK_CACHE.touch(epub->getCachePath());
 
   // Trigger first update
   updateRequired = true;
@@ -124,7 +160,9 @@ void EpubReaderActivity::onExit() {
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
-  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
+  // Wait until not rendering to delete task to avoid killing mid-instruction to EPD. A chapter that is still being
+  // paginated is abandoned, it will be rebuilt next time.
+  abortSectionBuild.store(true);
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
@@ -134,7 +172,9 @@ void EpubReaderActivity::onExit() {
   renderingMutex = nullptr;
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  BOOK_CACHE.updateSizeAndEnforceBudget(epub->getCachePath());
   section.reset();
+  pageImages.clear();
   epub.reset();
 }
 
@@ -186,8 +226,8 @@ void EpubReaderActivity::loop() {
 
   // Enter reader menu activity.
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
-    // Don't start activity transition while rendering
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    // Don't start activity transition while rendering. A chapter still being built is dropped and built again later.
+    takeRenderingMutexAbortingBuild();
     const int currentPage = section ? section->currentPage + 1 : 0;
     const int totalPages = section ? section->pageCount : 0;
     float bookProgress = 0.0f;
@@ -196,6 +236,8 @@ void EpubReaderActivity::loop() {
       bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
     }
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
+    // Leave the heap to the menu and what it opens
+    pageImages.clear();
     exitActivity();
     enterNewActivity(new EpubReaderMenuActivity(
         this->renderer, this->mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
@@ -233,6 +275,7 @@ void EpubReaderActivity::loop() {
   if (!prevTriggered && !nextTriggered) {
     return;
   }
+  pageTurnStart = millis();
 
   // any botton press when at end of the book goes back to the last page
   if (currentSpineIndex > 0 && currentSpineIndex >= epub->getSpineItemsCount()) {
@@ -246,7 +289,7 @@ void EpubReaderActivity::loop() {
 
   if (skipChapter) {
     // We don't want to delete the section mid-render, so grab the semaphore
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    takeRenderingMutexAbortingBuild();
     nextPageNumber = 0;
     currentSpineIndex = nextTriggered ? currentSpineIndex + 1 : currentSpineIndex - 1;
     section.reset();
@@ -261,12 +304,19 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  if (sectionLoading.load()) {
+    // The display task owns the section until it is built and picks the turn up from there
+    pendingPageTurns.fetch_add(prevTriggered ? -1 : 1);
+    updateRequired = true;
+    return;
+  }
+
   if (prevTriggered) {
     if (section->currentPage > 0) {
       section->currentPage--;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      takeRenderingMutexAbortingBuild();
       nextPageNumber = UINT16_MAX;
       currentSpineIndex--;
       section.reset();
@@ -278,7 +328,7 @@ void EpubReaderActivity::loop() {
       section->currentPage++;
     } else {
       // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      takeRenderingMutexAbortingBuild();
       nextPageNumber = 0;
       currentSpineIndex++;
       section.reset();
@@ -288,6 +338,15 @@ void EpubReaderActivity::loop() {
   }
 }
 
+// Stops a section build running in the display task, which then drops the partial section, and waits for the
+// rendering mutex. Without the abort the mutex is only given back once the whole chapter is laid out.
+void EpubReaderActivity::takeRenderingMutexAbortingBuild() {
+  abortSectionBuild.store(true);
+  xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  abortSectionBuild.store(false);
+  pendingPageTurns.store(0);
+}
+
 void EpubReaderActivity::onReaderMenuBack(const uint8_t orientation) {
   exitActivity();
   // Apply the user-selected orientation when the menu is dismissed.
@@ -379,10 +438,11 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
             exitActivity();
             updateRequired = true;
           },
-          [this](const int newSpineIndex) {
-            if (currentSpineIndex != newSpineIndex) {
+          [this](const int newSpineIndex, const std::string& anchor) {
+            if (currentSpineIndex != newSpineIndex || !anchor.empty()) {
               currentSpineIndex = newSpineIndex;
               nextPageNumber = 0;
+              pendingAnchor = anchor;
               section.reset();
             }
             exitActivity();
@@ -544,35 +604,22 @@ void EpubReaderActivity::renderScreen() {
     return;
   }
 
-  // Apply screen viewable areas and additional padding
   int orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft;
-  renderer.getOrientedViewableTRBL(&orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
-                                   &orientedMarginLeft);
-  orientedMarginTop += SETTINGS.screenMargin;
-  orientedMarginLeft += SETTINGS.screenMargin;
-  orientedMarginRight += SETTINGS.screenMargin;
-  orientedMarginBottom += SETTINGS.screenMargin;
-
-  auto metrics = UITheme::getInstance().getMetrics();
-
-  // Add status bar margin
-  if (SETTINGS.statusBar != CrossPointSettings::STATUS_BAR_MODE::NONE) {
-    // Add additional margin for status bar if progress bar is shown
-    const bool showProgressBar = SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::BOOK_PROGRESS_BAR ||
-                                 SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::ONLY_BOOK_PROGRESS_BAR ||
-                                 SETTINGS.statusBar == CrossPointSettings::STATUS_BAR_MODE::CHAPTER_PROGRESS_BAR;
-    orientedMarginBottom += statusBarMargin - SETTINGS.screenMargin +
-                            (showProgressBar ? (metrics.bookProgressBarHeight + progressBarMarginTop) : 0);
-  }
+  getReaderMargins(renderer.getOrientation(), &orientedMarginTop, &orientedMarginRight, &orientedMarginBottom,
+                   &orientedMarginLeft);
 
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     LOG_DBG("ERS", "Loading file: %s, index: %d", filepath.c_str(), currentSpineIndex);
+    pageImages.clear();
+    pendingPageTurns.store(0);
+    sectionLoading.store(true);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
 
     const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
     const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
 
+    const unsigned long loadStart = millis();
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                   viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
@@ -580,18 +627,70 @@ void EpubReaderActivity::renderScreen() {
 
       const auto popupFn = [this]() { GUI.drawPopup(renderer, "Indexing..."); };
 
+      // The target page can be shown while the rest of the chapter is paginated, unless finding it needs the final
+      // page count or the anchor table (last page, TOC entry anchor, or repositioning after a settings change or
+      // percent jump)
+      const bool canStream = nextPageNumber != UINT16_MAX && !pendingPercentJump && pendingAnchor.empty() &&
+                             !(cachedChapterTotalPageCount > 0 && currentSpineIndex == cachedSpineIndex);
+      streamedPage = -1;
+      section->currentPage = nextPageNumber;
+      const unsigned long buildStart = millis();
+      const auto pagePublishedFn = [this, orientedMarginTop, orientedMarginRight, orientedMarginBottom,
+                                    orientedMarginLeft, buildStart]() {
+        renderPublishedPage(orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft,
+                            buildStart);
+      };
+
       if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
-                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, popupFn)) {
-        LOG_ERR("ERS", "Failed to persist page data to SD");
+                                      viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, popupFn,
+                                      [this] { return abortSectionBuild.load(); },
+                                      canStream ? pagePublishedFn : std::function<void()>(nullptr))) {
+        if (abortSectionBuild.load()) {
+          // The partial file is already removed. Turning back past the first page opens the previous chapter,
+          // otherwise the chapter is built again from the page reached once it is shown next.
+          LOG_DBG("ERS", "Chapter %d build abandoned", currentSpineIndex);
+          if (section->currentPage < 0) {
+            currentSpineIndex--;
+            nextPageNumber = UINT16_MAX;
+            abortSectionBuild.store(false);
+            updateRequired = true;
+          } else {
+            nextPageNumber = section->currentPage;
+          }
+        } else {
+          LOG_ERR("ERS", "Failed to persist page data to SD");
+        }
+        pendingPageTurns.store(0);
         section.reset();
+        sectionLoading.store(false);
         return;
       }
+      LOG_INF("ERS", "Chapter %d: %d pages built in %lu ms", currentSpineIndex, section->pageCount,
+              millis() - buildStart);
+      RENDER_TIMINGS.record(RenderTimings::SECTION_BUILD, millis() - buildStart);
     } else {
       LOG_DBG("ERS", "Cache found, skipping build...");
+      RENDER_TIMINGS.record(RenderTimings::SECTION_LOAD, millis() - loadStart);
     }
 
-    if (nextPageNumber == UINT16_MAX) {
+    if (streamedPage >= 0) {
+      // Already positioned (and possibly moved on by the reader) during the build
+      section->currentPage += pendingPageTurns.exchange(0);
+      if (section->currentPage >= section->pageCount) {
+        section->currentPage = section->pageCount - 1;
+      }
+      if (section->currentPage < 0) {
+        section->currentPage = 0;
+      }
+      sectionLoading.store(false);
+      if (section->currentPage == streamedPage) {
+        streamedPage = -1;
+        saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+        return;
+      }
+      streamedPage = -1;
+    } else if (nextPageNumber == UINT16_MAX) {
       section->currentPage = section->pageCount - 1;
     } else {
       section->currentPage = nextPageNumber;
@@ -617,6 +716,18 @@ void EpubReaderActivity::renderScreen() {
       section->currentPage = newPage;
       pendingPercentJump = false;
     }
+
+    if (!pendingAnchor.empty()) {
+      const int anchorPage = section->getPageForAnchor(pendingAnchor);
+      if (anchorPage >= 0) {
+        section->currentPage = anchorPage;
+      }
+      pendingAnchor.clear();
+    }
+    // Turns pressed while the section was loaded from the cache, or built without showing pages early, are dropped
+    // like a press during a render would have been
+    pendingPageTurns.store(0);
+    sectionLoading.store(false);
   }
 
   renderer.clearScreen();
@@ -638,7 +749,8 @@ void EpubReaderActivity::renderScreen() {
   }
 
   {
-    auto p = section->loadPageFromSectionFile();
+    const int page = section->currentPage;
+    auto p = section->loadPage(page);
     if (!p) {
       LOG_ERR("ERS", "Failed to load page from SD - clearing section cache");
       section->clearCache();
@@ -646,12 +758,54 @@ void EpubReaderActivity::renderScreen() {
       return renderScreen();
     }
     const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    const FrameImage* image = pageImages.find(page);
+    const bool pageDrawn = image && renderer.drawFrame(*image);
+    renderContents(*p, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft, pageDrawn,
+                   page);
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
+    // readerActivityLoadCount is only non-zero when the book was reopened straight from boot
+    if (!bootToFirstPageLogged && APP_STATE.readerActivityLoadCount > 0) {
+      bootToFirstPageLogged = true;
+      LOG_INF("ERS", "Boot to first page: %lu ms", millis());
+    }
   }
   saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
 }
 
+// Called by the section build each time a page is written. Shows the wanted page as soon as it exists, and later pages
+// the reader turns to while the rest of the chapter is still being laid out.
+void EpubReaderActivity::renderPublishedPage(const int orientedMarginTop, const int orientedMarginRight,
+                                             const int orientedMarginBottom, const int orientedMarginLeft,
+                                             const unsigned long buildStart) {
+  // At most one page past the published ones, which is shown once it is laid out
+  const int turns = pendingPageTurns.exchange(0);
+  if (turns != 0 && section->currentPage >= 0) {
+    section->currentPage = std::min(section->currentPage + turns, static_cast<int>(section->pageCount));
+  }
+  const int page = section->currentPage;
+  if (page < 0) {
+    // Turned back past the first page, the rest of this chapter isn't needed now
+    abortSectionBuild.store(true);
+    return;
+  }
+  if (page >= section->pageCount || page == streamedPage) {
+    return;
+  }
+
+  auto p = section->loadPageFromSectionFile();
+  if (!p) {
+    return;
+  }
+  updateRequired = false;
+  if (streamedPage < 0) {
+    LOG_INF("ERS", "Chapter %d: page %d shown after %lu ms (%d pages laid out)", currentSpineIndex, page,
+            millis() - buildStart, section->pageCount);
+  }
+  streamedPage = page;
+  renderer.clearScreen();
+  renderContents(*p, orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+}
+
 void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
   FsFile f;
   if (Storage.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
@@ -669,45 +823,96 @@ void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageC
     LOG_ERR("ERS", "Could not save progress!");
   }
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
-                                        const int orientedMarginRight, const int orientedMarginBottom,
-                                        const int orientedMarginLeft) {
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+void EpubReaderActivity::renderContents(const Page& page, const int orientedMarginTop, const int orientedMarginRight,
+                                        const int orientedMarginBottom, const int orientedMarginLeft,
+                                        const bool pageDrawn, const int pageIndex) {
+  if (!pageDrawn) {
+    RenderTimings::Scope timer(RenderTimings::RASTERISE);
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  renderer.displayPageTurn(SETTINGS.getRefreshFrequency());
+  if (pageTurnStart != 0) {
+    LOG_DBG("ERS", "Page turn: %lu ms from press to refresh (%s, %d of %d page images hit)", millis() - pageTurnStart,
+            pageDrawn ? "cached" : "rendered on turn", pageImages.getHits(), pageImages.getLookups());
+    pageTurnStart = 0;
+  }
+
+  // The BW snapshot and the grayscale pass get the heap the cached pages hold. The page on screen and the one after it
+  // are captured again below once the pass is done, only backward turns lose their cached pages.
+  if (SETTINGS.textAntiAliasing) {
+    pageImages.clear();
   }
 
   // Save bw buffer to reset buffer state after grayscale data sync
-  renderer.storeBwBuffer();
+  bool bwBufferStored = renderer.storeBwBuffer();
+  if (!bwBufferStored && !pageImages.empty()) {
+    // The grayscale pass matters more than the cached pages
+    pageImages.clear();
+    bwBufferStored = renderer.storeBwBuffer();
+  }
 
   // grayscale rendering
   // TODO: Only do this if font supports it
   if (SETTINGS.textAntiAliasing) {
+    const unsigned long grayscaleStart = millis();
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleLsbBuffers();
 
     // Render and copy to MSB buffer
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
     renderer.copyGrayscaleMsbBuffers();
+    RENDER_TIMINGS.record(RenderTimings::GRAYSCALE, millis() - grayscaleStart);
 
     // display grayscale part
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
   }
 
+  // The frame buffer can only be drawn over while the BW data is stored
+  if (bwBufferStored && pageIndex >= 0) {
+    cachePageImage(page, pageIndex, orientedMarginTop, orientedMarginLeft);
+  }
+
   // restore the bw data
   renderer.restoreBwBuffer();
 }
 
+// The panel refresh blocks, so pages are drawn for the cache once the current one is shown and the reader is still
+// reading it. Only the page contents are kept, the status bar changes with every page and is drawn on the turn.
+void EpubReaderActivity::cachePageImage(const Page& page, const int pageIndex, const int orientedMarginTop,
+                                        const int orientedMarginLeft) {
+  const auto start = millis();
+  if (!pageImages.contains(pageIndex)) {
+    renderer.clearScreen();
+    page.render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    if (!pageImages.store(renderer, pageIndex)) {
+      return;
+    }
+  }
+
+  // Pages of a section still being built are shown as the build publishes them
+  const int nextPage = pageIndex + 1;
+  if (section->isBuilding() || nextPage >= section->pageCount || pageImages.contains(nextPage)) {
+    return;
+  }
+  // Replaces `page`
+  auto p = section->loadPage(nextPage);
+  if (!p) {
+    return;
+  }
+  renderer.clearScreen();
+  p->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  if (pageImages.store(renderer, nextPage)) {
+    LOG_DBG("ERS", "Cached pages %d and %d in %lu ms, %zu bytes held", pageIndex, nextPage, millis() - start,
+            pageImages.size());
+  }
+}
+
 void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const int orientedMarginBottom,
                                          const int orientedMarginLeft) const {
   auto metrics = UITheme::getInstance().getMetrics();
@@ -1,10 +1,13 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/Section.h>
+#include <PageImageCache.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
+#include <atomic>
+
 #include "EpubReaderMenuActivity.h"
 #include "activities/ActivityWithSubactivity.h"
 
@@ -15,7 +18,6 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
-  int pagesUntilFullRefresh = 0;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
   // Signals that the next render should reposition within the newly loaded section
@@ -23,19 +25,40 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   bool pendingPercentJump = false;
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
+  // Element id to open once the section is loaded, from a TOC entry
+  std::string pendingAnchor;
   bool updateRequired = false;
   bool pendingSubactivityExit = false;  // Defer subactivity exit to avoid use-after-free
   bool pendingGoHome = false;           // Defer go home to avoid race condition with display task
   bool skipNextButtonCheck = false;     // Skip button processing for one frame after subactivity exit
+  // Set by the main loop before it waits for the display task, and polled by a section build there, so it stops early
+  std::atomic<bool> abortSectionBuild{false};
+  // True while the display task loads or builds the section. The main loop then leaves the section alone and queues
+  // its page turns in pendingPageTurns, which the display task applies as pages are published.
+  std::atomic<bool> sectionLoading{false};
+  std::atomic<int> pendingPageTurns{0};
+  int streamedPage = -1;                // Page shown while the current section was still being built
+  // Contents of recent pages of the current section and of the one after the page on screen, drawn while the panel
+  // was idle so turning to them only has to put the image back
+  PageImageCache pageImages;
+  unsigned long pageTurnStart = 0;  // When the current page turn was pressed, 0 once its page is on screen
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
+  static void getReaderMargins(GfxRenderer::Orientation orientation, int* orientedMarginTop, int* orientedMarginRight,
+                               int* orientedMarginBottom, int* orientedMarginLeft);
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
   void renderScreen();
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
-                      int orientedMarginBottom, int orientedMarginLeft);
+  // pageDrawn: the page contents are already in the frame buffer. pageIndex: cache this page and render the next one
+  // ahead once it is shown, -1 for neither.
+  void renderContents(const Page& page, int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                      int orientedMarginLeft, bool pageDrawn = false, int pageIndex = -1);
+  void cachePageImage(const Page& page, int pageIndex, int orientedMarginTop, int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
+  void renderPublishedPage(int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                           int orientedMarginLeft, unsigned long buildStart);
+  void takeRenderingMutexAbortingBuild();
   void saveProgress(int spineIndex, int currentPage, int pageCount);
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
@@ -53,4 +76,8 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+
+  // Section viewport for the current reader settings. Shared with the library indexer so pre-built sections match
+  // what the reader would build itself.
+  static void getReaderViewport(uint16_t* viewportWidth, uint16_t* viewportHeight);
 };
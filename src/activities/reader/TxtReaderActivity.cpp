@@ -5,6 +5,7 @@
 #include <Serialization.h>
 #include <Utf8.h>
 
+#include "BookCacheStore.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
@@ -63,6 +64,7 @@ void TxtReaderActivity::onEnter() {
   APP_STATE.openEpubPath = filePath;
   APP_STATE.saveToFile();
   RECENT_BOOKS.addBook(filePath, fileName, "", "");
+  BOOK_CACHE.touch(txt->getCachePath());
 
   // Trigger first update
   updateRequired = true;
@@ -93,6 +95,7 @@ void TxtReaderActivity::onExit() {
   currentPageLines.clear();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  BOOK_CACHE.updateSizeAndEnforceBudget(txt->getCachePath());
   txt.reset();
 }
 
@@ -454,22 +457,20 @@ void TxtReaderActivity::renderPage() {
   };
 
   // First pass: BW rendering
-  renderLines();
+  {
+    RenderTimings::Scope timer(RenderTimings::RASTERISE);
+    renderLines();
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  renderer.displayPageTurn(SETTINGS.getRefreshFrequency());
 
   // Grayscale rendering pass (for anti-aliased fonts)
   if (SETTINGS.textAntiAliasing) {
     // Save BW buffer for restoration after grayscale pass
     renderer.storeBwBuffer();
 
+    const unsigned long grayscaleStart = millis();
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     renderLines();
@@ -479,6 +480,7 @@ void TxtReaderActivity::renderPage() {
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     renderLines();
     renderer.copyGrayscaleMsbBuffers();
+    RENDER_TIMINGS.record(RenderTimings::GRAYSCALE, millis() - grayscaleStart);
 
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
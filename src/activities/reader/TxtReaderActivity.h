@@ -16,7 +16,6 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentPage = 0;
   int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
@@ -1,19 +1,24 @@
 #include <Arduino.h>
 #include <Epub.h>
+#include <Epub/hyphenation/HyphenationPackStorage.h>
+#include <Epub/hyphenation/Hyphenator.h>
 #include <GfxRenderer.h>
 #include <HalDisplay.h>
 #include <HalGPIO.h>
 #include <HalStorage.h>
 #include <Logging.h>
+#include <RenderTimings.h>
 #include <SPI.h>
 #include <builtinFonts/all.h>
 
 #include <cstring>
 
 #include "Battery.h"
+#include "BookCacheStore.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "KOReaderCredentialStore.h"
+#include "LibraryIndexer.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "activities/boot_sleep/BootActivity.h"
@@ -305,6 +310,8 @@ void setup() {
 
   SETTINGS.loadFromFile();
   KOREADER_STORE.loadFromFile();
+  // Hyphenation for languages without built-in patterns comes from packs in /hyphenation
+  Hyphenator::setPackOpener(openHyphenationPackFromStorage);
   UITheme::getInstance().reload();
   ButtonNavigator::setMappedInputManager(mappedInputManager);
 
@@ -336,6 +343,7 @@ void setup() {
 
   APP_STATE.loadFromFile();
   RECENT_BOOKS.loadFromFile();
+  BOOK_CACHE.loadFromFile();
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
@@ -382,6 +390,10 @@ void loop() {
         uint8_t* buf = display.getFrameBuffer();
         logSerial.write(buf, HalDisplay::BUFFER_SIZE);
         logSerial.printf("SCREENSHOT_END\n");
+      } else if (cmd == "TIMINGS") {
+        RENDER_TIMINGS.report();
+      } else if (cmd == "TIMINGS_RESET") {
+        RENDER_TIMINGS.reset();
       }
     }
   }
@@ -392,8 +404,10 @@ void loop() {
     lastActivityTime = millis();  // Reset inactivity timer
   }
 
+  // Keep awake while pre-indexing on USB power, the work is what the user plugged in for
+  static bool libraryIndexerActive = false;
   const unsigned long sleepTimeoutMs = SETTINGS.getSleepTimeoutMs();
-  if (millis() - lastActivityTime >= sleepTimeoutMs) {
+  if (millis() - lastActivityTime >= sleepTimeoutMs && !(libraryIndexerActive && gpio.isUsbConnected())) {
     LOG_DBG("SLP", "Auto-sleep triggered after %lu ms of inactivity", sleepTimeoutMs);
     enterDeepSleep();
     // This should never be hit as `enterDeepSleep` calls esp_deep_sleep_start
@@ -412,6 +426,36 @@ void loop() {
   }
   const unsigned long activityDuration = millis() - activityStartTime;
 
+  // Opt-in library pre-indexing while idle on the home screen, sooner when on USB power. Half the shortest sleep
+  // timeout, so there is time to index something before the device goes to sleep.
+  static constexpr unsigned long INDEXER_IDLE_MS = 30000;
+  static constexpr unsigned long INDEXER_IDLE_USB_MS = 5000;
+  static bool libraryIndexerEngaged = false;
+  const unsigned long indexerIdleMs = gpio.isUsbConnected() ? INDEXER_IDLE_USB_MS : INDEXER_IDLE_MS;
+  const bool indexerAllowed = SETTINGS.libraryPreIndex && currentActivity &&
+                              currentActivity->allowsBackgroundIndexing() &&
+                              millis() - lastActivityTime >= indexerIdleMs;
+  if (indexerAllowed && !LIBRARY_INDEXER.isFinished()) {
+    bool interrupted = false;
+    libraryIndexerEngaged = true;
+    const auto shouldAbort = [&interrupted] {
+      // Any button press interrupts the job; the press is consumed so the first one only wakes the device up
+      gpio.update();
+      interrupted = interrupted || gpio.wasAnyPressed();
+      return interrupted;
+    };
+    // Section builds use the shared renderer and hyphenation state, so the activity's display task has to wait
+    libraryIndexerActive = currentActivity->runWithRenderingLock(
+        [&shouldAbort] { return !shouldAbort() && LIBRARY_INDEXER.step(renderer, shouldAbort); });
+    if (interrupted) {
+      lastActivityTime = millis();
+    }
+  } else if (!indexerAllowed && libraryIndexerEngaged) {
+    LIBRARY_INDEXER.pause();
+    libraryIndexerEngaged = false;
+    libraryIndexerActive = false;
+  }
+
   const unsigned long loopDuration = millis() - loopStartTime;
   if (loopDuration > maxLoopDuration) {
     maxLoopDuration = loopDuration;
@@ -1,7 +1,9 @@
 #include "CrossPointWebServer.h"
 
 #include <ArduinoJson.h>
-#include <Epub.h>
+#include <Epub/BookCacheKey.h>
+#include <Epub/hyphenation/HyphenationPackStorage.h>
+#include <Epub/hyphenation/Hyphenator.h>
 #include <FsHelpers.h>
 #include <HalStorage.h>
 #include <Logging.h>
@@ -40,12 +42,38 @@ String wsLastCompleteName;
 size_t wsLastCompleteSize = 0;
 unsigned long wsLastCompleteAt = 0;
 
-// Helper function to clear epub cache after upload
-void clearEpubCacheIfNeeded(const String& filePath) {
-  // Only clear cache for .epub files
+// Helper function to drop the remembered cache key after an upload, rename or move.
+// Epub caches are keyed on file contents, so the cache itself stays valid for any other path holding the same book.
+void forgetEpubCacheKeyIfNeeded(const String& filePath) {
+  // Only epub caches are content keyed
   if (StringUtils::checkFileExtension(filePath, ".epub")) {
-    Epub(filePath.c_str(), "/.crosspoint").clearCache();
-    LOG_DBG("WEB", "Cleared epub cache for: %s", filePath.c_str());
+    BookCacheKey::forget("/.crosspoint", filePath.c_str());
+    LOG_DBG("WEB", "Forgot epub cache key for: %s", filePath.c_str());
+  }
+}
+
+// Helper function to let a newly uploaded hyphenation pack be picked up, languages found without one are remembered
+void refreshHyphenationPacksIfNeeded(const String& filePath) {
+  if (StringUtils::checkFileExtension(filePath, ".hyp")) {
+    Hyphenator::setPackOpener(openHyphenationPackFromStorage);
+  }
+}
+
+// Helper function to delete the cache of an epub that is about to be overwritten, which would otherwise stay on the
+// card for good with an unlimited cache budget. Kept when another copy of the same book still uses it.
+void removeSupersededEpubCache(const String& filePath) {
+  if (!StringUtils::checkFileExtension(filePath, ".epub")) {
+    return;
+  }
+  const uint64_t key = BookCacheKey::get("/.crosspoint", filePath.c_str());
+  BookCacheKey::forget("/.crosspoint", filePath.c_str());
+  if (BookCacheKey::isShared("/.crosspoint", filePath.c_str(), key)) {
+    return;
+  }
+  const std::string cachePath = "/.crosspoint/epub_" + std::to_string(key);
+  if (Storage.exists(cachePath.c_str())) {
+    Storage.removeDir(cachePath.c_str());
+    LOG_DBG("WEB", "Removed superseded cache: %s", cachePath.c_str());
   }
 }
 
@@ -589,6 +617,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
     if (Storage.exists(filePath.c_str())) {
       LOG_DBG("WEB", "[UPLOAD] Overwriting existing file: %s", filePath.c_str());
       esp_task_wdt_reset();
+      removeSupersededEpubCache(filePath);
       Storage.remove(filePath.c_str());
     }
 
@@ -657,11 +686,12 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         LOG_DBG("WEB", "[UPLOAD] Diagnostics: %d writes, total write time: %lu ms (%.1f%%)", writeCount, totalWriteTime,
                 writePercent);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
+        // Forget the old cache key to prevent stale metadata issues when overwriting files
         String filePath = state.path;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
-        clearEpubCacheIfNeeded(filePath);
+        forgetEpubCacheKeyIfNeeded(filePath);
+        refreshHyphenationPacksIfNeeded(filePath);
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -807,7 +837,9 @@ void CrossPointWebServer::handleRename() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
+  // A file deleted from the target path earlier may still be remembered there
+  forgetEpubCacheKeyIfNeeded(itemPath);
+  forgetEpubCacheKeyIfNeeded(newPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
@@ -900,7 +932,9 @@ void CrossPointWebServer::handleMove() const {
     return;
   }
 
-  clearEpubCacheIfNeeded(itemPath);
+  // A file deleted from the target path earlier may still be remembered there
+  forgetEpubCacheKeyIfNeeded(itemPath);
+  forgetEpubCacheKeyIfNeeded(newPath);
   const bool success = file.rename(newPath.c_str());
   file.close();
 
@@ -1226,6 +1260,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
           // Check if file exists and remove it
           esp_task_wdt_reset();
           if (Storage.exists(filePath.c_str())) {
+            removeSupersededEpubCache(filePath);
             Storage.remove(filePath.c_str());
           }
 
@@ -1290,11 +1325,12 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         LOG_DBG("WS", "Upload complete: %s (%d bytes in %lu ms, %.1f KB/s)", wsUploadFileName.c_str(), wsUploadSize,
                 elapsed, kbps);
 
-        // Clear epub cache to prevent stale metadata issues when overwriting files
+        // Forget the old cache key to prevent stale metadata issues when overwriting files
         String filePath = wsUploadPath;
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
-        clearEpubCacheIfNeeded(filePath);
+        forgetEpubCacheKeyIfNeeded(filePath);
+        refreshHyphenationPacksIfNeeded(filePath);
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
@@ -0,0 +1,40 @@
+#pragma once
+
+// Host stand-in for the e-ink panel: a frame buffer with the panel's geometry and nothing behind it. Also brings in
+// what the renderer gets through Arduino.h on the device.
+
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+class HalDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  void clearScreen(const uint8_t color = 0xFF) const { memset(frameBuffer, color, BUFFER_SIZE); }
+  void drawImage(const uint8_t*, uint16_t, uint16_t, uint16_t, uint16_t, bool = false) const {}
+  void displayBuffer(RefreshMode = FAST_REFRESH, bool = false) { pushes++; }
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+  void copyGrayscaleLsbBuffers(const uint8_t*) {}
+  void copyGrayscaleMsbBuffers(const uint8_t*) {}
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void displayGrayBuffer(bool = false) {}
+
+  // Frames pushed to the panel so far
+  int pushes = 0;
+
+ private:
+  mutable uint8_t frameBuffer[BUFFER_SIZE] = {};
+};
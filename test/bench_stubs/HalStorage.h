@@ -0,0 +1,38 @@
+#pragma once
+
+// Host stand-in for the SD card file: the file lives in memory, so timings cover decoding and drawing only. It reads
+// from the caller's vector without copying it, which would count towards a converter's heap.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Print.h"
+
+class FsFile {
+ public:
+  explicit FsFile(const std::vector<uint8_t>& data) : data(data) {}
+
+  int read() { return pos < data.size() ? data[pos++] : -1; }
+  int read(void* buffer, const size_t count) {
+    const size_t n = std::min(count, data.size() - std::min(pos, data.size()));
+    memcpy(buffer, data.data() + pos, n);
+    pos += n;
+    return static_cast<int>(n);
+  }
+  bool seek(const uint64_t position) {
+    pos = position;
+    return true;
+  }
+  bool seekCur(const int64_t offset) {
+    pos += offset;
+    return true;
+  }
+  explicit operator bool() const { return true; }
+
+ private:
+  const std::vector<uint8_t>& data;
+  size_t pos = 0;
+};
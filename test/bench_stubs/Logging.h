@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for logging: prints nothing, but still takes the arguments, so values computed only to be logged
+// count as used and the formats are checked
+
+__attribute__((format(printf, 2, 3))) inline void logDiscard(const char*, const char*, ...) {}
+
+#define LOG_DBG(origin, format, ...) logDiscard(origin, format, ##__VA_ARGS__)
+#define LOG_ERR(origin, format, ...) logDiscard(origin, format, ##__VA_ARGS__)
+#define LOG_INF(origin, format, ...) logDiscard(origin, format, ##__VA_ARGS__)
@@ -0,0 +1,22 @@
+#pragma once
+
+// Host stand-in for Arduino's Print: collects the BMP written, with its capacity reserved up front so growing it
+// doesn't count towards the converter's heap
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Print {
+ public:
+  size_t write(const uint8_t byte) {
+    bytes.push_back(byte);
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, const size_t size) {
+    bytes.insert(bytes.end(), buffer, buffer + size);
+    return size;
+  }
+
+  std::vector<uint8_t> bytes;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+// Host stand-in for the render timings, which report over the device's serial port: records nothing.
+
+class RenderTimings {
+ public:
+  enum Phase { SECTION_LOAD, SECTION_BUILD, PAGE_LOAD, RASTERISE, GRAYSCALE, REFRESH, GRAY_REFRESH, IMAGE_BUILD,
+               PHASE_COUNT };
+
+  class Scope {
+   public:
+    explicit Scope(Phase) {}
+  };
+
+  static RenderTimings& getInstance() {
+    static RenderTimings instance;
+    return instance;
+  }
+  void record(Phase, unsigned long) {}
+};
+
+#define RENDER_TIMINGS RenderTimings::getInstance()
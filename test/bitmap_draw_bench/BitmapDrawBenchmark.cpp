@@ -0,0 +1,284 @@
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <HalStorage.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Times GfxRenderer::drawBitmap on full-screen BMPs against the per-pixel floating-point path it replaced, kept
+// below as the reference. Each draw parses the headers and decodes every row from memory, as a sleep screen does
+// from the SD card. The host has an FPU, so the float cost the ESP32-C3 pays in software does not show here.
+
+namespace {
+constexpr int SCREEN_WIDTH = 480;
+constexpr int SCREEN_HEIGHT = 800;
+constexpr int ROUNDS = 20;
+
+void put16(std::vector<uint8_t>& out, const uint16_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back(v >> 8);
+}
+
+void put32(std::vector<uint8_t>& out, const uint32_t v) {
+  put16(out, v & 0xFFFF);
+  put16(out, v >> 16);
+}
+
+// Smooth gradients with a checkerboard of hard edges on top, so every gray level and plenty of edges show up
+uint8_t luminance(const int x, const int y, const int width, const int height) {
+  const int gradient = (x * 255 / width + y * 255 / height) / 2;
+  return static_cast<uint8_t>(((x / 40 + y / 40) % 2 == 0) ? gradient : 255 - gradient);
+}
+
+std::vector<uint8_t> makeBmp(const int width, const int height, const int bpp, const bool topDown) {
+  const int paletteSize = bpp <= 8 ? 1 << bpp : 0;
+  const int rowBytes = (width * bpp + 31) / 32 * 4;
+  const uint32_t dataOffset = 14 + 40 + paletteSize * 4;
+
+  std::vector<uint8_t> out;
+  out.push_back('B');
+  out.push_back('M');
+  put32(out, dataOffset + rowBytes * height);
+  put32(out, 0);
+  put32(out, dataOffset);
+  put32(out, 40);
+  put32(out, width);
+  put32(out, topDown ? -height : height);
+  put16(out, 1);
+  put16(out, bpp);
+  put32(out, 0);
+  put32(out, rowBytes * height);
+  put32(out, 2835);
+  put32(out, 2835);
+  put32(out, paletteSize);
+  put32(out, 0);
+  for (int i = 0; i < paletteSize; i++) {
+    const auto level = static_cast<uint8_t>(i * 255 / (paletteSize - 1));
+    out.insert(out.end(), {level, level, level, 0});
+  }
+
+  std::vector<uint8_t> row(rowBytes);
+  for (int fileRow = 0; fileRow < height; fileRow++) {
+    const int y = topDown ? fileRow : height - 1 - fileRow;
+    std::fill(row.begin(), row.end(), 0);
+    for (int x = 0; x < width; x++) {
+      const uint8_t lum = luminance(x, y, width, height);
+      if (bpp == 24) {
+        row[x * 3] = row[x * 3 + 1] = row[x * 3 + 2] = lum;
+      } else {
+        const int index = lum >> (8 - bpp);
+        row[x * bpp / 8] |= index << (8 - bpp - x * bpp % 8);
+      }
+    }
+    out.insert(out.end(), row.begin(), row.end());
+  }
+  return out;
+}
+
+// GfxRenderer::drawBitmap and drawBitmap1Bit before they went to integer scaling
+void referenceDrawBitmap(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode, const Bitmap& bitmap,
+                         const int x, const int y, const int maxWidth, const int maxHeight, const float cropX,
+                         const float cropY) {
+  if (bitmap.is1Bit() && cropX == 0.0f && cropY == 0.0f) {
+    float scale = 1.0f;
+    bool isScaled = false;
+    if (maxWidth > 0 && bitmap.getWidth() > maxWidth) {
+      scale = static_cast<float>(maxWidth) / static_cast<float>(bitmap.getWidth());
+      isScaled = true;
+    }
+    if (maxHeight > 0 && bitmap.getHeight() > maxHeight) {
+      scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>(bitmap.getHeight()));
+      isScaled = true;
+    }
+    std::vector<uint8_t> outputRow((bitmap.getWidth() + 3) / 4);
+    std::vector<uint8_t> rowBytes(bitmap.getRowBytes());
+    for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
+      if (bitmap.readNextRow(outputRow.data(), rowBytes.data()) != BmpReaderError::Ok) return;
+      const int bmpYOffset = bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY;
+      const int screenY = y + (isScaled ? static_cast<int>(std::floor(bmpYOffset * scale)) : bmpYOffset);
+      if (screenY >= renderer.getScreenHeight() || screenY < 0) continue;
+      for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
+        const int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
+        if (screenX >= renderer.getScreenWidth()) break;
+        if (screenX < 0) continue;
+        const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+        if (val < 3) renderer.drawPixel(screenX, screenY, true);
+      }
+    }
+    return;
+  }
+
+  float scale = 1.0f;
+  bool isScaled = false;
+  const int cropPixX = std::floor(bitmap.getWidth() * cropX / 2.0f);
+  const int cropPixY = std::floor(bitmap.getHeight() * cropY / 2.0f);
+  if (maxWidth > 0 && (1.0f - cropX) * bitmap.getWidth() > maxWidth) {
+    scale = static_cast<float>(maxWidth) / static_cast<float>((1.0f - cropX) * bitmap.getWidth());
+    isScaled = true;
+  }
+  if (maxHeight > 0 && (1.0f - cropY) * bitmap.getHeight() > maxHeight) {
+    scale = std::min(scale, static_cast<float>(maxHeight) / static_cast<float>((1.0f - cropY) * bitmap.getHeight()));
+    isScaled = true;
+  }
+  std::vector<uint8_t> outputRow((bitmap.getWidth() + 3) / 4);
+  std::vector<uint8_t> rowBytes(bitmap.getRowBytes());
+  for (int bmpY = 0; bmpY < (bitmap.getHeight() - cropPixY); bmpY++) {
+    int screenY = -cropPixY + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
+    if (isScaled) screenY = std::floor(screenY * scale);
+    screenY += y;
+    if (screenY >= renderer.getScreenHeight()) break;
+    if (bitmap.readNextRow(outputRow.data(), rowBytes.data()) != BmpReaderError::Ok) return;
+    if (screenY < 0 || bmpY < cropPixY) continue;
+    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
+      int screenX = bmpX - cropPixX;
+      if (isScaled) screenX = std::floor(screenX * scale);
+      screenX += x;
+      if (screenX >= renderer.getScreenWidth()) break;
+      if (screenX < 0) continue;
+      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if (renderMode == GfxRenderer::BW && val < 3) {
+        renderer.drawPixel(screenX, screenY);
+      } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (val == 1 || val == 2)) {
+        renderer.drawPixel(screenX, screenY, false);
+      } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && val == 1) {
+        renderer.drawPixel(screenX, screenY, false);
+      }
+    }
+  }
+}
+
+struct Case {
+  std::string name;
+  int width;
+  int height;
+  int bpp;
+  bool topDown;
+  GfxRenderer::RenderMode mode;
+  float crop;
+};
+
+struct Result {
+  double ms = 0;
+  std::vector<uint8_t> frame;
+};
+
+Result run(HalDisplay& display, GfxRenderer& renderer, const Case& c, const std::vector<uint8_t>& bmp,
+           const std::function<void(const Bitmap&)>& draw) {
+  Result result;
+  for (int round = 0; round < ROUNDS; round++) {
+    display.clearScreen(c.mode == GfxRenderer::BW ? 0xFF : 0x00);
+    FsFile file(bmp);
+    Bitmap bitmap(file);
+    const auto start = std::chrono::steady_clock::now();
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      std::cerr << c.name << ": bad BMP" << std::endl;
+      std::exit(1);
+    }
+    draw(bitmap);
+    result.ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  }
+  result.ms /= ROUNDS;
+  const uint8_t* frameBuffer = renderer.getFrameBuffer();
+  result.frame.assign(frameBuffer, frameBuffer + HalDisplay::BUFFER_SIZE);
+  return result;
+}
+
+int differingPixels(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+  int count = 0;
+  for (size_t i = 0; i < a.size(); i++) count += __builtin_popcount(a[i] ^ b[i]);
+  return count;
+}
+}  // namespace
+
+int main() {
+  const std::vector<Case> cases = {
+      {"2-bit cover", 480, 800, 2, true, GfxRenderer::BW, 0},
+      {"2-bit gray MSB", 480, 800, 2, true, GfxRenderer::GRAYSCALE_MSB, 0},
+      {"24-bit", 480, 800, 24, false, GfxRenderer::BW, 0},
+      {"1-bit", 480, 800, 1, false, GfxRenderer::BW, 0},
+      {"24-bit 2x down", 960, 1600, 24, false, GfxRenderer::BW, 0},
+      {"8-bit 0.8x down", 600, 1000, 8, true, GfxRenderer::BW, 0},
+      {"24-bit cropped", 600, 1000, 24, true, GfxRenderer::BW, 0.2f},
+  };
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+
+  std::cout << "Full-screen " << SCREEN_WIDTH << "x" << SCREEN_HEIGHT << " portrait draws, mean of " << ROUNDS
+            << " from memory" << std::endl;
+  std::cout << std::left << std::setw(18) << "bitmap" << std::right << std::setw(12) << "source" << std::setw(14)
+            << "reference ms" << std::setw(10) << "new ms" << std::setw(10) << "speedup" << std::setw(16)
+            << "pixels differ" << std::endl;
+  for (const auto& c : cases) {
+    const auto bmp = makeBmp(c.width, c.height, c.bpp, c.topDown);
+    renderer.setRenderMode(c.mode);
+    const auto reference = run(display, renderer, c, bmp, [&](const Bitmap& bitmap) {
+      referenceDrawBitmap(renderer, c.mode, bitmap, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, c.crop, c.crop);
+    });
+    const auto current = run(display, renderer, c, bmp, [&](const Bitmap& bitmap) {
+      renderer.drawBitmap(bitmap, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, c.crop, c.crop);
+    });
+    const std::string source = std::to_string(c.width) + "x" + std::to_string(c.height);
+    std::cout << std::left << std::setw(18) << c.name << std::right << std::setw(12) << source << std::fixed
+              << std::setprecision(2) << std::setw(14) << reference.ms << std::setw(10) << current.ms
+              << std::setw(9) << reference.ms / current.ms << "x" << std::setw(16)
+              << differingPixels(reference.frame, current.frame) << std::endl;
+  }
+
+  // Unscaled draws must not change at all, whichever way the frame buffer runs under the screen
+  const Case offset = {"offset", 300, 200, 2, true, GfxRenderer::BW, 0};
+  const auto bmp = makeBmp(offset.width, offset.height, offset.bpp, offset.topDown);
+  renderer.setRenderMode(GfxRenderer::BW);
+  for (const auto orientation : {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise, GfxRenderer::PortraitInverted,
+                                 GfxRenderer::LandscapeCounterClockwise}) {
+    renderer.setOrientation(orientation);
+    const auto reference = run(display, renderer, offset, bmp, [&](const Bitmap& bitmap) {
+      referenceDrawBitmap(renderer, offset.mode, bitmap, 13, -7, 0, 0, 0, 0);
+    });
+    const auto current =
+        run(display, renderer, offset, bmp, [&](const Bitmap& bitmap) { renderer.drawBitmap(bitmap, 13, -7, 0, 0); });
+    if (reference.frame != current.frame) {
+      std::cerr << "Orientation " << orientation << ": " << differingPixels(reference.frame, current.frame)
+                << " pixels differ" << std::endl;
+      return 1;
+    }
+  }
+  std::cout << "Unscaled draws match the reference in all four orientations" << std::endl;
+
+  // Chapter images are stored inside the section file, between the page records
+  constexpr uint32_t IMAGE_OFFSET = 1234;
+  const auto image = makeBmp(320, 240, 1, true);
+  // Sized up front and filled in place, rather than grown around the image
+  std::vector<uint8_t> sectionFile(IMAGE_OFFSET + image.size() + 99, 0x5A);
+  std::fill(sectionFile.begin(), sectionFile.begin() + IMAGE_OFFSET, 0xA5);
+  std::copy(image.begin(), image.end(), sectionFile.begin() + IMAGE_OFFSET);
+  renderer.setOrientation(GfxRenderer::Portrait);
+  std::vector<uint8_t> frames[2];
+  for (int embedded = 0; embedded < 2; embedded++) {
+    display.clearScreen(0xFF);
+    FsFile file(embedded ? sectionFile : image);
+    Bitmap bitmap(file, false, embedded ? IMAGE_OFFSET : 0);
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      std::cerr << "Embedded image: bad BMP" << std::endl;
+      return 1;
+    }
+    renderer.drawBitmap(bitmap, 80, 300, bitmap.getWidth(), bitmap.getHeight());
+    frames[embedded].assign(renderer.getFrameBuffer(), renderer.getFrameBuffer() + HalDisplay::BUFFER_SIZE);
+  }
+  if (frames[0] != frames[1]) {
+    std::cerr << "Embedded image: " << differingPixels(frames[0], frames[1]) << " pixels differ" << std::endl;
+    return 1;
+  }
+  std::cout << "Images inside a larger file draw the same as on their own" << std::endl;
+  return 0;
+}
@@ -0,0 +1,281 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures the heap and time GfxRenderer::storeBwBuffer and restoreBwBuffer take around the grayscale pass of a page
+// turn, against the raw chunk copies they used to make, and what a page rendered ahead saves on the turn. Text pages
+// are drawn with the reader font from the words of the English hyphenation test data. The renderer's malloc and free
+// calls are wrapped at link time, so the peak covers only the stored snapshot, with the allocator's own rounding.
+
+extern "C" {
+void* __real_malloc(size_t size);
+void __real_free(void* ptr);
+
+namespace {
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+}  // namespace
+
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  if (ptr) {
+    liveBytes += malloc_usable_size(ptr);
+    peakBytes = std::max(peakBytes, liveBytes);
+  }
+  return ptr;
+}
+
+void __wrap_free(void* ptr) {
+  if (ptr) {
+    liveBytes -= malloc_usable_size(ptr);
+  }
+  __real_free(ptr);
+}
+}
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr int MARGIN = 8;
+constexpr int TEXT_PAGES = 50;
+constexpr int ROUNDS = 20;
+constexpr size_t CHUNK_SIZE = 8000;
+
+std::vector<std::string> loadWords(const std::string& filename) {
+  std::vector<std::string> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word;
+    if (std::getline(iss, word, '|')) {
+      words.push_back(word);
+    }
+  }
+  return words;
+}
+
+// A full page of ragged-right lines, with a status bar line at the bottom like the reader draws
+void drawTextPage(const GfxRenderer& renderer, const std::vector<std::string>& words, size_t* next) {
+  const int lineHeight = renderer.getLineHeight(FONT_ID);
+  const int width = renderer.getScreenWidth() - 2 * MARGIN;
+  const int bottom = renderer.getScreenHeight() - MARGIN - 2 * lineHeight;
+  for (int y = MARGIN; y < bottom; y += lineHeight) {
+    std::string line;
+    while (true) {
+      const std::string candidate = line.empty() ? words[*next] : line + " " + words[*next];
+      if (renderer.getTextWidth(FONT_ID, candidate.c_str()) > width) break;
+      line = candidate;
+      *next = (*next + 1) % words.size();
+    }
+    renderer.drawText(FONT_ID, MARGIN, y, line.c_str());
+  }
+  renderer.drawText(FONT_ID, MARGIN, renderer.getScreenHeight() - MARGIN - lineHeight, "Chapter 3   12 / 348");
+}
+
+// A photo dithered down to 1 bit looks like noise to run-length encoding
+void drawNoisePage(const GfxRenderer& renderer) {
+  uint32_t state = 12345;
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  for (size_t i = 0; i < GfxRenderer::getBufferSize(); i++) {
+    state = state * 1103515245u + 12345u;
+    frameBuffer[i] = static_cast<uint8_t>(state >> 16);
+  }
+}
+
+struct Result {
+  size_t peakBytes = 0;
+  double storeUs = 0;
+  double restoreUs = 0;
+};
+
+// The chunk copies storeBwBuffer and restoreBwBuffer made before encoding
+std::vector<uint8_t*> referenceStore(const uint8_t* frameBuffer) {
+  std::vector<uint8_t*> chunks;
+  for (size_t offset = 0; offset < GfxRenderer::getBufferSize(); offset += CHUNK_SIZE) {
+    chunks.push_back(static_cast<uint8_t*>(__wrap_malloc(CHUNK_SIZE)));
+    memcpy(chunks.back(), frameBuffer + offset, CHUNK_SIZE);
+  }
+  return chunks;
+}
+
+void referenceRestore(uint8_t* frameBuffer, const std::vector<uint8_t*>& chunks) {
+  for (size_t i = 0; i < chunks.size(); i++) {
+    memcpy(frameBuffer + i * CHUNK_SIZE, chunks[i], CHUNK_SIZE);
+    __wrap_free(chunks[i]);
+  }
+}
+
+double elapsedUs(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Stores the frame, scribbles over it like the grayscale pass does, restores it and checks it came back unchanged
+Result measure(GfxRenderer& renderer, const bool reference) {
+  uint8_t* frameBuffer = renderer.getFrameBuffer();
+  const std::vector<uint8_t> frame(frameBuffer, frameBuffer + GfxRenderer::getBufferSize());
+  Result result;
+  for (int round = 0; round < ROUNDS; round++) {
+    memcpy(frameBuffer, frame.data(), frame.size());
+    const size_t baseBytes = liveBytes;
+    peakBytes = liveBytes;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<uint8_t*> chunks;
+    if (reference) {
+      chunks = referenceStore(frameBuffer);
+    } else if (!renderer.storeBwBuffer()) {
+      std::cerr << "storeBwBuffer failed" << std::endl;
+      std::exit(1);
+    }
+    result.storeUs += elapsedUs(start);
+
+    memset(frameBuffer, 0x00, frame.size());
+
+    start = std::chrono::steady_clock::now();
+    if (reference) {
+      referenceRestore(frameBuffer, chunks);
+    } else {
+      renderer.restoreBwBuffer();
+    }
+    result.restoreUs += elapsedUs(start);
+    result.peakBytes = std::max(result.peakBytes, peakBytes - baseBytes);
+
+    if (!std::equal(frame.begin(), frame.end(), frameBuffer)) {
+      std::cerr << "Frame buffer does not round trip" << std::endl;
+      std::exit(1);
+    }
+  }
+  result.storeUs /= ROUNDS;
+  result.restoreUs /= ROUNDS;
+  return result;
+}
+
+// Drawing a text page on the turn, against putting back the same page rendered ahead with captureFrame
+void measurePageTurn(GfxRenderer& renderer, const std::vector<std::string>& words) {
+  double drawUs = 0, frameUs = 0;
+  size_t next = 0;
+  for (int page = 0; page < TEXT_PAGES; page++) {
+    const size_t first = next;
+    renderer.clearScreen();
+    drawTextPage(renderer, words, &next);
+    FrameImage ahead;
+    if (!renderer.captureFrame(ahead)) {
+      std::cerr << "captureFrame failed" << std::endl;
+      std::exit(1);
+    }
+    const uint8_t* frameBuffer = renderer.getFrameBuffer();
+    const std::vector<uint8_t> frame(frameBuffer, frameBuffer + GfxRenderer::getBufferSize());
+
+    for (int round = 0; round < ROUNDS; round++) {
+      auto start = std::chrono::steady_clock::now();
+      renderer.clearScreen();
+      size_t again = first;
+      drawTextPage(renderer, words, &again);
+      drawUs += elapsedUs(start) / (TEXT_PAGES * ROUNDS);
+
+      memset(renderer.getFrameBuffer(), 0x00, frame.size());
+      start = std::chrono::steady_clock::now();
+      renderer.drawFrame(ahead);
+      frameUs += elapsedUs(start) / (TEXT_PAGES * ROUNDS);
+
+      if (!std::equal(frame.begin(), frame.end(), renderer.getFrameBuffer())) {
+        std::cerr << "Rendered ahead frame does not match" << std::endl;
+        std::exit(1);
+      }
+    }
+  }
+  std::cout << std::fixed << std::setprecision(1) << "Page turn: text page drawn in " << drawUs
+            << " us, rendered ahead frame put back in " << frameUs << " us" << std::endl;
+}
+
+void printRow(const std::string& name, const Result& result) {
+  std::cout << std::left << std::setw(20) << name << std::right << std::setw(12) << result.peakBytes << std::fixed
+            << std::setprecision(1) << std::setw(12) << result.storeUs << std::setw(12) << result.restoreUs
+            << std::endl;
+}
+
+void average(Result& total, const Result& page, const int pages) {
+  total.peakBytes = std::max(total.peakBytes, page.peakBytes);
+  total.storeUs += page.storeUs / pages;
+  total.restoreUs += page.restoreUs / pages;
+}
+}  // namespace
+
+int main() {
+  const auto words = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (words.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+
+  const EpdFont regular(&bookerly_14_regular);
+  const EpdFont bold(&bookerly_14_bold);
+  const EpdFont italic(&bookerly_14_italic);
+  const EpdFont boldItalic(&bookerly_14_bolditalic);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+
+  std::cout << "BW buffer snapshots around the grayscale pass, " << GfxRenderer::getBufferSize()
+            << "-byte frame, mean of " << ROUNDS << " rounds" << std::endl;
+  std::cout << std::left << std::setw(20) << "page" << std::right << std::setw(12) << "peak bytes" << std::setw(12)
+            << "store us" << std::setw(12) << "restore us" << std::endl;
+
+  Result rawText, encodedText;
+  size_t next = 0;
+  for (int page = 0; page < TEXT_PAGES; page++) {
+    renderer.clearScreen();
+    drawTextPage(renderer, words, &next);
+    average(rawText, measure(renderer, true), TEXT_PAGES);
+    average(encodedText, measure(renderer, false), TEXT_PAGES);
+  }
+  printRow("text, raw", rawText);
+  printRow("text, encoded", encodedText);
+
+  // Lines run along the panel rows here
+  renderer.setOrientation(GfxRenderer::LandscapeCounterClockwise);
+  Result rawLandscape, encodedLandscape;
+  for (int page = 0; page < TEXT_PAGES; page++) {
+    renderer.clearScreen();
+    drawTextPage(renderer, words, &next);
+    average(rawLandscape, measure(renderer, true), TEXT_PAGES);
+    average(encodedLandscape, measure(renderer, false), TEXT_PAGES);
+  }
+  printRow("landscape, raw", rawLandscape);
+  printRow("landscape, encoded", encodedLandscape);
+  renderer.setOrientation(GfxRenderer::Portrait);
+
+  renderer.clearScreen();
+  renderer.drawCenteredText(FONT_ID, renderer.getScreenHeight() / 3, "Chapter 3");
+  printRow("heading, raw", measure(renderer, true));
+  printRow("heading, encoded", measure(renderer, false));
+
+  drawNoisePage(renderer);
+  printRow("noise, raw", measure(renderer, true));
+  printRow("noise, encoded", measure(renderer, false));
+
+  measurePageTurn(renderer, words);
+  return 0;
+}
@@ -0,0 +1,264 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <malloc.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Lays out a chapter through ParsedText the way ChapterHtmlSlimParser does, one ParsedText per paragraph, measured
+// with the Bookerly 14 reader font. Words are drawn from the word frequencies in the English hyphenation test data.
+// Every fourth paragraph carries soft hyphens at the test data's hyphenation points, as some publishers ship them.
+// A single paragraph of LONG_PARAGRAPH_WORDS words is then fed in as the chapter parser does, laying out each time the
+// layout window fills, to measure the heap it takes.
+
+namespace {
+size_t allocationCount = 0;
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+}  // namespace
+
+void* operator new(const size_t size) {
+  allocationCount++;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    liveBytes += malloc_usable_size(ptr);
+    peakBytes = std::max(peakBytes, liveBytes);
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept {
+  if (ptr) {
+    liveBytes -= malloc_usable_size(ptr);
+  }
+  std::free(ptr);
+}
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+namespace {
+constexpr int PARAGRAPH_COUNT = 60;
+constexpr int LONG_PARAGRAPH_WORDS = 12000;
+constexpr int PAGE_WIDTH = 464;
+constexpr int ROUNDS = 5;
+constexpr char SOFT_HYPHEN[] = "\xC2\xAD";
+
+struct WeightedWord {
+  std::string word;
+  std::string softHyphenated;
+  int frequency;
+};
+
+struct LayoutStats {
+  size_t words = 0;
+  size_t lines = 0;
+  size_t allocations = 0;
+  size_t measureCalls = 0;
+  double measureMicroseconds = 0;
+  double layoutMicroseconds = 0;
+};
+
+std::vector<WeightedWord> loadWords(const std::string& filename) {
+  std::vector<WeightedWord> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word, hyphenated, freqStr;
+    if (std::getline(iss, word, '|') && std::getline(iss, hyphenated, '|') && std::getline(iss, freqStr, '|')) {
+      std::string softHyphenated;
+      for (const char c : hyphenated) {
+        if (c == '=') {
+          softHyphenated += SOFT_HYPHEN;
+        } else {
+          softHyphenated += c;
+        }
+      }
+      words.push_back({word, softHyphenated, std::stoi(freqStr)});
+    }
+  }
+  return words;
+}
+
+// Deterministic frequency-weighted paragraphs of 40 to 200 words, then one of LONG_PARAGRAPH_WORDS words
+std::vector<std::vector<std::string>> buildChapter(const std::vector<WeightedWord>& vocabulary) {
+  std::vector<long> cumulative;
+  long total = 0;
+  for (const auto& entry : vocabulary) {
+    total += entry.frequency;
+    cumulative.push_back(total);
+  }
+
+  uint32_t state = 12345;
+  const auto next = [&state] {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  };
+
+  std::vector<std::vector<std::string>> paragraphs(PARAGRAPH_COUNT + 1);
+  for (size_t p = 0; p < paragraphs.size(); p++) {
+    const int length = p == PARAGRAPH_COUNT ? LONG_PARAGRAPH_WORDS : 40 + static_cast<int>(next() % 160);
+    for (int i = 0; i < length; i++) {
+      const long pick = static_cast<long>(next() % static_cast<uint32_t>(total));
+      const auto& word = vocabulary[std::upper_bound(cumulative.begin(), cumulative.end(), pick) - cumulative.begin()];
+      paragraphs[p].push_back(p % 4 == 3 ? word.softHyphenated : word.word);
+    }
+  }
+  return paragraphs;
+}
+
+BlockStyle justifiedStyle() {
+  BlockStyle blockStyle;
+  blockStyle.alignment = CssTextAlign::Justify;
+  blockStyle.textIndent = 24;
+  blockStyle.textIndentDefined = true;
+  return blockStyle;
+}
+
+// Feeds a paragraph word by word, laying out whenever the window is full, as the chapter parser does
+void streamParagraph(const std::vector<std::string>& paragraph, const GfxRenderer& renderer, const bool hyphenation,
+                     const std::function<void(const TextBlock&)>& processLine) {
+  ParsedText text(false, hyphenation, justifiedStyle());
+  for (const auto& word : paragraph) {
+    text.addWord(word, EpdFontFamily::REGULAR);
+    if (text.isLayoutWindowFull()) {
+      text.layoutAndExtractLines(renderer, 0, PAGE_WIDTH, processLine, false);
+    }
+  }
+  text.layoutAndExtractLines(renderer, 0, PAGE_WIDTH, processLine);
+}
+
+// Lines of a paragraph as text, streamed or laid out in one go
+std::vector<std::string> paragraphLines(const std::vector<std::string>& paragraph, const GfxRenderer& renderer,
+                                        const bool hyphenation, const bool streamed) {
+  std::vector<std::string> lines;
+  const auto collect = [&lines](const TextBlock& line) {
+    std::string text;
+    for (const auto& word : line.getWords()) {
+      text += word + " ";
+    }
+    lines.push_back(std::move(text));
+  };
+  if (streamed) {
+    streamParagraph(paragraph, renderer, hyphenation, collect);
+  } else {
+    ParsedText text(false, hyphenation, justifiedStyle());
+    for (const auto& word : paragraph) {
+      text.addWord(word, EpdFontFamily::REGULAR);
+    }
+    text.layoutAndExtractLines(renderer, 0, PAGE_WIDTH, collect);
+  }
+  return lines;
+}
+
+LayoutStats layoutChapter(const std::vector<std::vector<std::string>>& paragraphs, const GfxRenderer& renderer,
+                          const bool hyphenation) {
+  LayoutStats stats;
+  renderer.counters = {};
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int p = 0; p < PARAGRAPH_COUNT; p++) {
+      const auto& paragraph = paragraphs[p];
+      ParsedText text(false, hyphenation, justifiedStyle());
+      for (const auto& word : paragraph) {
+        text.addWord(word, EpdFontFamily::REGULAR);
+      }
+      stats.words += paragraph.size();
+
+      const size_t allocationsBefore = allocationCount;
+      const auto start = std::chrono::steady_clock::now();
+      text.layoutAndExtractLines(renderer, 0, PAGE_WIDTH, [&stats](const TextBlock&) { stats.lines++; });
+      stats.layoutMicroseconds +=
+          std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+      stats.allocations += allocationCount - allocationsBefore;
+    }
+  }
+  stats.measureCalls = renderer.counters.calls;
+  stats.measureMicroseconds = renderer.counters.microseconds;
+  return stats;
+}
+
+void printLongParagraph(const char* name, const std::vector<std::string>& paragraph, const GfxRenderer& renderer,
+                        const bool hyphenation) {
+  const size_t baseBytes = liveBytes;
+  peakBytes = liveBytes;
+  const auto start = std::chrono::steady_clock::now();
+  size_t lines = 0;
+  streamParagraph(paragraph, renderer, hyphenation, [&lines](const TextBlock&) { lines++; });
+  const double milliseconds =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  std::cout << std::left << std::setw(18) << name << std::right << std::setw(10) << paragraph.size() << std::setw(10)
+            << lines << std::setw(12) << peakBytes - baseBytes << std::fixed << std::setprecision(1) << std::setw(12)
+            << milliseconds << std::endl;
+}
+
+void printStats(const char* name, const LayoutStats& stats) {
+  const double rounds = ROUNDS;
+  std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10)
+            << stats.words / rounds << std::setw(10) << stats.lines / rounds << std::setw(12)
+            << stats.allocations / rounds << std::setw(12) << stats.measureCalls / rounds << std::setw(14)
+            << stats.measureMicroseconds / rounds << std::setw(14) << stats.layoutMicroseconds / rounds << std::endl;
+}
+}  // namespace
+
+int main() {
+  const auto vocabulary = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (vocabulary.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+  const auto paragraphs = buildChapter(vocabulary);
+  Hyphenator::setPreferredLanguage("en");
+
+  const EpdFont regular(&bookerly_14_regular);
+  const EpdFont bold(&bookerly_14_bold);
+  const EpdFont italic(&bookerly_14_italic);
+  const EpdFont boldItalic(&bookerly_14_bolditalic);
+  const EpdFontFamily font(&regular, &bold, &italic, &boldItalic);
+  const GfxRenderer renderer(font);
+
+  std::cout << "Chapter of " << PARAGRAPH_COUNT << " paragraphs at " << PAGE_WIDTH
+            << " px, per layout of the whole chapter" << std::endl;
+  std::cout << std::left << std::setw(18) << "layout" << std::right << std::setw(10) << "words" << std::setw(10)
+            << "lines" << std::setw(12) << "allocs" << std::setw(12) << "measures" << std::setw(14) << "measure us"
+            << std::setw(14) << "layout us" << std::endl;
+  printStats("no hyphenation", layoutChapter(paragraphs, renderer, false));
+  printStats("hyphenation", layoutChapter(paragraphs, renderer, true));
+
+  // Lines committed early must be the ones a layout of the whole paragraph picks
+  const std::vector<std::string> checked(paragraphs[PARAGRAPH_COUNT].begin(),
+                                         paragraphs[PARAGRAPH_COUNT].begin() + 1200);
+  for (const bool hyphenation : {false, true}) {
+      const bool same =
+        paragraphLines(checked, renderer, hyphenation, true) == paragraphLines(checked, renderer, hyphenation, false);
+      if (!same) {
+      std::cerr << "Streamed layout differs from whole paragraph layout"
+                << (hyphenation ? " with hyphenation" : " without hyphenation") << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << std::endl << "Single paragraph, laid out as it is read" << std::endl;
+  std::cout << std::left << std::setw(18) << "layout" << std::right << std::setw(10) << "words" << std::setw(10)
+            << "lines" << std::setw(12) << "peak bytes" << std::setw(12) << "ms" << std::endl;
+  printLongParagraph("no hyphenation", paragraphs[PARAGRAPH_COUNT], renderer, false);
+  printLongParagraph("hyphenation", paragraphs[PARAGRAPH_COUNT], renderer, true);
+  return 0;
+}
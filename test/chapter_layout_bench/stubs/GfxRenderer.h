@@ -0,0 +1,47 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <chrono>
+#include <cstddef>
+
+// Only the text measurement ParsedText does, against a real font. Every call is counted and timed.
+class GfxRenderer {
+ public:
+  struct Counters {
+    size_t calls = 0;
+    double microseconds = 0;
+  };
+
+  explicit GfxRenderer(const EpdFontFamily& font) : font(font) {}
+
+  mutable Counters counters;
+
+  int getSpaceWidth(int) const { return font.getGlyph(' ', EpdFontFamily::REGULAR)->advanceX; }
+
+  int getTextWidth(int, const char* text, const EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    const auto start = std::chrono::steady_clock::now();
+    int w = 0, h = 0;
+    font.getTextDimensions(text, &w, &h, style);
+    count(start);
+    return w;
+  }
+
+  int getTextWidth(int, const char* begin, const char* end, const EpdFontFamily::Style style,
+                   const CodepointFilter skip = nullptr, const uint32_t trailingCodepoint = 0) const {
+    const auto start = std::chrono::steady_clock::now();
+    int w = 0, h = 0;
+    font.getTextDimensions(begin, end, &w, &h, style, skip, trailingCodepoint);
+    count(start);
+    return w;
+  }
+
+ private:
+  const EpdFontFamily& font;
+
+  void count(const std::chrono::steady_clock::time_point start) const {
+    counters.calls++;
+    counters.microseconds +=
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+};
@@ -0,0 +1,168 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <RefreshPolicy.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// How much of the panel common screen updates change, and which of them GfxRenderer::displayBuffer() skips because
+// the panel already shows the frame. For each update the window of changed tiles is what a windowed transfer would
+// have to send, against the whole buffer sent today.
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr int MARGIN = 8;
+constexpr int MENU_ITEMS = 12;
+constexpr int MENU_ITEM_HEIGHT = 45;
+
+using Draw = std::function<void(const GfxRenderer&)>;
+
+std::vector<std::string> loadWords(const std::string& filename) {
+  std::vector<std::string> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word;
+    if (std::getline(iss, word, '|')) {
+      words.push_back(word);
+    }
+  }
+  return words;
+}
+
+// A full page of ragged-right lines starting at word `first`, with a status bar line at the bottom like the reader
+void drawTextPage(const GfxRenderer& renderer, const std::vector<std::string>& words, size_t first,
+                  const char* status) {
+  const int lineHeight = renderer.getLineHeight(FONT_ID);
+  const int width = renderer.getScreenWidth() - 2 * MARGIN;
+  const int bottom = renderer.getScreenHeight() - MARGIN - 2 * lineHeight;
+  for (int y = MARGIN; y < bottom; y += lineHeight) {
+    std::string line;
+    while (true) {
+      const std::string candidate = line.empty() ? words[first] : line + " " + words[first];
+      if (renderer.getTextWidth(FONT_ID, candidate.c_str()) > width) break;
+      line = candidate;
+      first = (first + 1) % words.size();
+    }
+    renderer.drawText(FONT_ID, MARGIN, y, line.c_str());
+  }
+  renderer.drawText(FONT_ID, MARGIN, renderer.getScreenHeight() - MARGIN - lineHeight, status);
+}
+
+// A settings style list with the selected item drawn inverted
+void drawMenu(const GfxRenderer& renderer, const int selected) {
+  renderer.drawCenteredText(FONT_ID, MARGIN, "Settings", true, EpdFontFamily::BOLD);
+  for (int i = 0; i < MENU_ITEMS; i++) {
+    const int y = 60 + i * MENU_ITEM_HEIGHT;
+    if (i == selected) {
+      renderer.fillRect(0, y - 4, renderer.getScreenWidth(), MENU_ITEM_HEIGHT);
+    }
+    const std::string label = "Menu item " + std::to_string(i + 1);
+    renderer.drawText(FONT_ID, 20, y, label.c_str(), i != selected);
+  }
+}
+
+void drawPopup(const GfxRenderer& renderer) {
+  const int width = 260, height = 80;
+  const int x = (renderer.getScreenWidth() - width) / 2, y = (renderer.getScreenHeight() - height) / 2;
+  renderer.fillRect(x, y, width, height, false);
+  renderer.drawRect(x, y, width, height, 2, true);
+  renderer.drawCenteredText(FONT_ID, y + 25, "Indexing...");
+}
+
+void drawFrame(const GfxRenderer& renderer, const Draw& draw) {
+  renderer.clearScreen();
+  draw(renderer);
+}
+
+// Pushes `before`, then times the push of `after` and reports the window it changed
+void measure(GfxRenderer& renderer, HalDisplay& display, const std::string& name, const Draw& before,
+             const Draw& after) {
+  RefreshPolicy policy;
+  drawFrame(renderer, before);
+  renderer.displayBuffer();
+  policy.diff(renderer.getFrameBuffer());
+
+  drawFrame(renderer, after);
+  const int pushesBefore = display.pushes;
+  const auto start = std::chrono::steady_clock::now();
+  renderer.displayBuffer();
+  const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  const bool pushed = display.pushes != pushesBefore;
+
+  policy.diff(renderer.getFrameBuffer());
+  int xBytes = 0, y = 0, widthBytes = 0, height = 0;
+  const bool changed = policy.getChangedWindow(&xBytes, &y, &widthBytes, &height);
+  std::ostringstream window;
+  if (changed) {
+    window << xBytes * 8 << "-" << (xBytes + widthBytes) * 8 - 1 << " x " << y << "-" << y + height - 1;
+  } else {
+    window << "none";
+  }
+
+  std::cout << std::left << std::setw(30) << name << std::setw(8) << (pushed ? "pushed" : "skipped") << std::setw(20)
+            << window.str() << std::right << std::setw(8) << (pushed ? GfxRenderer::getBufferSize() : 0)
+            << std::setw(10) << widthBytes * height << std::fixed << std::setprecision(1) << std::setw(10) << us
+            << std::endl;
+}
+}  // namespace
+
+int main() {
+  const auto words = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (words.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+
+  const EpdFont regular(&bookerly_14_regular);
+  const EpdFont bold(&bookerly_14_bold);
+  const EpdFont italic(&bookerly_14_italic);
+  const EpdFont boldItalic(&bookerly_14_bolditalic);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+
+  std::cout << "Changed window per update, panel x by rows, " << GfxRenderer::getBufferSize() << "-byte frame"
+            << std::endl;
+  std::cout << std::left << std::setw(30) << "update" << std::setw(8) << "push" << std::setw(20) << "window"
+            << std::right << std::setw(8) << "sent" << std::setw(10) << "window B" << std::setw(10) << "push us"
+            << std::endl;
+
+  const auto page = [&](const size_t first, const char* status) {
+    return [&words, first, status](const GfxRenderer& r) { drawTextPage(r, words, first, status); };
+  };
+  const auto menu = [](const int selected) { return [selected](const GfxRenderer& r) { drawMenu(r, selected); }; };
+  const auto pageWithPopup = [&](const GfxRenderer& r) {
+    drawTextPage(r, words, 0, "12 / 348  87%");
+    drawPopup(r);
+  };
+
+  for (const auto orientation : {GfxRenderer::Portrait, GfxRenderer::LandscapeCounterClockwise}) {
+    renderer.setOrientation(orientation);
+    const std::string suffix = orientation == GfxRenderer::Portrait ? ", portrait" : ", landscape";
+    measure(renderer, display, "page turn" + suffix, page(0, "12 / 348  87%"), page(400, "13 / 348  87%"));
+    measure(renderer, display, "status bar" + suffix, page(0, "12 / 348  87%"), page(0, "12 / 348  86%"));
+    measure(renderer, display, "popup" + suffix, page(0, "12 / 348  87%"), pageWithPopup);
+    measure(renderer, display, "menu cursor" + suffix, menu(3), menu(4));
+    measure(renderer, display, "redraw unchanged" + suffix, menu(4), menu(4));
+  }
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "src/fontIds.h"
+
+// Per-call cost of GfxRenderer's font-id calls with the firmware's fifteen fonts registered. Every id gets the same
+// Bookerly family, so only the lookup differs between ids. Calls either keep to one font, like laying out a chapter,
+// or cycle through three, like a screen mixing reader, UI and small fonts.
+
+namespace {
+constexpr int CALLS = 1000000;
+constexpr int TRIALS = 5;
+constexpr int FONT_IDS[] = {BOOKERLY_12_FONT_ID,     BOOKERLY_14_FONT_ID,     BOOKERLY_16_FONT_ID,
+                            BOOKERLY_18_FONT_ID,     NOTOSANS_12_FONT_ID,     NOTOSANS_14_FONT_ID,
+                            NOTOSANS_16_FONT_ID,     NOTOSANS_18_FONT_ID,     OPENDYSLEXIC_8_FONT_ID,
+                            OPENDYSLEXIC_10_FONT_ID, OPENDYSLEXIC_12_FONT_ID, OPENDYSLEXIC_14_FONT_ID,
+                            UI_10_FONT_ID,           UI_12_FONT_ID,           SMALL_FONT_ID};
+constexpr int MIXED_IDS[] = {NOTOSANS_16_FONT_ID, UI_10_FONT_ID, SMALL_FONT_ID};
+
+int sink = 0;
+
+// Best of a few trials, the host's timing noise is as large as the lookups
+double nsPerCall(const std::function<int(int)>& call, const bool mixed) {
+  double best = 0;
+  for (int trial = 0; trial < TRIALS; trial++) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < CALLS; i++) {
+      sink += call(mixed ? MIXED_IDS[i % 3] : NOTOSANS_16_FONT_ID);
+    }
+    const double ns =
+        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / CALLS;
+    best = trial == 0 ? ns : std::min(best, ns);
+  }
+  return best;
+}
+}  // namespace
+
+int main() {
+  const EpdFont regular(&bookerly_14_regular);
+  const EpdFont bold(&bookerly_14_bold);
+  const EpdFont italic(&bookerly_14_italic);
+  const EpdFont boldItalic(&bookerly_14_bolditalic);
+  const EpdFontFamily family(&regular, &bold, &italic, &boldItalic);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+  for (const int fontId : FONT_IDS) {
+    renderer.insertFont(fontId, family);
+  }
+
+  const std::pair<std::string, std::function<int(int)>> calls[] = {
+      {"getLineHeight", [&](const int fontId) { return renderer.getLineHeight(fontId); }},
+      {"getSpaceWidth", [&](const int fontId) { return renderer.getSpaceWidth(fontId); }},
+      {"getTextWidth \"the\"", [&](const int fontId) { return renderer.getTextWidth(fontId, "the"); }},
+      {"drawText \".\"",
+       [&](const int fontId) {
+         renderer.drawText(fontId, 20, 20, ".");
+         return 0;
+       }},
+  };
+
+  std::cout << "ns per call, best mean of " << TRIALS << " x " << CALLS << " calls, " << std::size(FONT_IDS) << " fonts registered"
+            << std::endl;
+  std::cout << std::left << std::setw(22) << "call" << std::right << std::setw(12) << "one font" << std::setw(12)
+            << "3 fonts" << std::endl;
+  for (const auto& [name, call] : calls) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << nsPerCall(call, false) << std::setw(12) << nsPerCall(call, true) << std::endl;
+  }
+  return sink == 42 ? 1 : 0;
+}
@@ -2,18 +2,45 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iostream>
+#include <new>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/HyphenationPack.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
 
+// Heap traffic seen by the whole process, sampled around benchmark runs
+namespace {
+size_t gAllocationCount = 0;
+size_t gAllocatedBytes = 0;
+}  // namespace
+
+void* operator new(const size_t size) {
+  gAllocationCount++;
+  gAllocatedBytes += size;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+// Kept out of line, GCC flags free() on memory it has seen come from operator new once these get inlined
+__attribute__((noinline)) void operator delete(void* ptr) noexcept { std::free(ptr); }
+__attribute__((noinline)) void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
 struct TestCase {
   std::string word;
   std::string hyphenated;
@@ -302,7 +329,244 @@ void printResults(const std::string& language, const std::vector<TestCase>& test
   }
 }
 
+// Synthetic chapters: word streams drawn from the test data by source frequency
+std::vector<std::vector<std::string>> buildBenchmarkChapters(const std::vector<TestCase>& testCases) {
+  constexpr int kChapterCount = 5;
+  constexpr int kChapterWords = 6000;
+
+  std::vector<long> cumulative;
+  long total = 0;
+  for (const auto& testCase : testCases) {
+    total += testCase.frequency;
+    cumulative.push_back(total);
+  }
+
+  uint32_t state = 12345;
+  std::vector<std::vector<std::string>> chapters(kChapterCount);
+  for (auto& chapter : chapters) {
+    chapter.reserve(kChapterWords);
+    for (int i = 0; i < kChapterWords; i++) {
+      state = state * 1664525u + 1013904223u;
+      const long pick = static_cast<long>(state % static_cast<uint32_t>(total));
+      const auto it = std::upper_bound(cumulative.begin(), cumulative.end(), pick);
+      chapter.push_back(testCases[it - cumulative.begin()].word);
+    }
+  }
+  return chapters;
+}
+
+bool sameBreaks(const std::vector<Hyphenator::BreakInfo>& a, const std::vector<Hyphenator::BreakInfo>& b) {
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y) {
+    return x.byteOffset == y.byteOffset && x.requiresInsertedHyphen == y.requiresInsertedHyphen;
+  });
+}
+
+// Best of a few runs, host timings are noisy at this scale
+double bestSeconds(const std::function<void()>& run) {
+  constexpr int kRuns = 3;
+  double best = 0;
+  for (int i = 0; i < kRuns; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    best = i == 0 ? seconds : std::min(best, seconds);
+  }
+  return best;
+}
+
+// Throughput and heap traffic of Hyphenator::breakOffsets() over whole chapters
+void runBenchmark(const std::vector<LanguageConfig>& languages) {
+  std::cout << std::left << std::setw(10) << "language" << std::right << std::setw(14) << "w/s" << std::setw(13)
+            << "allocs/word" << std::setw(13) << "bytes/word" << std::endl;
+
+  for (const auto& lang : languages) {
+    const auto testCases = loadTestData(lang.testDataFile);
+    if (testCases.empty()) {
+      continue;
+    }
+    const auto chapters = buildBenchmarkChapters(testCases);
+    Hyphenator::setPreferredLanguage(lang.primaryTag);
+
+    size_t wordCount = 0;
+    for (const auto& chapter : chapters) {
+      wordCount += chapter.size();
+    }
+    // Reuses one result buffer across words, like ParsedText
+    std::vector<Hyphenator::BreakInfo> breaks;
+    const auto pass = [&] {
+      for (const auto& chapter : chapters) {
+        for (const auto& word : chapter) {
+          Hyphenator::breakOffsets(word, false, breaks);
+        }
+      }
+    };
+    // Warm-up pass builds the pattern automaton and sizes the buffer, then count what a steady-state pass allocates
+    pass();
+    const size_t allocationsBefore = gAllocationCount;
+    const size_t bytesBefore = gAllocatedBytes;
+    pass();
+    const double allocationsPerWord = static_cast<double>(gAllocationCount - allocationsBefore) / wordCount;
+    const double bytesPerWord = static_cast<double>(gAllocatedBytes - bytesBefore) / wordCount;
+    const double seconds = bestSeconds(pass);
+
+    std::cout << std::left << std::setw(10) << lang.cliName << std::right << std::fixed << std::setprecision(0)
+              << std::setw(14) << wordCount / seconds << std::setprecision(2) << std::setw(13) << allocationsPerWord
+              << std::setprecision(1) << std::setw(13) << bytesPerWord << std::endl;
+  }
+}
+
+// Pattern pack built from a language's embedded trie, as scripts/generate_hyphenation_trie.py --pack writes it
+std::vector<uint8_t> buildPack(const LanguageConfig& lang, const LanguageHyphenator& hyphenator) {
+  const auto& patterns = hyphenator.patterns();
+  const bool cyrillic = std::string(lang.primaryTag) == "ru";
+  std::vector<uint8_t> pack(HyphenationPack::MAGIC, HyphenationPack::MAGIC + sizeof(HyphenationPack::MAGIC));
+  pack.push_back(HyphenationPack::VERSION);
+  pack.push_back(static_cast<uint8_t>(cyrillic ? HyphenationPack::Script::CYRILLIC : HyphenationPack::Script::LATIN));
+  pack.push_back(static_cast<uint8_t>(hyphenator.minPrefix()));
+  pack.push_back(static_cast<uint8_t>(hyphenator.minSuffix()));
+  for (int shift = 0; shift < 32; shift += 8) {
+    pack.push_back(static_cast<uint8_t>(patterns.size >> shift));
+  }
+  pack.resize(HyphenationPack::DATA_OFFSET, 0);
+  pack.insert(pack.end(), patterns.data, patterns.data + patterns.size);
+  return pack;
+}
+
+// Pack served to Hyphenator through its opener hook, standing in for the SD card
+const std::vector<uint8_t>* gOpenerPack = nullptr;
+
+bool openTestPack(const std::string& primaryTag, HyphenationPack& pack) {
+  if (primaryTag != "zz" || !gOpenerPack) {
+    return false;
+  }
+  const auto* bytes = gOpenerPack;
+  return pack.open([bytes](const uint32_t offset, uint8_t* buffer, const size_t length) {
+    if (offset + length > bytes->size()) {
+      return false;
+    }
+    memcpy(buffer, bytes->data() + offset, length);
+    return true;
+  });
+}
+
+// Per-word lookup cost of the built-in tries in flash against the same tries paged in from a pattern pack, for a few
+// memory budgets. On the device every page miss is a 512 byte SD read.
+int runPackBenchmark(const std::vector<LanguageConfig>& languages) {
+  const std::vector<size_t> budgets = {8 * 1024, 16 * 1024, HyphenationPack::DEFAULT_MEMORY_BUDGET};
+  int mismatches = 0;
+
+  std::cout << std::endl
+            << std::left << std::setw(10) << "language" << std::right << std::setw(12) << "trie bytes" << std::setw(12)
+            << "flash w/s";
+  for (const size_t budget : budgets) {
+    std::cout << std::setw(6) << budget / 1024 << " KB w/s" << std::setw(14) << "misses/kword";
+  }
+  std::cout << std::endl;
+
+  for (const auto& lang : languages) {
+    const auto* hyphenator = getLanguageHyphenatorForPrimaryTag(lang.primaryTag);
+    const auto testCases = loadTestData(lang.testDataFile);
+    if (!hyphenator || testCases.empty()) {
+      continue;
+    }
+
+    // Codepoints are collected up front, only the trie walk is timed
+    std::vector<std::vector<CodepointInfo>> words;
+    for (const auto& chapter : buildBenchmarkChapters(testCases)) {
+      for (const auto& word : chapter) {
+        auto cps = collectCodepoints(word);
+        trimSurroundingPunctuationAndFootnote(cps);
+        words.push_back(std::move(cps));
+      }
+    }
+    const double wordCount = static_cast<double>(words.size());
+    uint8_t indexes[MAX_HYPHENATION_WORD_BYTES];
+
+    std::vector<std::vector<size_t>> reference;
+    reference.reserve(words.size());
+    for (const auto& cps : words) {
+      reference.push_back(hyphenator->breakIndexes(cps));
+    }
+    const double flashSeconds = bestSeconds([&] {
+      for (const auto& cps : words) {
+        hyphenator->breakIndexes(cps.data(), cps.size(), indexes);
+      }
+    });
+
+    const auto packBytes = buildPack(lang, *hyphenator);
+    std::cout << std::left << std::setw(10) << lang.cliName << std::right << std::setw(12)
+              << hyphenator->patterns().size << std::fixed << std::setprecision(0) << std::setw(12)
+              << wordCount / flashSeconds;
+
+    for (const size_t budget : budgets) {
+      HyphenationPack pack;
+      const bool opened = pack.open(
+          [&packBytes](const uint32_t offset, uint8_t* buffer, const size_t length) {
+            memcpy(buffer, packBytes.data() + offset, length);
+            return true;
+          },
+          budget);
+      if (!opened) {
+        std::cerr << "Could not open pack for " << lang.cliName << std::endl;
+        return 1;
+      }
+      const LanguageHyphenator packHyphenator(pack, lang.primaryTag == std::string("ru") ? isCyrillicLetter
+                                                                                          : isLatinLetter,
+                                              lang.primaryTag == std::string("ru") ? toLowerCyrillic : toLowerLatin,
+                                              hyphenator->minPrefix(), hyphenator->minSuffix());
+      for (size_t w = 0; w < words.size(); w++) {
+        if (packHyphenator.breakIndexes(words[w]) != reference[w]) {
+          mismatches++;
+        }
+      }
+      const uint32_t missesBefore = pack.stats().pageMisses;
+      const auto packPass = [&] {
+        for (const auto& cps : words) {
+          packHyphenator.breakIndexes(cps.data(), cps.size(), indexes);
+        }
+      };
+      packPass();
+      const double missesPerKiloword = (pack.stats().pageMisses - missesBefore) * 1000.0 / wordCount;
+      std::cout << std::setw(13) << wordCount / bestSeconds(packPass) << std::setprecision(1) << std::setw(14)
+                << missesPerKiloword << std::setprecision(0);
+    }
+    std::cout << std::endl;
+
+    // End to end through Hyphenator, with the pack standing in for a language that isn't built in
+    gOpenerPack = &packBytes;
+    Hyphenator::setPackOpener(openTestPack);
+    for (const auto& chapter : buildBenchmarkChapters(testCases)) {
+      for (const auto& word : chapter) {
+        Hyphenator::setPreferredLanguage(lang.primaryTag);
+        const auto builtIn = Hyphenator::breakOffsets(word, false);
+        Hyphenator::setPreferredLanguage("zz-ZZ");
+        if (!sameBreaks(Hyphenator::breakOffsets(word, false), builtIn)) {
+          mismatches++;
+        }
+      }
+    }
+    Hyphenator::setPackOpener(nullptr);
+    gOpenerPack = nullptr;
+  }
+
+  if (mismatches > 0) {
+    std::cerr << mismatches << " pattern pack results differ from the built-in tries" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
 int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    const auto languages = resolveLanguages(argc > 2 ? argv[2] : "all");
+    if (languages.empty()) {
+      std::cerr << "Unknown language: " << argv[2] << std::endl;
+      return 1;
+    }
+    runBenchmark(languages);
+    return runPackBenchmark(languages);
+  }
+
   const bool summaryMode = argc <= 1;
   const std::string languageSelection = summaryMode ? "all" : argv[1];
 
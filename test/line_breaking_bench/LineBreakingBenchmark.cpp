@@ -0,0 +1,242 @@
+#include <Utf8.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/LineBreaker.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Compares the line breakers ParsedText can use on paragraphs of the size ChapterHtmlSlimParser flushes (750 words),
+// built from the word frequencies in the English hyphenation test data. Widths come from a simple proportional font
+// model, close enough to a 14pt reader font for comparing layouts.
+
+namespace {
+constexpr int PARAGRAPH_WORDS = 750;
+constexpr int PARAGRAPH_COUNT = 40;
+constexpr int SPACE_WIDTH = 6;
+constexpr int HYPHEN_WIDTH = 6;
+// Same penalties as ParsedText::computeTotalFitLineBreaks
+constexpr int HYPHEN_PENALTY = 4 * 4 * SPACE_WIDTH * SPACE_WIDTH;
+constexpr int CONSECUTIVE_HYPHEN_PENALTY = 8 * 8 * SPACE_WIDTH * SPACE_WIDTH;
+// Portrait and landscape viewports with default margins, plus a narrow column to stress hyphenation
+const std::vector<int> kPageWidths = {280, 464, 784};
+
+struct WeightedWord {
+  std::string word;
+  int frequency;
+};
+
+struct Paragraph {
+  std::vector<std::string> words;
+  std::vector<LineBreaker::Word> breakerWords;
+  std::vector<LineBreaker::HyphenPoint> points;
+};
+
+struct LayoutStats {
+  double microseconds = 0;
+  long lines = 0;
+  long hyphenatedLines = 0;
+  long consecutiveHyphens = 0;
+  long overflowingLines = 0;
+  long long squaredSlack = 0;
+  long long slack = 0;
+};
+
+int charWidth(const uint32_t cp) {
+  switch (cp) {
+    case 'i':
+    case 'j':
+    case 'l':
+    case '.':
+    case ',':
+    case ';':
+    case ':':
+    case '\'':
+    case '!':
+      return 4;
+    case 'f':
+    case 't':
+    case 'r':
+      return 6;
+    case 'm':
+    case 'w':
+      return 14;
+    case 'M':
+    case 'W':
+      return 16;
+    default:
+      return cp >= 'A' && cp <= 'Z' ? 12 : 9;
+  }
+}
+
+int textWidth(const std::string& text) {
+  int width = 0;
+  const auto* ptr = reinterpret_cast<const unsigned char*>(text.c_str());
+  while (*ptr != 0) {
+    width += charWidth(utf8NextCodepoint(&ptr));
+  }
+  return width;
+}
+
+std::vector<WeightedWord> loadWords(const std::string& filename) {
+  std::vector<WeightedWord> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word, hyphenated, freqStr;
+    if (std::getline(iss, word, '|') && std::getline(iss, hyphenated, '|') && std::getline(iss, freqStr, '|')) {
+      words.push_back({word, std::stoi(freqStr)});
+    }
+  }
+  return words;
+}
+
+// Deterministic frequency-weighted word stream
+std::vector<Paragraph> buildParagraphs(const std::vector<WeightedWord>& vocabulary) {
+  std::vector<long> cumulative;
+  long total = 0;
+  for (const auto& entry : vocabulary) {
+    total += entry.frequency;
+    cumulative.push_back(total);
+  }
+
+  uint32_t state = 12345;
+  std::vector<Paragraph> paragraphs(PARAGRAPH_COUNT);
+  for (auto& paragraph : paragraphs) {
+    for (int i = 0; i < PARAGRAPH_WORDS; i++) {
+      state = state * 1664525u + 1013904223u;
+      const long pick = static_cast<long>(state % static_cast<uint32_t>(total));
+      const auto it = std::upper_bound(cumulative.begin(), cumulative.end(), pick);
+      paragraph.words.push_back(vocabulary[it - cumulative.begin()].word);
+    }
+  }
+  return paragraphs;
+}
+
+void collectPoints(Paragraph& paragraph, const bool withHyphenation) {
+  paragraph.breakerWords.clear();
+  paragraph.points.clear();
+  for (const auto& word : paragraph.words) {
+    LineBreaker::Word breakerWord = {static_cast<uint16_t>(textWidth(word)), false,
+                                     static_cast<uint16_t>(paragraph.points.size()), 0};
+    if (withHyphenation) {
+      for (const auto& info : Hyphenator::breakOffsets(word, false)) {
+        if (info.byteOffset == 0 || info.byteOffset >= word.size()) {
+          continue;
+        }
+        const int prefixWidth =
+            textWidth(word.substr(0, info.byteOffset)) + (info.requiresInsertedHyphen ? HYPHEN_WIDTH : 0);
+        paragraph.points.push_back({static_cast<uint16_t>(prefixWidth),
+                                    static_cast<uint16_t>(textWidth(word.substr(info.byteOffset))),
+                                    static_cast<uint8_t>(info.byteOffset), info.requiresInsertedHyphen});
+        breakerWord.pointCount++;
+      }
+    }
+    paragraph.breakerWords.push_back(breakerWord);
+  }
+}
+
+void accumulate(const Paragraph& paragraph, const std::vector<LineBreaker::Break>& breaks, const int pageWidth,
+                LayoutStats& stats) {
+  size_t word = 0;
+  uint16_t startPoint = LineBreaker::NO_POINT;
+  bool previousHyphenated = false;
+  for (size_t line = 0; line < breaks.size(); line++) {
+    const auto& lineBreak = breaks[line];
+    int width = startPoint != LineBreaker::NO_POINT ? paragraph.points[startPoint].suffixWidth
+                                                    : paragraph.breakerWords[word].width;
+    for (size_t j = word + 1; j < lineBreak.wordIndex; j++) {
+      width += SPACE_WIDTH + paragraph.breakerWords[j].width;
+    }
+    const bool hyphenated = lineBreak.pointIndex != LineBreaker::NO_POINT;
+    if (hyphenated) {
+      width += SPACE_WIDTH + paragraph.points[lineBreak.pointIndex].prefixWidth;
+      stats.hyphenatedLines++;
+      if (previousHyphenated) {
+        stats.consecutiveHyphens++;
+      }
+    }
+    previousHyphenated = hyphenated;
+
+    stats.lines++;
+    if (width > pageWidth) {
+      stats.overflowingLines++;
+    } else if (line + 1 < breaks.size()) {
+      const long long slack = pageWidth - width;
+      stats.slack += slack;
+      stats.squaredSlack += slack * slack;
+    }
+    word = lineBreak.wordIndex;
+    startPoint = lineBreak.pointIndex;
+  }
+}
+
+template <typename BreakFn>
+LayoutStats runLayout(std::vector<Paragraph>& paragraphs, const int pageWidth, const bool withHyphenation,
+                      const BreakFn& breakFn) {
+  const LineBreaker::Params params = {pageWidth, 0, SPACE_WIDTH, HYPHEN_PENALTY, CONSECUTIVE_HYPHEN_PENALTY};
+  LayoutStats stats;
+  for (auto& paragraph : paragraphs) {
+    collectPoints(paragraph, withHyphenation);
+    const auto start = std::chrono::steady_clock::now();
+    const auto breaks = breakFn(paragraph.breakerWords, paragraph.points, params);
+    stats.microseconds += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    accumulate(paragraph, breaks, pageWidth, stats);
+  }
+  return stats;
+}
+
+void printStats(const char* name, const LayoutStats& stats) {
+  const long innerLines = stats.lines - PARAGRAPH_COUNT;
+  std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1) << std::setw(10)
+            << stats.microseconds / PARAGRAPH_COUNT << std::setw(8) << stats.lines << std::setw(9)
+            << (stats.hyphenatedLines * 100.0 / stats.lines) << "%" << std::setw(8) << stats.consecutiveHyphens
+            << std::setw(10) << static_cast<double>(stats.slack) / innerLines << std::setw(12)
+            << static_cast<double>(stats.squaredSlack) / innerLines << std::setw(10) << stats.overflowingLines
+            << std::endl;
+}
+}  // namespace
+
+int main() {
+  const auto vocabulary = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (vocabulary.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+  Hyphenator::setPreferredLanguage("en");
+  auto paragraphs = buildParagraphs(vocabulary);
+
+  // Hyphenation point lookup and measurement, paid by the total-fit path for every word
+  double collectMicroseconds = 0;
+  for (auto& paragraph : paragraphs) {
+    const auto start = std::chrono::steady_clock::now();
+    collectPoints(paragraph, true);
+    collectMicroseconds += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+  std::cout << PARAGRAPH_COUNT << " paragraphs x " << PARAGRAPH_WORDS << " words, hyphen point collection "
+            << std::fixed << std::setprecision(1) << collectMicroseconds / PARAGRAPH_COUNT << " us/paragraph"
+            << std::endl;
+
+  for (const int pageWidth : kPageWidths) {
+    std::cout << std::endl << "Page width " << pageWidth << " px" << std::endl;
+    std::cout << std::left << std::setw(28) << "breaker" << std::right << std::setw(10) << "us/para" << std::setw(8)
+              << "lines" << std::setw(10) << "hyph" << std::setw(8) << "stack" << std::setw(10) << "slack"
+              << std::setw(12) << "slack^2" << std::setw(10) << "overflow" << std::endl;
+    printStats("dp, no hyphenation", runLayout(paragraphs, pageWidth, false, LineBreaker::totalFit));
+    printStats("greedy + hyphenation", runLayout(paragraphs, pageWidth, true, LineBreaker::greedy));
+    printStats("total fit + hyphenation", runLayout(paragraphs, pageWidth, true, LineBreaker::totalFit));
+  }
+
+  return 0;
+}
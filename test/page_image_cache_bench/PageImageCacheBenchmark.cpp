@@ -0,0 +1,182 @@
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <PageImageCache.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Replays a reading session through PageImageCache the way the EPUB reader uses it: a turn puts back the cached image
+// of the page if there is one and draws the page otherwise, then the page shown and the one after it are cached.
+// Reports hit rates for forward and backward turns, the time a turn spends getting the page into the frame buffer, and
+// the bytes the cache holds. Text pages are drawn with the reader font from the words of the English hyphenation test
+// data.
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr int MARGIN = 8;
+constexpr int PAGES = 60;
+constexpr int TURNS = 2000;
+// One turn in this many goes back, then one to three pages
+constexpr int BACK_EVERY = 6;
+
+std::vector<std::string> loadWords(const std::string& filename) {
+  std::vector<std::string> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word;
+    if (std::getline(iss, word, '|')) {
+      words.push_back(word);
+    }
+  }
+  return words;
+}
+
+// Full pages of ragged-right lines, returning the first word of each so a page can be drawn again on its own
+std::vector<size_t> paginate(const GfxRenderer& renderer, const std::vector<std::string>& words) {
+  std::vector<size_t> firstWords;
+  const int lineHeight = renderer.getLineHeight(FONT_ID);
+  const int width = renderer.getScreenWidth() - 2 * MARGIN;
+  const int bottom = renderer.getScreenHeight() - MARGIN - 2 * lineHeight;
+  size_t next = 0;
+  for (int page = 0; page < PAGES; page++) {
+    firstWords.push_back(next);
+    for (int y = MARGIN; y < bottom; y += lineHeight) {
+      std::string line;
+      while (true) {
+        const std::string candidate = line.empty() ? words[next] : line + " " + words[next];
+        if (renderer.getTextWidth(FONT_ID, candidate.c_str()) > width) break;
+        line = candidate;
+        next = (next + 1) % words.size();
+      }
+    }
+  }
+  return firstWords;
+}
+
+void drawPage(const GfxRenderer& renderer, const std::vector<std::string>& words, size_t next) {
+  renderer.clearScreen();
+  const int lineHeight = renderer.getLineHeight(FONT_ID);
+  const int width = renderer.getScreenWidth() - 2 * MARGIN;
+  const int bottom = renderer.getScreenHeight() - MARGIN - 2 * lineHeight;
+  for (int y = MARGIN; y < bottom; y += lineHeight) {
+    std::string line;
+    while (true) {
+      const std::string candidate = line.empty() ? words[next] : line + " " + words[next];
+      if (renderer.getTextWidth(FONT_ID, candidate.c_str()) > width) break;
+      line = candidate;
+      next = (next + 1) % words.size();
+    }
+    renderer.drawText(FONT_ID, MARGIN, y, line.c_str());
+  }
+}
+
+struct Turns {
+  int count = 0;
+  int hits = 0;
+  double hitUs = 0;
+  double missUs = 0;
+};
+
+void printRow(const std::string& name, const Turns& turns) {
+  const int misses = turns.count - turns.hits;
+  std::cout << std::left << std::setw(12) << name << std::right << std::setw(8) << turns.count << std::fixed
+            << std::setprecision(1) << std::setw(10) << 100.0 * turns.hits / std::max(turns.count, 1) << "%"
+            << std::setw(12) << (turns.hits ? turns.hitUs / turns.hits : 0) << std::setw(12)
+            << (misses ? turns.missUs / misses : 0) << std::endl;
+}
+}  // namespace
+
+int main() {
+  const auto words = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (words.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+
+  const EpdFont regular(&bookerly_14_regular);
+  const EpdFont bold(&bookerly_14_bold);
+  const EpdFont italic(&bookerly_14_italic);
+  const EpdFont boldItalic(&bookerly_14_bolditalic);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regular, &bold, &italic, &boldItalic));
+  const auto firstWords = paginate(renderer, words);
+
+  PageImageCache cache;
+  Turns forward, backward;
+  size_t peakBytes = 0;
+  uint32_t state = 12345;
+  int page = 0, backLeft = 0;
+  std::vector<uint8_t> expected(GfxRenderer::getBufferSize());
+  for (int turn = 0; turn < TURNS; turn++) {
+    state = state * 1103515245u + 12345u;
+    if (backLeft == 0 && (state >> 16) % BACK_EVERY == 0) {
+      backLeft = 1 + (state >> 20) % 3;
+    }
+    const bool back = backLeft > 0 && page > 0;
+    if (backLeft > 0) backLeft--;
+    page = back ? page - 1 : (page + 1) % PAGES;
+
+    const auto start = std::chrono::steady_clock::now();
+    const FrameImage* image = cache.find(page);
+    const bool hit = image && renderer.drawFrame(*image);
+    if (!hit) {
+      drawPage(renderer, words, firstWords[page]);
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    Turns& turns = back ? backward : forward;
+    turns.count++;
+    (hit ? turns.hitUs : turns.missUs) += us;
+    turns.hits += hit;
+
+    if (hit) {
+      std::copy(renderer.getFrameBuffer(), renderer.getFrameBuffer() + expected.size(), expected.begin());
+      drawPage(renderer, words, firstWords[page]);
+      if (!std::equal(expected.begin(), expected.end(), renderer.getFrameBuffer())) {
+        std::cerr << "Cached image of page " << page << " does not match the page" << std::endl;
+        return 1;
+      }
+    }
+
+    // What the reader does once the page is on screen
+    if (!cache.contains(page)) {
+      drawPage(renderer, words, firstWords[page]);
+      cache.store(renderer, page);
+    }
+    const int next = (page + 1) % PAGES;
+    if (!cache.contains(next)) {
+      drawPage(renderer, words, firstWords[next]);
+      cache.store(renderer, next);
+    }
+    peakBytes = std::max(peakBytes, cache.size());
+  }
+
+  std::cout << "Page image cache, " << PageImageCache::SLOTS << " slots, " << PageImageCache::BUDGET_BYTES
+            << "-byte budget, " << TURNS << " turns, one in " << BACK_EVERY << " going back 1-3 pages" << std::endl;
+  std::cout << std::left << std::setw(12) << "turns" << std::right << std::setw(8) << "count" << std::setw(11)
+            << "hit rate" << std::setw(12) << "hit us" << std::setw(12) << "miss us" << std::endl;
+  printRow("forward", forward);
+  printRow("backward", backward);
+  std::cout << "Peak held: " << peakBytes << " bytes" << std::endl;
+  return 0;
+}
@@ -0,0 +1,381 @@
+#include <BitmapWriter.h>
+#include <HalStorage.h>
+#include <PngToBmpConverter.h>
+#include <malloc.h>
+#include <miniz.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Measures how long PngToBmpConverter takes on large PNG covers and how much heap it needs, for each PNG color type
+// and each kind of BMP the reader makes from one. The covers are drawn and encoded here, cycling through every filter
+// type, and each BMP is checked against the same pixels handed to BitmapWriter directly. malloc and free are wrapped
+// at link time and operator new goes through them, so the peak covers every buffer, with the allocator's own rounding.
+
+extern "C" {
+void* __real_malloc(size_t size);
+void __real_free(void* ptr);
+
+namespace {
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+}  // namespace
+
+void* __wrap_malloc(const size_t size) {
+  void* ptr = __real_malloc(size);
+  if (ptr) {
+    liveBytes += malloc_usable_size(ptr);
+    peakBytes = std::max(peakBytes, liveBytes);
+  }
+  return ptr;
+}
+
+void __wrap_free(void* ptr) {
+  if (ptr) {
+    liveBytes -= malloc_usable_size(ptr);
+  }
+  __real_free(ptr);
+}
+}
+
+void* operator new(const size_t size) {
+  if (void* ptr = __wrap_malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void* operator new[](const size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { __wrap_free(ptr); }
+void operator delete[](void* ptr) noexcept { __wrap_free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { __wrap_free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { __wrap_free(ptr); }
+
+namespace {
+constexpr int COVER_WIDTH = 1600;
+constexpr int COVER_HEIGHT = 2400;
+constexpr int ROUNDS = 3;
+// What common encoders write per IDAT chunk
+constexpr size_t IDAT_CHUNK_SIZE = 8192;
+
+enum ColorType : uint8_t { GRAY = 0, RGB = 2, PALETTE = 3, GRAY_ALPHA = 4, RGB_ALPHA = 6 };
+
+struct Rgba {
+  uint8_t r, g, b, a;
+};
+
+struct Format {
+  const char* name;
+  uint8_t colorType;
+  uint8_t bitDepth;
+};
+
+struct Encoded {
+  std::vector<uint8_t> png;
+  // What the page shows for each pixel, row by row
+  std::vector<uint8_t> gray;
+};
+
+uint8_t toGray(const int r, const int g, const int b) { return (r * 25 + g * 50 + b * 25) / 100; }
+uint8_t onWhite(const int gray, const int alpha) { return (gray * alpha + 255 * (255 - alpha)) / 255; }
+
+// Something like a cover: a sky gradient, a sun, title bars and grainy ground, with a fading edge for the alpha
+Rgba coverPixel(const int x, const int y, const int width, const int height) {
+  Rgba pixel{static_cast<uint8_t>(40 + 180 * y / height), static_cast<uint8_t>(90 + 100 * x / width),
+             static_cast<uint8_t>(200 - 120 * y / height), 255};
+  const int dx = x - width / 2;
+  const int dy = y - height / 3;
+  if (dx * dx + dy * dy < (width / 4) * (width / 4)) {
+    pixel = {250, 210, 60, 255};
+  }
+  if (y > height / 12 && y < height / 12 + height / 20 && x > width / 10 && x < width * 9 / 10 && (x / 24) % 3 != 2) {
+    pixel = {20, 20, 30, 255};
+  }
+  if (y > height * 2 / 3) {
+    const uint32_t hash = (static_cast<uint32_t>(x) * 2654435761u) ^ (static_cast<uint32_t>(y) * 40503u);
+    const int grain = static_cast<int>(hash >> 28) * 6;
+    pixel = {static_cast<uint8_t>(60 + grain), static_cast<uint8_t>(110 + grain), static_cast<uint8_t>(40 + grain),
+             255};
+  }
+  if (x < width / 8) {
+    pixel.a = static_cast<uint8_t>(255 * x / (width / 8));
+  }
+  return pixel;
+}
+
+void appendBE32(std::vector<uint8_t>& out, const uint32_t value) {
+  out.push_back(value >> 24);
+  out.push_back(value >> 16);
+  out.push_back(value >> 8);
+  out.push_back(value);
+}
+
+void appendChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, const size_t size) {
+  appendBE32(png, size);
+  const size_t start = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data, data + size);
+  appendBE32(png, mz_crc32(MZ_CRC32_INIT, png.data() + start, size + 4));
+}
+
+uint8_t paeth(const int a, const int b, const int c) {
+  const int p = a + b - c;
+  const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+  return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+// Raw samples of one row in the given format, and the gray the page should show for each pixel
+void encodeRow(const Format& format, const int y, const int width, const int height, std::vector<uint8_t>& row,
+               uint8_t* gray) {
+  const int depth = format.bitDepth;
+  std::fill(row.begin(), row.end(), 0);
+  for (int x = 0; x < width; x++) {
+    const Rgba pixel = coverPixel(x, y, width, height);
+    const uint8_t luma = toGray(pixel.r, pixel.g, pixel.b);
+    switch (format.colorType) {
+      case GRAY:
+        if (depth < 8) {
+          const int levels = (1 << depth) - 1;
+          const int sample = (luma * levels + 127) / 255;
+          row[x * depth / 8] |= sample << (8 - depth - x * depth % 8);
+          gray[x] = sample * 255 / levels;
+        } else if (depth == 8) {
+          row[x] = luma;
+          gray[x] = luma;
+        } else {
+          row[2 * x] = luma;
+          row[2 * x + 1] = static_cast<uint8_t>(x);
+          gray[x] = luma;
+        }
+        break;
+      case PALETTE: {
+        // 6x6x6 color cube, index 0 see-through
+        const int index = (pixel.r * 5 / 255) * 36 + (pixel.g * 5 / 255) * 6 + pixel.b * 5 / 255;
+        row[x] = static_cast<uint8_t>(index);
+        gray[x] = index == 0 ? 255 : toGray(index / 36 * 51, index / 6 % 6 * 51, index % 6 * 51);
+        break;
+      }
+      case RGB:
+        if (depth == 8) {
+          row[3 * x] = pixel.r;
+          row[3 * x + 1] = pixel.g;
+          row[3 * x + 2] = pixel.b;
+        } else {
+          for (int c = 0; c < 3; c++) {
+            row[6 * x + 2 * c] = (&pixel.r)[c];
+            row[6 * x + 2 * c + 1] = static_cast<uint8_t>(y);
+          }
+        }
+        gray[x] = luma;
+        break;
+      case GRAY_ALPHA:
+        row[2 * x] = luma;
+        row[2 * x + 1] = pixel.a;
+        gray[x] = onWhite(luma, pixel.a);
+        break;
+      case RGB_ALPHA:
+        row[4 * x] = pixel.r;
+        row[4 * x + 1] = pixel.g;
+        row[4 * x + 2] = pixel.b;
+        row[4 * x + 3] = pixel.a;
+        gray[x] = onWhite(luma, pixel.a);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+Encoded encode(const Format& format, const int width, const int height, const bool interlaced = false) {
+  const int channels = format.colorType == RGB         ? 3
+                       : format.colorType == RGB_ALPHA  ? 4
+                       : format.colorType == GRAY_ALPHA ? 2
+                                                        : 1;
+  const int bitsPerPixel = channels * format.bitDepth;
+  const size_t rowBytes = (static_cast<size_t>(width) * bitsPerPixel + 7) / 8;
+  const size_t stride = std::max(1, bitsPerPixel / 8);
+
+  Encoded encoded;
+  encoded.gray.resize(static_cast<size_t>(width) * height);
+  std::vector<uint8_t> filtered;
+  filtered.reserve((rowBytes + 1) * height);
+  std::vector<uint8_t> row(rowBytes), above(rowBytes, 0);
+  for (int y = 0; y < height; y++) {
+    encodeRow(format, y, width, height, row, encoded.gray.data() + static_cast<size_t>(y) * width);
+    const uint8_t filter = y % 5;
+    filtered.push_back(filter);
+    for (size_t i = 0; i < rowBytes; i++) {
+      const int left = i >= stride ? row[i - stride] : 0;
+      const int upLeft = i >= stride ? above[i - stride] : 0;
+      const int predictor = filter == 1   ? left
+                            : filter == 2 ? above[i]
+                            : filter == 3 ? (left + above[i]) / 2
+                            : filter == 4 ? paeth(left, above[i], upLeft)
+                                          : 0;
+      filtered.push_back(static_cast<uint8_t>(row[i] - predictor));
+    }
+    above = row;
+  }
+
+  size_t compressedSize = 0;
+  auto* compressed = static_cast<uint8_t*>(tdefl_compress_mem_to_heap(
+      filtered.data(), filtered.size(), &compressedSize, tdefl_create_comp_flags_from_zip_params(6, 15, 0)));
+
+  auto& png = encoded.png;
+  const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  png.assign(signature, signature + sizeof(signature));
+  std::vector<uint8_t> header;
+  appendBE32(header, width);
+  appendBE32(header, height);
+  header.insert(header.end(), {format.bitDepth, format.colorType, 0, 0, static_cast<uint8_t>(interlaced)});
+  appendChunk(png, "IHDR", header.data(), header.size());
+  if (format.colorType == PALETTE) {
+    std::vector<uint8_t> palette;
+    for (int index = 0; index < 216; index++) {
+      palette.insert(palette.end(), {static_cast<uint8_t>(index / 36 * 51), static_cast<uint8_t>(index / 6 % 6 * 51),
+                                     static_cast<uint8_t>(index % 6 * 51)});
+    }
+    appendChunk(png, "PLTE", palette.data(), palette.size());
+    const uint8_t alpha = 0;
+    appendChunk(png, "tRNS", &alpha, 1);
+  }
+  const char text[] = "Software\0bench";
+  appendChunk(png, "tEXt", reinterpret_cast<const uint8_t*>(text), sizeof(text) - 1);
+  for (size_t offset = 0; offset < compressedSize; offset += IDAT_CHUNK_SIZE) {
+    appendChunk(png, "IDAT", compressed + offset, std::min(IDAT_CHUNK_SIZE, compressedSize - offset));
+  }
+  appendChunk(png, "IEND", nullptr, 0);
+  mz_free(compressed);
+  return encoded;
+}
+
+struct Mode {
+  const char* name;
+  int width;
+  int height;
+  bool oneBit;
+  bool crop;
+};
+
+// Cover for the sleep screen, the home screen thumbnail and an image laid out in a chapter
+constexpr Mode MODES[] = {
+    {"cover", 480, 800, false, true},
+    {"thumb", 240, 400, true, true},
+    {"inline", 464, 700, true, false},
+};
+
+bool convert(const Mode& mode, const std::vector<uint8_t>& png, Print& out) {
+  FsFile file(png);
+  if (mode.oneBit && !mode.crop) {
+    int width, height;
+    return PngToBmpConverter::pngFileTo1BitBmpStreamToFit(file, out, mode.width, mode.height, &width, &height);
+  }
+  if (mode.oneBit) {
+    return PngToBmpConverter::pngFileTo1BitBmpStreamWithSize(file, out, mode.width, mode.height);
+  }
+  return PngToBmpConverter::pngFileToBmpStreamWithSize(file, out, mode.width, mode.height);
+}
+
+std::vector<uint8_t> reference(const Mode& mode, const Encoded& encoded, const int width, const int height) {
+  Print out;
+  BitmapWriter writer(out, width, height, mode.width, mode.height, mode.oneBit, mode.crop);
+  writer.begin();
+  for (int y = 0; y < height; y++) {
+    writer.writeRow(encoded.gray.data() + static_cast<size_t>(y) * width);
+  }
+  return out.bytes;
+}
+
+struct Result {
+  double ms = 0;
+  size_t peakBytes = 0;
+};
+
+Result measure(const Mode& mode, const Encoded& encoded, const int width, const int height, const char* name) {
+  const std::vector<uint8_t> expected = reference(mode, encoded, width, height);
+  Result result;
+  for (int round = 0; round < ROUNDS; round++) {
+    Print out;
+    out.bytes.reserve(expected.size());
+    const size_t baseBytes = liveBytes;
+    peakBytes = liveBytes;
+    const auto start = std::chrono::steady_clock::now();
+    if (!convert(mode, encoded.png, out)) {
+      std::cerr << name << ", " << mode.name << ": conversion failed" << std::endl;
+      std::exit(1);
+    }
+    result.ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / ROUNDS;
+    result.peakBytes = std::max(result.peakBytes, peakBytes - baseBytes);
+    if (out.bytes != expected) {
+      std::cerr << name << ", " << mode.name << ": BMP differs from the reference" << std::endl;
+      std::exit(1);
+    }
+  }
+  return result;
+}
+
+void expectRejected(const char* what, const std::vector<uint8_t>& png) {
+  Print out;
+  if (convert(MODES[0], png, out)) {
+    std::cerr << what << " should have been rejected" << std::endl;
+    std::exit(1);
+  }
+}
+}  // namespace
+
+int main() {
+  const Format formats[] = {
+      {"RGB 8-bit", RGB, 8},           {"RGBA 8-bit", RGB_ALPHA, 8}, {"RGB 16-bit", RGB, 16},
+      {"palette 8-bit", PALETTE, 8},   {"gray 8-bit", GRAY, 8},      {"gray+alpha 8-bit", GRAY_ALPHA, 8},
+      {"gray 16-bit", GRAY, 16},       {"gray 4-bit", GRAY, 4},      {"gray 2-bit", GRAY, 2},
+      {"gray 1-bit", GRAY, 1},
+  };
+
+  std::cout << COVER_WIDTH << "x" << COVER_HEIGHT << " PNG covers to BMP, mean of " << ROUNDS << " rounds"
+            << std::endl;
+  std::cout << std::left << std::setw(18) << "format" << std::right << std::setw(10) << "PNG KB";
+  for (const auto& mode : MODES) {
+    std::cout << std::setw(10) << (std::string(mode.name) + " ms");
+  }
+  std::cout << std::setw(12) << "peak bytes" << std::endl;
+
+  for (const auto& format : formats) {
+    const Encoded encoded = encode(format, COVER_WIDTH, COVER_HEIGHT);
+    std::cout << std::left << std::setw(18) << format.name << std::right << std::setw(10)
+              << encoded.png.size() / 1024;
+    size_t peak = 0;
+    for (const auto& mode : MODES) {
+      const Result result = measure(mode, encoded, COVER_WIDTH, COVER_HEIGHT, format.name);
+      std::cout << std::fixed << std::setprecision(1) << std::setw(10) << result.ms;
+      peak = std::max(peak, result.peakBytes);
+    }
+    std::cout << std::setw(12) << peak << std::endl;
+  }
+
+  // Widest image accepted, where the scanlines are largest
+  const Format widest{"RGBA 8-bit", RGB_ALPHA, 8};
+  const Encoded large = encode(widest, 2048, 3072);
+  const Result result = measure(MODES[0], large, 2048, 3072, "2048x3072 RGBA");
+  std::cout << "2048x3072 RGBA 8-bit cover: " << std::fixed << std::setprecision(1) << result.ms << " ms, "
+            << result.peakBytes << " bytes peak, against " << 2048 * 3072 * 4 << " for the decoded image"
+            << std::endl;
+
+  // Images that aren't laid out top to bottom, and ones cut short, fail cleanly
+  expectRejected("Interlaced image", encode(widest, 64, 64, true).png);
+  std::vector<uint8_t> truncated = encode(widest, 64, 64).png;
+  truncated.resize(truncated.size() / 2);
+  expectRejected("Truncated image", truncated);
+  std::vector<uint8_t> notPng = encode(widest, 64, 64).png;
+  notPng[1] = 'Q';
+  expectRejected("Bad signature", notPng);
+  std::cout << "All BMPs match the reference; interlaced, truncated and non-PNG files are rejected" << std::endl;
+  return 0;
+}
@@ -0,0 +1,94 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Builds and runs one of the host benchmarks built on the stubs in test/bench_stubs, which stand in for the panel, the
+# SD card, Arduino's Print, logging and the render timings. Arguments after the name go to the benchmark.
+#
+#   test/run_bench.sh bitmap_draw|bw_buffer|dirty_window|font_lookup|page_image_cache|png_decode [args...]
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+if [[ $# -lt 1 ]]; then
+  echo "Usage: $0 <bench> [args...]" >&2
+  exit 2
+fi
+BENCH="$1"
+shift
+
+case "$BENCH" in
+  bitmap_draw) BINARY_NAME="BitmapDrawBenchmark" ;;
+  bw_buffer) BINARY_NAME="BwBufferBenchmark" ;;
+  dirty_window) BINARY_NAME="DirtyWindowBenchmark" ;;
+  font_lookup) BINARY_NAME="FontLookupBenchmark" ;;
+  page_image_cache) BINARY_NAME="PageImageCacheBenchmark" ;;
+  png_decode) BINARY_NAME="PngDecodeBenchmark" ;;
+  *)
+    echo "Unknown bench: $BENCH" >&2
+    exit 2
+    ;;
+esac
+
+BUILD_DIR="$ROOT_DIR/build/${BENCH}_bench"
+BINARY="$BUILD_DIR/$BINARY_NAME"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=("$ROOT_DIR/test/${BENCH}_bench/$BINARY_NAME.cpp")
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -Wno-unused-parameter
+  -I"$ROOT_DIR/test/bench_stubs"
+)
+LDFLAGS=()
+
+if [[ "$BENCH" == "png_decode" ]]; then
+  SOURCES+=(
+    "$ROOT_DIR/lib/PngToBmpConverter/PngToBmpConverter.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/BitmapWriter.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+    "$BUILD_DIR/miniz.o"
+  )
+  CXXFLAGS+=(
+    -DMINIZ_NO_ZLIB_COMPATIBLE_NAMES=1
+    -I"$ROOT_DIR/lib/GfxRenderer"
+    -I"$ROOT_DIR/lib/PngToBmpConverter"
+    -I"$ROOT_DIR/lib/miniz"
+  )
+  # miniz is C, built on its own, and the bench only needs it in memory
+  cc -O2 -DMINIZ_NO_ZLIB_COMPATIBLE_NAMES=1 -DMINIZ_NO_STDIO -c "$ROOT_DIR/lib/miniz/miniz.c" -o "$BUILD_DIR/miniz.o"
+else
+  # The renderer and BMP reader are the real ones
+  SOURCES+=(
+    "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/FrameImage.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/PageImageCache.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/PackBits.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+    "$ROOT_DIR/lib/GfxRenderer/RefreshPolicy.cpp"
+    "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+    "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+    "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  )
+  CXXFLAGS+=(
+    -I"$ROOT_DIR"
+    -I"$ROOT_DIR/lib"
+    -I"$ROOT_DIR/lib/GfxRenderer"
+    -I"$ROOT_DIR/lib/EpdFont"
+    -I"$ROOT_DIR/lib/Utf8"
+  )
+fi
+
+# Wrapping malloc and free lets these benchmarks count heap use
+if [[ "$BENCH" == "bw_buffer" || "$BENCH" == "png_decode" ]]; then
+  LDFLAGS+=(-Wl,--wrap=malloc -Wl,--wrap=free)
+fi
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${LDFLAGS[@]}" -o "$BINARY"
+
+cd "$ROOT_DIR"
+"$BINARY" "$@"
@@ -13,6 +13,7 @@ SOURCES=(
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationPack.cpp"
   "$ROOT_DIR/lib/Utf8/Utf8.cpp"
 )
 
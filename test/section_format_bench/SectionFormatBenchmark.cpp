@@ -0,0 +1,461 @@
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Serialization.h>
+#include <Utf8.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/Page.h"
+#include "lib/Epub/Epub/SectionAnchors.h"
+
+// Compares the section file page encoding against the version 12 one it replaced, on pages laid out from the word
+// frequencies in the English hyphenation test data. The test data has no short function words, so it understates
+// how often words repeat within a page compared to real prose. Version 12 pages are loaded into the shared_ptr
+// PageLine/TextBlock objects pages used to be made of, version 13 pages into one reused flat Page. Then looks up
+// every id of an anchor table as large as a chapter with an id on each paragraph.
+
+FsFile::Counters FsFile::counters;
+
+namespace {
+size_t allocationCount = 0;
+}  // namespace
+
+void* operator new(const size_t size) {
+  allocationCount++;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+constexpr int PAGE_COUNT = 300;
+constexpr int PAGE_WIDTH = 464;
+constexpr int LINE_HEIGHT = 28;
+constexpr int LINES_PER_PAGE = 26;
+constexpr int SPACE_WIDTH = 6;
+constexpr int TEXT_INDENT = 24;
+constexpr int LOAD_ROUNDS = 20;
+constexpr int RENDER_ROUNDS = 100;
+constexpr int ANCHOR_COUNT = 5000;
+
+struct WeightedWord {
+  std::string word;
+  int frequency;
+};
+
+struct Line {
+  int16_t x;
+  int16_t y;
+  std::list<std::string> words;
+  std::list<uint16_t> wordXpos;
+  std::list<EpdFontFamily::Style> wordStyles;
+  BlockStyle blockStyle;
+};
+
+using BenchPage = std::vector<Line>;
+
+struct FormatStats {
+  size_t fileBytes = 0;
+  size_t reads = 0;
+  size_t bytesRead = 0;
+  size_t allocations = 0;
+  double microseconds = 0;
+  double renderMicroseconds = 0;
+};
+
+// A page as it was held in memory before pages became flat: a heap object per line and per TextBlock, each word its
+// own std::string in a std::list
+struct LegacyPageLine {
+  int16_t xPos;
+  int16_t yPos;
+  std::shared_ptr<TextBlock> block;
+
+  void render(const GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+    auto xIt = block->getWordXpos().begin();
+    auto styleIt = block->getWordStyles().begin();
+    for (const auto& w : block->getWords()) {
+      renderer.drawText(fontId, *xIt++ + xPos + xOffset, yPos + yOffset, w.c_str(), true, *styleIt++);
+    }
+  }
+};
+
+using LegacyPage = std::vector<std::shared_ptr<LegacyPageLine>>;
+
+int charWidth(const uint32_t cp) {
+  switch (cp) {
+    case 'i':
+    case 'j':
+    case 'l':
+    case '.':
+    case ',':
+    case '\'':
+      return 4;
+    case 'f':
+    case 't':
+    case 'r':
+      return 6;
+    case 'm':
+    case 'w':
+      return 14;
+    default:
+      return cp >= 'A' && cp <= 'Z' ? 12 : 9;
+  }
+}
+
+int textWidth(const std::string& text) {
+  int width = 0;
+  const auto* ptr = reinterpret_cast<const unsigned char*>(text.c_str());
+  while (*ptr != 0) {
+    width += charWidth(utf8NextCodepoint(&ptr));
+  }
+  return width;
+}
+
+std::vector<WeightedWord> loadWords(const std::string& filename) {
+  std::vector<WeightedWord> words;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string word, hyphenated, freqStr;
+    if (std::getline(iss, word, '|') && std::getline(iss, hyphenated, '|') && std::getline(iss, freqStr, '|')) {
+      words.push_back({word, std::stoi(freqStr)});
+    }
+  }
+  return words;
+}
+
+// Deterministic frequency-weighted text, set as justified paragraphs with indented first lines and the odd
+// italic phrase
+std::vector<BenchPage> buildPages(const std::vector<WeightedWord>& vocabulary) {
+  std::vector<long> cumulative;
+  long total = 0;
+  for (const auto& entry : vocabulary) {
+    total += entry.frequency;
+    cumulative.push_back(total);
+  }
+
+  uint32_t state = 12345;
+  const auto next = [&state] {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  };
+
+  BlockStyle blockStyle;
+  blockStyle.textIndent = TEXT_INDENT;
+  blockStyle.textIndentDefined = true;
+  blockStyle.marginBottom = 8;
+
+  std::vector<BenchPage> pages(PAGE_COUNT);
+  int paragraphWordsLeft = 0;
+  int italicWordsLeft = 0;
+  for (auto& page : pages) {
+    for (int lineIndex = 0; lineIndex < LINES_PER_PAGE; lineIndex++) {
+      const bool firstLine = paragraphWordsLeft == 0;
+      if (firstLine) {
+        paragraphWordsLeft = 40 + static_cast<int>(next() % 160);
+      }
+      Line line{0, static_cast<int16_t>(lineIndex * LINE_HEIGHT), {}, {}, {}, blockStyle};
+      std::vector<int> widths;
+      int x = firstLine ? TEXT_INDENT : 0;
+      while (paragraphWordsLeft > 0) {
+        const long pick = static_cast<long>(next() % static_cast<uint32_t>(total));
+        const auto& word = vocabulary[std::upper_bound(cumulative.begin(), cumulative.end(), pick) - cumulative.begin()];
+        const int width = textWidth(word.word);
+        if (!widths.empty() && x + width > PAGE_WIDTH) {
+          break;
+        }
+        if (italicWordsLeft == 0 && next() % 60 == 0) {
+          italicWordsLeft = 1 + static_cast<int>(next() % 5);
+        }
+        line.words.push_back(word.word);
+        line.wordStyles.push_back(italicWordsLeft > 0 ? EpdFontFamily::ITALIC : EpdFontFamily::REGULAR);
+        italicWordsLeft = std::max(0, italicWordsLeft - 1);
+        widths.push_back(width);
+        x += width + SPACE_WIDTH;
+        paragraphWordsLeft--;
+      }
+
+      // Justify all but the paragraph's last line
+      const int gaps = static_cast<int>(widths.size()) - 1;
+      const int slack = paragraphWordsLeft > 0 && gaps > 0 ? PAGE_WIDTH - (x - SPACE_WIDTH) : 0;
+      int wordX = firstLine ? TEXT_INDENT : 0;
+      for (size_t i = 0; i < widths.size(); i++) {
+        line.wordXpos.push_back(static_cast<uint16_t>(wordX));
+        wordX += widths[i] + SPACE_WIDTH + (gaps > 0 && static_cast<int>(i) < gaps ? slack / gaps : 0);
+      }
+      page.push_back(std::move(line));
+    }
+  }
+  return pages;
+}
+
+// Version 12 page encoding, field by field through Serialization.h
+void writeV12Page(FsFile& file, const BenchPage& page) {
+  serialization::writePod(file, static_cast<uint16_t>(page.size()));
+  for (const auto& line : page) {
+    serialization::writePod(file, static_cast<uint8_t>(TAG_PageLine));
+    serialization::writePod(file, line.x);
+    serialization::writePod(file, line.y);
+    serialization::writePod(file, static_cast<uint16_t>(line.words.size()));
+    for (const auto& w : line.words) serialization::writeString(file, w);
+    for (auto x : line.wordXpos) serialization::writePod(file, x);
+    for (auto s : line.wordStyles) serialization::writePod(file, s);
+    const BlockStyle& style = line.blockStyle;
+    serialization::writePod(file, style.alignment);
+    serialization::writePod(file, style.textAlignDefined);
+    serialization::writePod(file, style.marginTop);
+    serialization::writePod(file, style.marginBottom);
+    serialization::writePod(file, style.marginLeft);
+    serialization::writePod(file, style.marginRight);
+    serialization::writePod(file, style.paddingTop);
+    serialization::writePod(file, style.paddingBottom);
+    serialization::writePod(file, style.paddingLeft);
+    serialization::writePod(file, style.paddingRight);
+    serialization::writePod(file, style.textIndent);
+    serialization::writePod(file, style.textIndentDefined);
+  }
+}
+
+std::unique_ptr<LegacyPage> readV12Page(FsFile& file) {
+  auto page = std::unique_ptr<LegacyPage>(new LegacyPage());
+  uint16_t count;
+  serialization::readPod(file, count);
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t tag;
+    int16_t xPos, yPos;
+    uint16_t wc;
+    serialization::readPod(file, tag);
+    serialization::readPod(file, xPos);
+    serialization::readPod(file, yPos);
+    serialization::readPod(file, wc);
+    std::list<std::string> words(wc);
+    std::list<uint16_t> wordXpos(wc);
+    std::list<EpdFontFamily::Style> wordStyles(wc);
+    BlockStyle style;
+    for (auto& w : words) serialization::readString(file, w);
+    for (auto& x : wordXpos) serialization::readPod(file, x);
+    for (auto& s : wordStyles) serialization::readPod(file, s);
+    serialization::readPod(file, style.alignment);
+    serialization::readPod(file, style.textAlignDefined);
+    serialization::readPod(file, style.marginTop);
+    serialization::readPod(file, style.marginBottom);
+    serialization::readPod(file, style.marginLeft);
+    serialization::readPod(file, style.marginRight);
+    serialization::readPod(file, style.paddingTop);
+    serialization::readPod(file, style.paddingBottom);
+    serialization::readPod(file, style.paddingLeft);
+    serialization::readPod(file, style.paddingRight);
+    serialization::readPod(file, style.textIndent);
+    serialization::readPod(file, style.textIndentDefined);
+    auto tb = std::unique_ptr<TextBlock>(
+        new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), style));
+    page->push_back(std::unique_ptr<LegacyPageLine>(new LegacyPageLine{xPos, yPos, std::move(tb)}));
+  }
+  return page;
+}
+
+void renderV12Page(const GfxRenderer& renderer, const LegacyPage& page) {
+  for (const auto& line : page) {
+    line->render(renderer, 0, 0, 0);
+  }
+}
+
+Page toPage(const BenchPage& benchPage) {
+  Page page;
+  for (const auto& line : benchPage) {
+    page.addLine(TextBlock(line.words, line.wordXpos, line.wordStyles, line.blockStyle), line.x, line.y);
+  }
+  return page;
+}
+
+std::vector<uint8_t> encode(const Page& page) {
+  FsFile file;
+  page.serialize(file);
+  std::vector<uint8_t> bytes(file.size());
+  file.seek(0);
+  file.read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+// Loads every page LOAD_ROUNDS times, then renders every page RENDER_ROUNDS times. load() returns whether the page
+// loaded, render() draws the page last loaded.
+template <typename Loader, typename Renderer>
+FormatStats measure(const FsFile& file, const std::vector<uint32_t>& lut, Loader load, Renderer render) {
+  FormatStats stats;
+  stats.fileBytes = file.size();
+  FsFile::counters = {};
+  const size_t allocationsBefore = allocationCount;
+  const auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < LOAD_ROUNDS; round++) {
+    for (const uint32_t position : lut) {
+      FsFile pageFile = file.reopen();
+      pageFile.seek(position);
+      if (!load(pageFile)) {
+        std::cerr << "Page at " << position << " failed to load" << std::endl;
+        stats.fileBytes = 0;
+        return stats;
+      }
+    }
+  }
+  stats.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  stats.allocations = allocationCount - allocationsBefore;
+  stats.reads = FsFile::counters.reads;
+  stats.bytesRead = FsFile::counters.bytesRead;
+
+  const auto renderStart = std::chrono::steady_clock::now();
+  for (int round = 0; round < RENDER_ROUNDS; round++) {
+    render();
+  }
+  stats.renderMicroseconds =
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - renderStart).count();
+  return stats;
+}
+
+// Ids like converters generate, on pages in document order. Returns false if any lookup gives the wrong page.
+bool measureAnchors() {
+  SectionAnchors anchors;
+  std::vector<std::pair<std::string, uint16_t>> ids;
+  for (int i = 0; i < ANCHOR_COUNT; i++) {
+    ids.emplace_back((i % 10 == 9 ? "note_" : "p") + std::to_string(i),
+                     static_cast<uint16_t>(i * PAGE_COUNT / ANCHOR_COUNT));
+    anchors.add(ids.back().first, ids.back().second);
+  }
+  // A repeated id keeps its first page
+  anchors.add(ids[1].first, PAGE_COUNT);
+
+  FsFile file;
+  file.write("LUT", 3);
+  if (!anchors.write(file)) {
+    std::cerr << "Anchor table failed to write" << std::endl;
+    return false;
+  }
+  const uint64_t tableBytes = file.size() - 3;
+
+  FsFile::counters = {};
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& [id, page] : ids) {
+    FsFile anchorFile = file.reopen();
+    if (SectionAnchors::findPage(anchorFile, 3, id) != page) {
+      std::cerr << "Anchor " << id << " not on page " << page << std::endl;
+      return false;
+    }
+  }
+  const double microseconds =
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  FsFile anchorFile = file.reopen();
+  if (SectionAnchors::findPage(anchorFile, 3, "missing") != -1) {
+    std::cerr << "Unknown anchor found" << std::endl;
+    return false;
+  }
+
+  std::cout << ANCHOR_COUNT << " anchors: table " << tableBytes << " bytes, " << std::setprecision(1)
+            << static_cast<double>(FsFile::counters.reads) / ANCHOR_COUNT << " reads and "
+            << static_cast<double>(FsFile::counters.bytesRead) / ANCHOR_COUNT << " bytes per lookup, "
+            << std::setprecision(2) << microseconds / ANCHOR_COUNT << " us per lookup from memory" << std::endl;
+  return true;
+}
+
+void printStats(const char* name, const FormatStats& stats) {
+  const double loads = static_cast<double>(LOAD_ROUNDS) * PAGE_COUNT;
+  std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << stats.fileBytes << std::setw(12) << static_cast<double>(stats.fileBytes) / PAGE_COUNT
+            << std::setw(12) << stats.reads / loads << std::setw(12) << stats.allocations / loads << std::setw(12)
+            << stats.microseconds / loads << std::setw(12) << stats.renderMicroseconds / RENDER_ROUNDS << std::endl;
+}
+}  // namespace
+
+int main() {
+  const auto vocabulary = loadWords("test/hyphenation_eval/resources/english_hyphenation_tests.txt");
+  if (vocabulary.empty()) {
+    std::cerr << "Could not load word list, run from the repository root" << std::endl;
+    return 1;
+  }
+  const auto pages = buildPages(vocabulary);
+
+  FsFile v12File;
+  FsFile v13File;
+  std::vector<uint32_t> v12Lut;
+  std::vector<uint32_t> v13Lut;
+  std::vector<std::vector<uint8_t>> records;
+  size_t words = 0;
+  for (const auto& benchPage : pages) {
+    v12Lut.push_back(static_cast<uint32_t>(v12File.position()));
+    writeV12Page(v12File, benchPage);
+    v13Lut.push_back(static_cast<uint32_t>(v13File.position()));
+    const auto page = toPage(benchPage);
+    if (!page.serialize(v13File)) {
+      std::cerr << "Page failed to serialize" << std::endl;
+      return 1;
+    }
+    records.push_back(encode(page));
+    for (const auto& line : benchPage) words += line.words.size();
+  }
+
+  // Every page must decode back to the same record
+  Page loadedPage;
+  Page::LoadBuffers buffers;
+  for (size_t i = 0; i < pages.size(); i++) {
+    FsFile pageFile = v13File.reopen();
+    pageFile.seek(v13Lut[i]);
+    if (!loadedPage.deserialize(pageFile, buffers) || encode(loadedPage) != records[i]) {
+      std::cerr << "Page " << i << " does not round trip" << std::endl;
+      return 1;
+    }
+  }
+  // And so must images between the lines
+  {
+    Page page = toPage(pages.front());
+    page.addImage({123456, 320, 240}, 80, 400);
+    FsFile pageFile;
+    page.serialize(pageFile);
+    pageFile.seek(0);
+    if (!loadedPage.deserialize(pageFile, buffers) || encode(loadedPage) != encode(page)) {
+      std::cerr << "Page with an image does not round trip" << std::endl;
+      return 1;
+    }
+  }
+
+  GfxRenderer renderer;
+  std::unique_ptr<LegacyPage> legacyPage;
+  const auto v12 = measure(
+      v12File, v12Lut,
+      [&legacyPage](FsFile& file) {
+        legacyPage = readV12Page(file);
+        return legacyPage != nullptr;
+      },
+      [&] { renderV12Page(renderer, *legacyPage); });
+  const auto v13 = measure(
+      v13File, v13Lut, [&](FsFile& file) { return loadedPage.deserialize(file, buffers); },
+      [&] { loadedPage.render(renderer, 0, 0, 0); });
+  if (v12.fileBytes == 0 || v13.fileBytes == 0) {
+    return 1;
+  }
+
+  std::cout << PAGE_COUNT << " pages, " << LINES_PER_PAGE << " lines and " << words / PAGE_COUNT
+            << " words per page, page loads from memory" << std::endl;
+  std::cout << std::left << std::setw(12) << "format" << std::right << std::setw(12) << "bytes" << std::setw(12)
+            << "bytes/page" << std::setw(12) << "reads/page" << std::setw(12) << "allocs/page" << std::setw(12)
+            << "load us" << std::setw(12) << "render us" << std::endl;
+  printStats("version 12", v12);
+  printStats("version 13", v13);
+  std::cout << "Size " << std::setprecision(1) << 100.0 * v13.fileBytes / v12.fileBytes << "% of version 12"
+            << std::endl;
+  return measureAnchors() ? 0 : 1;
+}
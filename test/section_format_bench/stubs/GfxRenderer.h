@@ -0,0 +1,34 @@
+#pragma once
+
+#include <EpdFontFamily.h>
+
+#include <cstddef>
+
+class Bitmap;
+
+// Only the calls page rendering makes. Drawing just touches the text, so render timings cover walking the page.
+class GfxRenderer {
+ public:
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+
+  mutable size_t drawnBytes = 0;
+
+  RenderMode getRenderMode() const { return BW; }
+  void drawBitmap(const Bitmap&, int, int, int, int, float = 0, float = 0) const {}
+  void drawLine(int, int, int, int, bool = true) const {}
+  int getTextWidth(int, const char* text, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {
+    return static_cast<int>(measure(text));
+  }
+  void drawText(int, int, int, const char* text, bool = true, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {
+    drawnBytes += measure(text);
+  }
+  int getTextAdvanceX(int, const char* text) const { return static_cast<int>(measure(text)); }
+  int getFontAscenderSize(int) const { return 0; }
+
+ private:
+  static size_t measure(const char* text) {
+    size_t length = 0;
+    while (text[length] != 0) length++;
+    return length;
+  }
+};
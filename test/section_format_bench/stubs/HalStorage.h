@@ -0,0 +1,77 @@
+#pragma once
+
+// Host stand-in for the SD card file: an in-memory file that counts the calls a page load makes
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+class FsFile {
+ public:
+  struct Counters {
+    size_t reads = 0;
+    size_t bytesRead = 0;
+  };
+
+  FsFile() : data(std::make_shared<std::vector<uint8_t>>()) {}
+
+  size_t write(const void* buffer, const size_t count) {
+    const auto* bytes = static_cast<const uint8_t*>(buffer);
+    if (pos + count > data->size()) {
+      data->resize(pos + count);
+    }
+    std::copy(bytes, bytes + count, data->begin() + pos);
+    pos += count;
+    return count;
+  }
+
+  int read() {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+  int read(void* buffer, const size_t count) {
+    counters.reads++;
+    const size_t n = std::min(count, data->size() - std::min(pos, data->size()));
+    memcpy(buffer, data->data() + pos, n);
+    pos += n;
+    counters.bytesRead += n;
+    return static_cast<int>(n);
+  }
+
+  bool seek(const uint64_t position) {
+    pos = position;
+    return true;
+  }
+  bool seekCur(const int64_t offset) {
+    pos += offset;
+    return true;
+  }
+  uint64_t position() const { return pos; }
+  uint64_t size() const { return data->size(); }
+  void close() {}
+  explicit operator bool() const { return true; }
+
+  // A second handle on the same contents, like reopening the file. Doesn't allocate, so allocation counts only
+  // cover the page load.
+  FsFile reopen() const { return FsFile(data); }
+
+  static Counters counters;
+
+ private:
+  explicit FsFile(std::shared_ptr<std::vector<uint8_t>> data) : data(std::move(data)) {}
+
+  std::shared_ptr<std::vector<uint8_t>> data;
+  size_t pos = 0;
+};
+
+// The bench's pages have no images, so nothing is ever opened by path
+class HalStorage {
+ public:
+  bool openFileForRead(const char*, const std::string&, FsFile&) { return false; }
+};
+
+inline HalStorage Storage;